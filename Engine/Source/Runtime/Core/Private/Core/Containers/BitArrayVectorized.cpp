@@ -0,0 +1,265 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Core/Containers/BitArrayVectorized.hpp"
+
+#include "Core/Platform/CPUFeatures.hpp"
+
+#include <bit>
+
+#if CORVUS_ARCH_X64
+#   include <immintrin.h>
+#endif
+
+namespace
+{
+    struct FAndOperation
+    {
+        static uint64 Apply(const uint64 A, const uint64 B) { return A & B; }
+#if CORVUS_ARCH_X64
+        static __m128i Apply(const __m128i A, const __m128i B) { return _mm_and_si128(A, B); }
+        CORVUS_TARGET_AVX2 static __m256i Apply(const __m256i A, const __m256i B) { return _mm256_and_si256(A, B); }
+#endif
+    };
+
+    struct FOrOperation
+    {
+        static uint64 Apply(const uint64 A, const uint64 B) { return A | B; }
+#if CORVUS_ARCH_X64
+        static __m128i Apply(const __m128i A, const __m128i B) { return _mm_or_si128(A, B); }
+        CORVUS_TARGET_AVX2 static __m256i Apply(const __m256i A, const __m256i B) { return _mm256_or_si256(A, B); }
+#endif
+    };
+
+    struct FXorOperation
+    {
+        static uint64 Apply(const uint64 A, const uint64 B) { return A ^ B; }
+#if CORVUS_ARCH_X64
+        static __m128i Apply(const __m128i A, const __m128i B) { return _mm_xor_si128(A, B); }
+        CORVUS_TARGET_AVX2 static __m256i Apply(const __m256i A, const __m256i B) { return _mm256_xor_si256(A, B); }
+#endif
+    };
+
+    // A & ~B, the intrinsics negate their first operand
+    struct FAndNotOperation
+    {
+        static uint64 Apply(const uint64 A, const uint64 B) { return A & ~B; }
+#if CORVUS_ARCH_X64
+        static __m128i Apply(const __m128i A, const __m128i B) { return _mm_andnot_si128(B, A); }
+        CORVUS_TARGET_AVX2 static __m256i Apply(const __m256i A, const __m256i B) { return _mm256_andnot_si256(B, A); }
+#endif
+    };
+
+    size64 ScalarCountSetBits(const uint64* Words, const size64 Start, const size64 NumWords)
+    {
+        size64 Count = 0;
+        for (size64 Index = Start; Index < NumWords; ++Index)
+        {
+            Count += static_cast<size64>(std::popcount(Words[Index]));
+        }
+        return Count;
+    }
+
+    template <typename TOperation>
+    void ScalarApply(uint64* Destination, const uint64* Source, const size64 Start, const size64 NumWords)
+    {
+        for (size64 Index = Start; Index < NumWords; ++Index)
+        {
+            Destination[Index] = TOperation::Apply(Destination[Index], Source[Index]);
+        }
+    }
+
+    size64 ScalarFindNonZeroWord(const uint64* Words, const size64 Start, const size64 NumWords)
+    {
+        size64 Index = Start;
+        while (Index < NumWords && Words[Index] == 0)
+        {
+            ++Index;
+        }
+        return Index;
+    }
+
+#if CORVUS_ARCH_X64
+    // Four independent sums keep the POPCNT units busy instead of waiting on one accumulator
+    CORVUS_TARGET_POPCNT size64 POPCNTCountSetBits(const uint64* Words, const size64 NumWords)
+    {
+        size64 Counts[4] = {};
+        size64 Index = 0;
+        for (; Index + 4 <= NumWords; Index += 4)
+        {
+            Counts[0] += static_cast<size64>(std::popcount(Words[Index]));
+            Counts[1] += static_cast<size64>(std::popcount(Words[Index + 1]));
+            Counts[2] += static_cast<size64>(std::popcount(Words[Index + 2]));
+            Counts[3] += static_cast<size64>(std::popcount(Words[Index + 3]));
+        }
+        for (; Index < NumWords; ++Index)
+        {
+            Counts[0] += static_cast<size64>(std::popcount(Words[Index]));
+        }
+        return Counts[0] + Counts[1] + Counts[2] + Counts[3];
+    }
+
+    // Counts the bits of every nibble with a 16 entry shuffle table, then sums the bytes with SAD. Four vectors
+    // add up to at most 32 per byte before they are widened, so the byte sums cannot overflow
+    CORVUS_TARGET_AVX2 __m256i AVX2CountBytes(const __m256i Vector)
+    {
+        const __m256i Table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i LowNibbles = _mm256_set1_epi8(0x0F);
+        const __m256i Low = _mm256_shuffle_epi8(Table, _mm256_and_si256(Vector, LowNibbles));
+        const __m256i High = _mm256_shuffle_epi8(Table, _mm256_and_si256(_mm256_srli_epi16(Vector, 4), LowNibbles));
+        return _mm256_add_epi8(Low, High);
+    }
+
+    CORVUS_TARGET_AVX2 size64 AVX2CountSetBits(const uint64* Words, const size64 NumWords)
+    {
+        __m256i Totals = _mm256_setzero_si256();
+        size64 Index = 0;
+        for (; Index + 16 <= NumWords; Index += 16)
+        {
+            const __m256i* Vectors = reinterpret_cast<const __m256i*>(Words + Index);
+            __m256i ByteCounts = AVX2CountBytes(_mm256_loadu_si256(Vectors));
+            ByteCounts = _mm256_add_epi8(ByteCounts, AVX2CountBytes(_mm256_loadu_si256(Vectors + 1)));
+            ByteCounts = _mm256_add_epi8(ByteCounts, AVX2CountBytes(_mm256_loadu_si256(Vectors + 2)));
+            ByteCounts = _mm256_add_epi8(ByteCounts, AVX2CountBytes(_mm256_loadu_si256(Vectors + 3)));
+            Totals = _mm256_add_epi64(Totals, _mm256_sad_epu8(ByteCounts, _mm256_setzero_si256()));
+        }
+        alignas(32) uint64 Lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(Lanes), Totals);
+        size64 Count = Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+        for (; Index < NumWords; ++Index)
+        {
+            Count += static_cast<size64>(std::popcount(Words[Index]));
+        }
+        return Count;
+    }
+
+    template <typename TOperation>
+    void SSE2Apply(uint64* Destination, const uint64* Source, const size64 NumWords)
+    {
+        size64 Index = 0;
+        for (; Index + 2 <= NumWords; Index += 2)
+        {
+            __m128i* Target = reinterpret_cast<__m128i*>(Destination + Index);
+            const __m128i Operand = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+            _mm_storeu_si128(Target, TOperation::Apply(_mm_loadu_si128(Target), Operand));
+        }
+        ScalarApply<TOperation>(Destination, Source, Index, NumWords);
+    }
+
+    template <typename TOperation>
+    CORVUS_TARGET_AVX2 void AVX2Apply(uint64* Destination, const uint64* Source, const size64 NumWords)
+    {
+        size64 Index = 0;
+        for (; Index + 8 <= NumWords; Index += 8)
+        {
+            __m256i* Target = reinterpret_cast<__m256i*>(Destination + Index);
+            const __m256i* Operands = reinterpret_cast<const __m256i*>(Source + Index);
+            const __m256i Result0 = TOperation::Apply(_mm256_loadu_si256(Target), _mm256_loadu_si256(Operands));
+            const __m256i Result1 = TOperation::Apply(_mm256_loadu_si256(Target + 1), _mm256_loadu_si256(Operands + 1));
+            _mm256_storeu_si256(Target, Result0);
+            _mm256_storeu_si256(Target + 1, Result1);
+        }
+        for (; Index + 4 <= NumWords; Index += 4)
+        {
+            __m256i* Target = reinterpret_cast<__m256i*>(Destination + Index);
+            _mm256_storeu_si256(Target, TOperation::Apply(_mm256_loadu_si256(Target), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source + Index))));
+        }
+        ScalarApply<TOperation>(Destination, Source, Index, NumWords);
+    }
+
+    // Tests eight words per step, the scalar scan then finds the word within the step
+    size64 SSE2FindNonZeroWord(const uint64* Words, const size64 Start, const size64 NumWords)
+    {
+        size64 Index = Start;
+        for (; Index + 8 <= NumWords; Index += 8)
+        {
+            const __m128i* Vectors = reinterpret_cast<const __m128i*>(Words + Index);
+            const __m128i Combined = _mm_or_si128(_mm_or_si128(_mm_loadu_si128(Vectors), _mm_loadu_si128(Vectors + 1)),
+                _mm_or_si128(_mm_loadu_si128(Vectors + 2), _mm_loadu_si128(Vectors + 3)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(Combined, _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+        }
+        return ScalarFindNonZeroWord(Words, Index, NumWords);
+    }
+
+    CORVUS_TARGET_AVX2 size64 AVX2FindNonZeroWord(const uint64* Words, const size64 Start, const size64 NumWords)
+    {
+        size64 Index = Start;
+        for (; Index + 16 <= NumWords; Index += 16)
+        {
+            const __m256i* Vectors = reinterpret_cast<const __m256i*>(Words + Index);
+            const __m256i Combined = _mm256_or_si256(_mm256_or_si256(_mm256_loadu_si256(Vectors), _mm256_loadu_si256(Vectors + 1)),
+                _mm256_or_si256(_mm256_loadu_si256(Vectors + 2), _mm256_loadu_si256(Vectors + 3)));
+            if (!_mm256_testz_si256(Combined, Combined))
+            {
+                break;
+            }
+        }
+        return ScalarFindNonZeroWord(Words, Index, NumWords);
+    }
+#endif
+
+    template <typename TOperation>
+    void DispatchApply(uint64* Destination, const uint64* Source, const size64 NumWords)
+    {
+#if CORVUS_ARCH_X64
+        if (FCPUFeatures::HasAVX2())
+        {
+            AVX2Apply<TOperation>(Destination, Source, NumWords);
+            return;
+        }
+        SSE2Apply<TOperation>(Destination, Source, NumWords);
+#else
+        ScalarApply<TOperation>(Destination, Source, 0, NumWords);
+#endif
+    }
+}
+
+size64 BitArray::Vectorized::CountSetBits(const uint64* Words, const size64 NumWords)
+{
+#if CORVUS_ARCH_X64
+    if (FCPUFeatures::HasAVX2())
+    {
+        return AVX2CountSetBits(Words, NumWords);
+    }
+    if (FCPUFeatures::HasPOPCNT())
+    {
+        return POPCNTCountSetBits(Words, NumWords);
+    }
+#endif
+    return ScalarCountSetBits(Words, 0, NumWords);
+}
+
+void BitArray::Vectorized::And(uint64* Destination, const uint64* Source, const size64 NumWords)
+{
+    DispatchApply<FAndOperation>(Destination, Source, NumWords);
+}
+
+void BitArray::Vectorized::Or(uint64* Destination, const uint64* Source, const size64 NumWords)
+{
+    DispatchApply<FOrOperation>(Destination, Source, NumWords);
+}
+
+void BitArray::Vectorized::Xor(uint64* Destination, const uint64* Source, const size64 NumWords)
+{
+    DispatchApply<FXorOperation>(Destination, Source, NumWords);
+}
+
+void BitArray::Vectorized::AndNot(uint64* Destination, const uint64* Source, const size64 NumWords)
+{
+    DispatchApply<FAndNotOperation>(Destination, Source, NumWords);
+}
+
+size64 BitArray::Vectorized::FindNonZeroWord(const uint64* Words, const size64 Start, const size64 NumWords)
+{
+#if CORVUS_ARCH_X64
+    if (FCPUFeatures::HasAVX2())
+    {
+        return AVX2FindNonZeroWord(Words, Start, NumWords);
+    }
+    return SSE2FindNonZeroWord(Words, Start, NumWords);
+#else
+    return ScalarFindNonZeroWord(Words, Start, NumWords);
+#endif
+}
@@ -0,0 +1,412 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Core/Containers/RangesVectorized.hpp"
+
+#include "Core/Platform/CPUFeatures.hpp"
+
+#include <bit>
+
+#if CORVUS_ARCH_X64
+#   include <immintrin.h>
+#endif
+
+namespace
+{
+    template <typename T>
+    size64 ScalarFind(const T* Data, const size64 Start, const size64 Count, const T Value)
+    {
+        for (size64 Index = Start; Index < Count; ++Index)
+        {
+            if (Data[Index] == Value)
+            {
+                return Index;
+            }
+        }
+        return static_cast<size64>(-1);
+    }
+
+    template <typename T>
+    size64 ScalarCount(const T* Data, const size64 Start, const size64 Count, const T Value)
+    {
+        size64 Result = 0;
+        for (size64 Index = Start; Index < Count; ++Index)
+        {
+            Result += Data[Index] == Value ? 1 : 0;
+        }
+        return Result;
+    }
+
+    template <typename T>
+    void ScalarFill(T* Data, const size64 Start, const size64 Count, const T Value)
+    {
+        for (size64 Index = Start; Index < Count; ++Index)
+        {
+            Data[Index] = Value;
+        }
+    }
+
+#if CORVUS_ARCH_X64
+    // Each lane set wraps one vector width and element type. MatchMask returns a movemask with
+    // BitsPerLane bits per element, so the first hit is CountTrailingZeros / BitsPerLane
+    template <typename T>
+    struct TSSE2Lanes;
+
+    template <>
+    struct TSSE2Lanes<uint8>
+    {
+        using FVector = __m128i;
+        static constexpr uint32 BitsPerLane = 1;
+
+        static FVector Splat(const uint8 Value) { return _mm_set1_epi8(static_cast<char>(Value)); }
+        static FVector Load(const uint8* Data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data)); }
+        static void Store(uint8* Data, const FVector Value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(Data), Value); }
+        static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(A, B))); }
+    };
+
+    template <>
+    struct TSSE2Lanes<uint16>
+    {
+        using FVector = __m128i;
+        static constexpr uint32 BitsPerLane = 2;
+
+        static FVector Splat(const uint16 Value) { return _mm_set1_epi16(static_cast<int16>(Value)); }
+        static FVector Load(const uint16* Data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data)); }
+        static void Store(uint16* Data, const FVector Value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(Data), Value); }
+        static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi16(A, B))); }
+    };
+
+    template <>
+    struct TSSE2Lanes<uint32>
+    {
+        using FVector = __m128i;
+        static constexpr uint32 BitsPerLane = 1;
+
+        static FVector Splat(const uint32 Value) { return _mm_set1_epi32(static_cast<int32>(Value)); }
+        static FVector Load(const uint32* Data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data)); }
+        static void Store(uint32* Data, const FVector Value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(Data), Value); }
+        static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(A, B)))); }
+    };
+
+    template <>
+    struct TSSE2Lanes<uint64>
+    {
+        using FVector = __m128i;
+        static constexpr uint32 BitsPerLane = 1;
+
+        static FVector Splat(const uint64 Value) { return _mm_set1_epi64x(static_cast<int64>(Value)); }
+        static FVector Load(const uint64* Data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data)); }
+        static void Store(uint64* Data, const FVector Value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(Data), Value); }
+
+        static uint32 MatchMask(const FVector A, const FVector B)
+        {
+            // SSE2 has no 64-bit compare, a lane matches when both of its 32-bit halves match
+            const __m128i Halves = _mm_cmpeq_epi32(A, B);
+            const __m128i Both = _mm_and_si128(Halves, _mm_shuffle_epi32(Halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            return static_cast<uint32>(_mm_movemask_pd(_mm_castsi128_pd(Both)));
+        }
+    };
+
+    template <>
+    struct TSSE2Lanes<float32>
+    {
+        using FVector = __m128;
+        static constexpr uint32 BitsPerLane = 1;
+
+        static FVector Splat(const float32 Value) { return _mm_set1_ps(Value); }
+        static FVector Load(const float32* Data) { return _mm_loadu_ps(Data); }
+        static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm_movemask_ps(_mm_cmpeq_ps(A, B))); }
+    };
+
+    template <>
+    struct TSSE2Lanes<float64>
+    {
+        using FVector = __m128d;
+        static constexpr uint32 BitsPerLane = 1;
+
+        static FVector Splat(const float64 Value) { return _mm_set1_pd(Value); }
+        static FVector Load(const float64* Data) { return _mm_loadu_pd(Data); }
+        static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm_movemask_pd(_mm_cmpeq_pd(A, B))); }
+    };
+
+    template <typename T>
+    struct TAVX2Lanes;
+
+    template <>
+    struct TAVX2Lanes<uint8>
+    {
+        using FVector = __m256i;
+        static constexpr uint32 BitsPerLane = 1;
+
+        CORVUS_TARGET_AVX2 static FVector Splat(const uint8 Value) { return _mm256_set1_epi8(static_cast<char>(Value)); }
+        CORVUS_TARGET_AVX2 static FVector Load(const uint8* Data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data)); }
+        CORVUS_TARGET_AVX2 static void Store(uint8* Data, const FVector Value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(Data), Value); }
+        CORVUS_TARGET_AVX2 static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(A, B))); }
+    };
+
+    template <>
+    struct TAVX2Lanes<uint16>
+    {
+        using FVector = __m256i;
+        static constexpr uint32 BitsPerLane = 2;
+
+        CORVUS_TARGET_AVX2 static FVector Splat(const uint16 Value) { return _mm256_set1_epi16(static_cast<int16>(Value)); }
+        CORVUS_TARGET_AVX2 static FVector Load(const uint16* Data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data)); }
+        CORVUS_TARGET_AVX2 static void Store(uint16* Data, const FVector Value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(Data), Value); }
+        CORVUS_TARGET_AVX2 static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(A, B))); }
+    };
+
+    template <>
+    struct TAVX2Lanes<uint32>
+    {
+        using FVector = __m256i;
+        static constexpr uint32 BitsPerLane = 1;
+
+        CORVUS_TARGET_AVX2 static FVector Splat(const uint32 Value) { return _mm256_set1_epi32(static_cast<int32>(Value)); }
+        CORVUS_TARGET_AVX2 static FVector Load(const uint32* Data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data)); }
+        CORVUS_TARGET_AVX2 static void Store(uint32* Data, const FVector Value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(Data), Value); }
+        CORVUS_TARGET_AVX2 static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(A, B)))); }
+    };
+
+    template <>
+    struct TAVX2Lanes<uint64>
+    {
+        using FVector = __m256i;
+        static constexpr uint32 BitsPerLane = 1;
+
+        CORVUS_TARGET_AVX2 static FVector Splat(const uint64 Value) { return _mm256_set1_epi64x(static_cast<int64>(Value)); }
+        CORVUS_TARGET_AVX2 static FVector Load(const uint64* Data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data)); }
+        CORVUS_TARGET_AVX2 static void Store(uint64* Data, const FVector Value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(Data), Value); }
+        CORVUS_TARGET_AVX2 static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(A, B)))); }
+    };
+
+    template <>
+    struct TAVX2Lanes<float32>
+    {
+        using FVector = __m256;
+        static constexpr uint32 BitsPerLane = 1;
+
+        CORVUS_TARGET_AVX2 static FVector Splat(const float32 Value) { return _mm256_set1_ps(Value); }
+        CORVUS_TARGET_AVX2 static FVector Load(const float32* Data) { return _mm256_loadu_ps(Data); }
+        CORVUS_TARGET_AVX2 static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(A, B, _CMP_EQ_OQ))); }
+    };
+
+    template <>
+    struct TAVX2Lanes<float64>
+    {
+        using FVector = __m256d;
+        static constexpr uint32 BitsPerLane = 1;
+
+        CORVUS_TARGET_AVX2 static FVector Splat(const float64 Value) { return _mm256_set1_pd(Value); }
+        CORVUS_TARGET_AVX2 static FVector Load(const float64* Data) { return _mm256_loadu_pd(Data); }
+        CORVUS_TARGET_AVX2 static uint32 MatchMask(const FVector A, const FVector B) { return static_cast<uint32>(_mm256_movemask_pd(_mm256_cmp_pd(A, B, _CMP_EQ_OQ))); }
+    };
+
+    // The kernels are written once and stamped out per instruction set. The AVX2 copies carry the target
+    // attribute so GCC and Clang inline the AVX2 lane functions into them
+#   define CORVUS_DEFINE_VECTOR_KERNELS(Lanes, Prefix, Target) \
+    template <typename T> \
+    Target size64 Prefix##Find(const T* Data, const size64 Count, const T Value) \
+    { \
+        using FLanes = Lanes<T>; \
+        constexpr size64 Width = sizeof(typename FLanes::FVector) / sizeof(T); \
+        const typename FLanes::FVector Needle = FLanes::Splat(Value); \
+        size64 Index = 0; \
+        for (; Index + Width * 4 <= Count; Index += Width * 4) \
+        { \
+            const uint32 Mask0 = FLanes::MatchMask(FLanes::Load(Data + Index), Needle); \
+            const uint32 Mask1 = FLanes::MatchMask(FLanes::Load(Data + Index + Width), Needle); \
+            const uint32 Mask2 = FLanes::MatchMask(FLanes::Load(Data + Index + Width * 2), Needle); \
+            const uint32 Mask3 = FLanes::MatchMask(FLanes::Load(Data + Index + Width * 3), Needle); \
+            if ((Mask0 | Mask1 | Mask2 | Mask3) != 0) \
+            { \
+                const uint32 Masks[4] = {Mask0, Mask1, Mask2, Mask3}; \
+                for (size64 Block = 0; Block < 4; ++Block) \
+                { \
+                    if (Masks[Block] != 0) \
+                    { \
+                        return Index + Block * Width + std::countr_zero(Masks[Block]) / FLanes::BitsPerLane; \
+                    } \
+                } \
+            } \
+        } \
+        for (; Index + Width <= Count; Index += Width) \
+        { \
+            const uint32 Mask = FLanes::MatchMask(FLanes::Load(Data + Index), Needle); \
+            if (Mask != 0) \
+            { \
+                return Index + std::countr_zero(Mask) / FLanes::BitsPerLane; \
+            } \
+        } \
+        return ScalarFind(Data, Index, Count, Value); \
+    } \
+    \
+    template <typename T> \
+    Target size64 Prefix##Count(const T* Data, const size64 Count, const T Value) \
+    { \
+        using FLanes = Lanes<T>; \
+        constexpr size64 Width = sizeof(typename FLanes::FVector) / sizeof(T); \
+        const typename FLanes::FVector Needle = FLanes::Splat(Value); \
+        size64 MatchedBits = 0; \
+        size64 Index = 0; \
+        for (; Index + Width * 2 <= Count; Index += Width * 2) \
+        { \
+            MatchedBits += static_cast<size64>(std::popcount(FLanes::MatchMask(FLanes::Load(Data + Index), Needle))); \
+            MatchedBits += static_cast<size64>(std::popcount(FLanes::MatchMask(FLanes::Load(Data + Index + Width), Needle))); \
+        } \
+        for (; Index + Width <= Count; Index += Width) \
+        { \
+            MatchedBits += static_cast<size64>(std::popcount(FLanes::MatchMask(FLanes::Load(Data + Index), Needle))); \
+        } \
+        return MatchedBits / FLanes::BitsPerLane + ScalarCount(Data, Index, Count, Value); \
+    } \
+    \
+    template <typename T> \
+    Target void Prefix##Fill(T* Data, const size64 Count, const T Value) \
+    { \
+        using FLanes = Lanes<T>; \
+        constexpr size64 Width = sizeof(typename FLanes::FVector) / sizeof(T); \
+        const typename FLanes::FVector Pattern = FLanes::Splat(Value); \
+        size64 Index = 0; \
+        for (; Index + Width * 4 <= Count; Index += Width * 4) \
+        { \
+            FLanes::Store(Data + Index, Pattern); \
+            FLanes::Store(Data + Index + Width, Pattern); \
+            FLanes::Store(Data + Index + Width * 2, Pattern); \
+            FLanes::Store(Data + Index + Width * 3, Pattern); \
+        } \
+        for (; Index + Width <= Count; Index += Width) \
+        { \
+            FLanes::Store(Data + Index, Pattern); \
+        } \
+        ScalarFill(Data, Index, Count, Value); \
+    }
+
+    CORVUS_DEFINE_VECTOR_KERNELS(TSSE2Lanes, SSE2, )
+    CORVUS_DEFINE_VECTOR_KERNELS(TAVX2Lanes, AVX2, CORVUS_TARGET_AVX2)
+
+#   undef CORVUS_DEFINE_VECTOR_KERNELS
+#endif
+
+    template <typename T>
+    size64 DispatchFind(const T* Data, const size64 Count, const T Value)
+    {
+#if CORVUS_ARCH_X64
+        if (FCPUFeatures::HasAVX2())
+        {
+            return AVX2Find(Data, Count, Value);
+        }
+        return SSE2Find(Data, Count, Value);
+#else
+        return ScalarFind(Data, 0, Count, Value);
+#endif
+    }
+
+    template <typename T>
+    size64 DispatchCount(const T* Data, const size64 Count, const T Value)
+    {
+#if CORVUS_ARCH_X64
+        if (FCPUFeatures::HasAVX2())
+        {
+            return AVX2Count(Data, Count, Value);
+        }
+        return SSE2Count(Data, Count, Value);
+#else
+        return ScalarCount(Data, 0, Count, Value);
+#endif
+    }
+
+    template <typename T>
+    void DispatchFill(T* Data, const size64 Count, const T Value)
+    {
+#if CORVUS_ARCH_X64
+        if (FCPUFeatures::HasAVX2())
+        {
+            AVX2Fill(Data, Count, Value);
+            return;
+        }
+        SSE2Fill(Data, Count, Value);
+#else
+        ScalarFill(Data, 0, Count, Value);
+#endif
+    }
+}
+
+size64 Ranges::Vectorized::Find(const uint8* Data, const size64 Count, const uint8 Value)
+{
+    return DispatchFind(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Find(const uint16* Data, const size64 Count, const uint16 Value)
+{
+    return DispatchFind(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Find(const uint32* Data, const size64 Count, const uint32 Value)
+{
+    return DispatchFind(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Find(const uint64* Data, const size64 Count, const uint64 Value)
+{
+    return DispatchFind(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Find(const float32* Data, const size64 Count, const float32 Value)
+{
+    return DispatchFind(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Find(const float64* Data, const size64 Count, const float64 Value)
+{
+    return DispatchFind(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Count(const uint8* Data, const size64 Count, const uint8 Value)
+{
+    return DispatchCount(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Count(const uint16* Data, const size64 Count, const uint16 Value)
+{
+    return DispatchCount(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Count(const uint32* Data, const size64 Count, const uint32 Value)
+{
+    return DispatchCount(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Count(const uint64* Data, const size64 Count, const uint64 Value)
+{
+    return DispatchCount(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Count(const float32* Data, const size64 Count, const float32 Value)
+{
+    return DispatchCount(Data, Count, Value);
+}
+
+size64 Ranges::Vectorized::Count(const float64* Data, const size64 Count, const float64 Value)
+{
+    return DispatchCount(Data, Count, Value);
+}
+
+void Ranges::Vectorized::Fill(uint8* Data, const size64 Count, const uint8 Value)
+{
+    DispatchFill(Data, Count, Value);
+}
+
+void Ranges::Vectorized::Fill(uint16* Data, const size64 Count, const uint16 Value)
+{
+    DispatchFill(Data, Count, Value);
+}
+
+void Ranges::Vectorized::Fill(uint32* Data, const size64 Count, const uint32 Value)
+{
+    DispatchFill(Data, Count, Value);
+}
+
+void Ranges::Vectorized::Fill(uint64* Data, const size64 Count, const uint64 Value)
+{
+    DispatchFill(Data, Count, Value);
+}
@@ -0,0 +1,111 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Core/Hash/Hash.hpp"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
+
+namespace
+{
+    // Follows wyhash final version 4 (public domain): 64x64 to 128 bit multiplies fold 16 bytes per step, three
+    // independent lanes for long inputs
+    constexpr uint64 Secret[4] = {0x2D358DCCAA6C78A5ull, 0x8BB84B93962EACC9ull, 0x4B33A62ED433D4A3ull, 0x4D5A2DA51DE1AA47ull};
+
+    void Multiply128(uint64& A, uint64& B)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        uint64 High = 0;
+        A = _umul128(A, B, &High);
+        B = High;
+#else
+        const unsigned __int128 Product = static_cast<unsigned __int128>(A) * B;
+        A = static_cast<uint64>(Product);
+        B = static_cast<uint64>(Product >> 64);
+#endif
+    }
+
+    uint64 Mix(uint64 A, uint64 B)
+    {
+        Multiply128(A, B);
+        return A ^ B;
+    }
+
+    uint64 Read8(const uint8* Data)
+    {
+        uint64 Value;
+        std::memcpy(&Value, Data, sizeof(Value));
+        return Value;
+    }
+
+    uint64 Read4(const uint8* Data)
+    {
+        uint32 Value;
+        std::memcpy(&Value, Data, sizeof(Value));
+        return Value;
+    }
+
+    // One to three bytes without branching on the exact size
+    uint64 Read3(const uint8* Data, const size64 Size)
+    {
+        return (static_cast<uint64>(Data[0]) << 16) | (static_cast<uint64>(Data[Size >> 1]) << 8) | Data[Size - 1];
+    }
+}
+
+uint64 Hash::HashBytes(const void* Data, const size64 Size, uint64 Seed)
+{
+    const uint8* Bytes = static_cast<const uint8*>(Data);
+    Seed ^= Mix(Seed ^ Secret[0], Secret[1]);
+
+    uint64 A = 0;
+    uint64 B = 0;
+    if (Size <= 16)
+    {
+        if (Size >= 4)
+        {
+            // Two overlapping pairs of 4 byte reads cover 4 to 16 bytes
+            const size64 Middle = (Size >> 3) << 2;
+            A = (Read4(Bytes) << 32) | Read4(Bytes + Middle);
+            B = (Read4(Bytes + Size - 4) << 32) | Read4(Bytes + Size - 4 - Middle);
+        }
+        else if (Size > 0)
+        {
+            A = Read3(Bytes, Size);
+        }
+    }
+    else
+    {
+        size64 Remaining = Size;
+        if (Remaining > 48)
+        {
+            uint64 Seed1 = Seed;
+            uint64 Seed2 = Seed;
+            do
+            {
+                Seed = Mix(Read8(Bytes) ^ Secret[1], Read8(Bytes + 8) ^ Seed);
+                Seed1 = Mix(Read8(Bytes + 16) ^ Secret[2], Read8(Bytes + 24) ^ Seed1);
+                Seed2 = Mix(Read8(Bytes + 32) ^ Secret[3], Read8(Bytes + 40) ^ Seed2);
+                Bytes += 48;
+                Remaining -= 48;
+            }
+            while (Remaining > 48);
+            Seed ^= Seed1 ^ Seed2;
+        }
+        while (Remaining > 16)
+        {
+            Seed = Mix(Read8(Bytes) ^ Secret[1], Read8(Bytes + 8) ^ Seed);
+            Bytes += 16;
+            Remaining -= 16;
+        }
+        // The last 16 bytes, overlapping what was already consumed
+        A = Read8(Bytes + Remaining - 16);
+        B = Read8(Bytes + Remaining - 8);
+    }
+
+    A ^= Secret[1];
+    B ^= Seed;
+    Multiply128(A, B);
+    return Mix(A ^ Secret[0] ^ Size, B ^ Secret[1]);
+}
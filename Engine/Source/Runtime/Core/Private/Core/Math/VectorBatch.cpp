@@ -0,0 +1,93 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Core/Math/VectorBatch.hpp"
+
+namespace
+{
+#if CORVUS_ARCH_X64
+    // Every matrix element is broadcast once, each batch then costs three multiply add chains per half
+    void SSE2TransformPoints(const FMatrix44& Matrix, const FVector3x8* Points, FVector3x8* OutPoints, const size64 Count)
+    {
+        __m128 Elements[3][4];
+        for (uint32 Row = 0; Row < 3; ++Row)
+        {
+            for (uint32 Column = 0; Column < 4; ++Column)
+            {
+                Elements[Row][Column] = _mm_set1_ps(Matrix.M[Row][Column]);
+            }
+        }
+
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            const FVector3x8& Point = Points[Index];
+            FVector3x8& OutPoint = OutPoints[Index];
+            for (uint32 Half = 0; Half < FVector3x8::NumLanes; Half += 4)
+            {
+                const __m128 X = _mm_load_ps(Point.X + Half);
+                const __m128 Y = _mm_load_ps(Point.Y + Half);
+                const __m128 Z = _mm_load_ps(Point.Z + Half);
+                __m128 Results[3];
+                for (uint32 Row = 0; Row < 3; ++Row)
+                {
+                    Results[Row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Elements[Row][0], X), _mm_mul_ps(Elements[Row][1], Y)),
+                        _mm_add_ps(_mm_mul_ps(Elements[Row][2], Z), Elements[Row][3]));
+                }
+                _mm_store_ps(OutPoint.X + Half, Results[0]);
+                _mm_store_ps(OutPoint.Y + Half, Results[1]);
+                _mm_store_ps(OutPoint.Z + Half, Results[2]);
+            }
+        }
+    }
+
+    CORVUS_TARGET_AVX2 void AVX2TransformPoints(const FMatrix44& Matrix, const FVector3x8* Points, FVector3x8* OutPoints, const size64 Count)
+    {
+        __m256 Elements[3][4];
+        for (uint32 Row = 0; Row < 3; ++Row)
+        {
+            for (uint32 Column = 0; Column < 4; ++Column)
+            {
+                Elements[Row][Column] = _mm256_set1_ps(Matrix.M[Row][Column]);
+            }
+        }
+
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            const FVector3x8& Point = Points[Index];
+            FVector3x8& OutPoint = OutPoints[Index];
+            const __m256 X = _mm256_load_ps(Point.X);
+            const __m256 Y = _mm256_load_ps(Point.Y);
+            const __m256 Z = _mm256_load_ps(Point.Z);
+            __m256 Results[3];
+            for (uint32 Row = 0; Row < 3; ++Row)
+            {
+                Results[Row] = _mm256_fmadd_ps(Elements[Row][0], X, _mm256_fmadd_ps(Elements[Row][1], Y, _mm256_fmadd_ps(Elements[Row][2], Z, Elements[Row][3])));
+            }
+            _mm256_store_ps(OutPoint.X, Results[0]);
+            _mm256_store_ps(OutPoint.Y, Results[1]);
+            _mm256_store_ps(OutPoint.Z, Results[2]);
+        }
+    }
+#else
+    void ScalarTransformPoints(const FMatrix44& Matrix, const FVector3x8* Points, FVector3x8* OutPoints, const size64 Count)
+    {
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            OutPoints[Index] = Points[Index].TransformPoints(Matrix);
+        }
+    }
+#endif
+}
+
+void Math::TransformPoints(const FMatrix44& Matrix, const FVector3x8* Points, FVector3x8* OutPoints, const size64 Count)
+{
+#if CORVUS_ARCH_X64
+    if (FCPUFeatures::HasAVX2() && FCPUFeatures::HasFMA())
+    {
+        AVX2TransformPoints(Matrix, Points, OutPoints, Count);
+        return;
+    }
+    SSE2TransformPoints(Matrix, Points, OutPoints, Count);
+#else
+    ScalarTransformPoints(Matrix, Points, OutPoints, Count);
+#endif
+}
@@ -24,6 +24,16 @@ void FMemory::Copy(const void* SourcePointer, void* TargetPointer, const size64
     std::memcpy(TargetPointer, SourcePointer, Size);
 }
 
+void FMemory::Move(const void* SourcePointer, void* TargetPointer, const size64 Size)
+{
+    std::memmove(TargetPointer, SourcePointer, Size);
+}
+
+void FMemory::Set(void* TargetPointer, const uint8 Value, const size64 Size)
+{
+    std::memset(TargetPointer, Value, Size);
+}
+
 size64 FMemory::GetAllocationSize(const void* Pointer)
 {
     return mi_usable_size(Pointer);
@@ -0,0 +1,124 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Core/Platform/CPUFeatures.hpp"
+
+#if CORVUS_ARCH_X64
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+namespace
+{
+    struct FCPUFeatureSet
+    {
+        bool8 bSSE42 = false;
+        bool8 bPOPCNT = false;
+        bool8 bAVX = false;
+        bool8 bAVX2 = false;
+        bool8 bFMA = false;
+        bool8 bBMI1 = false;
+        bool8 bBMI2 = false;
+    };
+
+#if CORVUS_ARCH_X64
+    void QueryCPUID(const uint32 Leaf, const uint32 SubLeaf, uint32 (&Registers)[4])
+    {
+#   if defined(_MSC_VER)
+        int32 Values[4];
+        __cpuidex(Values, static_cast<int32>(Leaf), static_cast<int32>(SubLeaf));
+        for (int32 Index = 0; Index < 4; ++Index)
+        {
+            Registers[Index] = static_cast<uint32>(Values[Index]);
+        }
+#   else
+        __cpuid_count(Leaf, SubLeaf, Registers[0], Registers[1], Registers[2], Registers[3]);
+#   endif
+    }
+
+    uint64 QueryEnabledXSaveFeatures()
+    {
+#   if defined(_MSC_VER)
+        return _xgetbv(0);
+#   else
+        uint32 Low = 0;
+        uint32 High = 0;
+        __asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+        return (static_cast<uint64>(High) << 32) | Low;
+#   endif
+    }
+#endif
+
+    FCPUFeatureSet DetectCPUFeatures()
+    {
+        FCPUFeatureSet Features;
+#if CORVUS_ARCH_X64
+        uint32 Registers[4] = {};
+        QueryCPUID(0, 0, Registers);
+        const uint32 MaxLeaf = Registers[0];
+
+        QueryCPUID(1, 0, Registers);
+        Features.bSSE42 = (Registers[2] & (1u << 20)) != 0;
+        Features.bPOPCNT = (Registers[2] & (1u << 23)) != 0;
+
+        // AVX state has to be enabled by the OS (OSXSAVE + XMM/YMM in XCR0), not just reported by the CPU
+        const bool8 bOSXSave = (Registers[2] & (1u << 27)) != 0;
+        const bool8 bAVXReported = (Registers[2] & (1u << 28)) != 0;
+        const bool8 bYMMEnabled = bOSXSave && (QueryEnabledXSaveFeatures() & 0x6) == 0x6;
+        Features.bAVX = bAVXReported && bYMMEnabled;
+        Features.bFMA = Features.bAVX && (Registers[2] & (1u << 12)) != 0;
+
+        if (MaxLeaf >= 7)
+        {
+            QueryCPUID(7, 0, Registers);
+            Features.bAVX2 = Features.bAVX && (Registers[1] & (1u << 5)) != 0;
+            Features.bBMI1 = (Registers[1] & (1u << 3)) != 0;
+            Features.bBMI2 = (Registers[1] & (1u << 8)) != 0;
+        }
+#endif
+        return Features;
+    }
+
+    const FCPUFeatureSet& GetCPUFeatures()
+    {
+        static const FCPUFeatureSet Features = DetectCPUFeatures();
+        return Features;
+    }
+}
+
+bool8 FCPUFeatures::HasSSE42()
+{
+    return GetCPUFeatures().bSSE42;
+}
+
+bool8 FCPUFeatures::HasPOPCNT()
+{
+    return GetCPUFeatures().bPOPCNT;
+}
+
+bool8 FCPUFeatures::HasAVX()
+{
+    return GetCPUFeatures().bAVX;
+}
+
+bool8 FCPUFeatures::HasAVX2()
+{
+    return GetCPUFeatures().bAVX2;
+}
+
+bool8 FCPUFeatures::HasFMA()
+{
+    return GetCPUFeatures().bFMA;
+}
+
+bool8 FCPUFeatures::HasBMI1()
+{
+    return GetCPUFeatures().bBMI1;
+}
+
+bool8 FCPUFeatures::HasBMI2()
+{
+    return GetCPUFeatures().bBMI2;
+}
@@ -0,0 +1,270 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Core/Threading/JobSystem.hpp"
+
+#include "Core/Containers/Array.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    struct FJobBatch
+    {
+        FJobTaskFunction Function = nullptr;
+        void* Context = nullptr;
+        size64 NumTasks = 0;
+        std::atomic<size64> NextTask = 0;
+        std::atomic<size64> NumCompletedTasks = 0;
+
+        // Threads that took the batch from the queue and may still touch it
+        std::atomic<uint32> NumHelpers = 0;
+    };
+
+    struct FJobSystemState
+    {
+        std::mutex Mutex;
+        std::condition_variable WakeCondition;
+        TArray<FJobBatch*> PendingBatches;
+        TArray<std::thread> Workers;
+        bool8 bShuttingDown = false;
+    };
+
+    FJobSystemState JobSystemState;
+    std::atomic<uint32> NumActiveWorkers = 0;
+    thread_local uint32 CurrentThreadIndex = 0;
+
+    // Bumped whenever the last helper lets go of a batch. A dispatching thread may free its batch the moment the
+    // helper count reaches zero, so it waits on this instead of on the count inside the batch
+    std::atomic<uint32> HelperReleaseEpoch = 0;
+
+    // Failed attempts at finding other work before a dispatching thread blocks until its batch is done
+    constexpr uint32 MaxIdleSpins = 64;
+
+    // Claims and runs tasks of one batch until none are left. Returns whether any task was executed
+    bool8 ExecuteBatchTasks(FJobBatch& Batch)
+    {
+        bool8 bExecutedAny = false;
+        while (true)
+        {
+            const size64 TaskIndex = Batch.NextTask.fetch_add(1, std::memory_order_relaxed);
+            if (TaskIndex >= Batch.NumTasks)
+            {
+                break;
+            }
+            Batch.Function(Batch.Context, TaskIndex);
+            // The caller either dispatched the batch or holds it as a helper, so it is still alive after the last task
+            if (Batch.NumCompletedTasks.fetch_add(1, std::memory_order_acq_rel) + 1 == Batch.NumTasks)
+            {
+                Batch.NumCompletedTasks.notify_all();
+            }
+            bExecutedAny = true;
+        }
+        return bExecutedAny;
+    }
+
+    // Picks the oldest batch that still has unclaimed tasks, dropping exhausted batches from the queue.
+    // Must be called with the mutex held, the caller has to ReleaseBatch once it stops touching the batch
+    FJobBatch* AcquireBatch()
+    {
+        for (size64 Index = 0; Index < JobSystemState.PendingBatches.Num();)
+        {
+            FJobBatch* Batch = JobSystemState.PendingBatches[Index];
+            if (Batch->NextTask.load(std::memory_order_relaxed) < Batch->NumTasks)
+            {
+                Batch->NumHelpers.fetch_add(1, std::memory_order_relaxed);
+                return Batch;
+            }
+            JobSystemState.PendingBatches.RemoveAt(Index);
+        }
+        return nullptr;
+    }
+
+    void ReleaseBatch(FJobBatch& Batch)
+    {
+        // Nothing may touch the batch after this, it can already be gone
+        if (Batch.NumHelpers.fetch_sub(1, std::memory_order_seq_cst) == 1)
+        {
+            HelperReleaseEpoch.fetch_add(1, std::memory_order_seq_cst);
+            HelperReleaseEpoch.notify_all();
+        }
+    }
+
+    void WorkerMain(const uint32 ThreadIndex)
+    {
+        CurrentThreadIndex = ThreadIndex;
+        while (true)
+        {
+            FJobBatch* Batch = nullptr;
+            {
+                std::unique_lock Lock(JobSystemState.Mutex);
+                JobSystemState.WakeCondition.wait(Lock, [&Batch]()
+                {
+                    Batch = AcquireBatch();
+                    return Batch != nullptr || JobSystemState.bShuttingDown;
+                });
+                if (Batch == nullptr)
+                {
+                    return;
+                }
+            }
+            ExecuteBatchTasks(*Batch);
+            ReleaseBatch(*Batch);
+        }
+    }
+
+    bool8 HelpWithPendingBatch()
+    {
+        FJobBatch* Batch = nullptr;
+        {
+            std::scoped_lock Lock(JobSystemState.Mutex);
+            Batch = AcquireBatch();
+        }
+        if (Batch == nullptr)
+        {
+            return false;
+        }
+        const bool8 bExecutedAny = ExecuteBatchTasks(*Batch);
+        ReleaseBatch(*Batch);
+        return bExecutedAny;
+    }
+}
+
+void FJobSystem::Initialize(uint32 NumWorkers)
+{
+    if (IsInitialized())
+    {
+        return;
+    }
+    if (NumWorkers == 0)
+    {
+        const uint32 HardwareThreads = std::thread::hardware_concurrency();
+        NumWorkers = HardwareThreads > 1 ? HardwareThreads - 1 : 0;
+    }
+    JobSystemState.bShuttingDown = false;
+    JobSystemState.Workers.Reserve(NumWorkers);
+    for (uint32 Index = 0; Index < NumWorkers; ++Index)
+    {
+        JobSystemState.Workers.EmplaceBack(WorkerMain, Index + 1);
+    }
+    NumActiveWorkers.store(NumWorkers, std::memory_order_release);
+}
+
+void FJobSystem::Shutdown()
+{
+    {
+        std::scoped_lock Lock(JobSystemState.Mutex);
+        JobSystemState.bShuttingDown = true;
+    }
+    JobSystemState.WakeCondition.notify_all();
+    for (std::thread& Worker : JobSystemState.Workers)
+    {
+        Worker.join();
+    }
+    JobSystemState.Workers.Clear();
+    NumActiveWorkers.store(0, std::memory_order_release);
+}
+
+bool8 FJobSystem::IsInitialized()
+{
+    return NumActiveWorkers.load(std::memory_order_acquire) > 0;
+}
+
+uint32 FJobSystem::GetNumWorkers()
+{
+    return NumActiveWorkers.load(std::memory_order_acquire);
+}
+
+uint32 FJobSystem::GetNumThreads()
+{
+    return GetNumWorkers() + 1;
+}
+
+uint32 FJobSystem::GetCurrentThreadIndex()
+{
+    return CurrentThreadIndex;
+}
+
+void FJobSystem::Dispatch(const size64 NumTasks, const FJobTaskFunction Function, void* Context)
+{
+    if (NumTasks == 0)
+    {
+        return;
+    }
+    if (NumTasks == 1 || !IsInitialized())
+    {
+        for (size64 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+        {
+            Function(Context, TaskIndex);
+        }
+        return;
+    }
+
+    FJobBatch Batch;
+    Batch.Function = Function;
+    Batch.Context = Context;
+    Batch.NumTasks = NumTasks;
+    {
+        std::scoped_lock Lock(JobSystemState.Mutex);
+        JobSystemState.PendingBatches.PushBack(&Batch);
+    }
+    JobSystemState.WakeCondition.notify_all();
+
+    ExecuteBatchTasks(Batch);
+
+    // Tasks of this batch may still be running on workers, keep the thread busy with other batches meanwhile. Once
+    // there is nothing left to help with, block until the last task signals instead of spinning on the queue mutex
+    uint32 NumIdleSpins = 0;
+    while (true)
+    {
+        const size64 NumCompletedTasks = Batch.NumCompletedTasks.load(std::memory_order_acquire);
+        if (NumCompletedTasks == NumTasks)
+        {
+            break;
+        }
+        if (HelpWithPendingBatch())
+        {
+            NumIdleSpins = 0;
+        }
+        else if (++NumIdleSpins < MaxIdleSpins)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            Batch.NumCompletedTasks.wait(NumCompletedTasks, std::memory_order_acquire);
+        }
+    }
+
+    // The batch lives on this stack frame, so it has to leave the queue and every helper has to let go of it
+    {
+        std::scoped_lock Lock(JobSystemState.Mutex);
+        for (size64 Index = 0; Index < JobSystemState.PendingBatches.Num(); ++Index)
+        {
+            if (JobSystemState.PendingBatches[Index] == &Batch)
+            {
+                JobSystemState.PendingBatches.RemoveAt(Index);
+                break;
+            }
+        }
+    }
+    // Helpers only still hold it between failing to claim a task and releasing it, so this is usually short
+    for (uint32 NumSpins = 0; true; ++NumSpins)
+    {
+        const uint32 Epoch = HelperReleaseEpoch.load(std::memory_order_seq_cst);
+        if (Batch.NumHelpers.load(std::memory_order_seq_cst) == 0)
+        {
+            break;
+        }
+        if (NumSpins < MaxIdleSpins)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            HelperReleaseEpoch.wait(Epoch, std::memory_order_seq_cst);
+        }
+    }
+}
@@ -6,6 +6,9 @@
 #include "Core/Memory/Memory.hpp"
 
 #include <cassert>
+#include <functional>
+#include <memory>
+#include <span>
 #include <type_traits>
 
 template <typename TElement> requires std::is_object_v<TElement> && !std::is_abstract_v<TElement>
@@ -15,6 +18,9 @@ private:
     static constexpr size64 DefaultCapacity = 4;
     static constexpr size64 GrowthFactor = 2;
 
+    // Over aligned elements such as SIMD batches get their alignment, everything else the allocator default
+    static constexpr uint8 ElementAlignment = alignof(TElement) > 8 ? static_cast<uint8>(alignof(TElement)) : 8;
+
 public:
     using ValueType = TElement;
     using Iterator = TElement*;
@@ -27,10 +33,8 @@ public:
         if (InCount > 0)
         {
             Reserve(InCount);
-            for (size64 Index = 0; Index < InCount; ++Index)
-            {
-                EmplaceBack();
-            }
+            std::uninitialized_value_construct_n(Data, InCount);
+            Size = InCount;
         }
     }
 
@@ -39,35 +43,19 @@ public:
         if (InCount > 0)
         {
             Reserve(InCount);
-            for (size64 Index = 0; Index < InCount; ++Index)
-            {
-                EmplaceBack(InValue);
-            }
+            std::uninitialized_fill_n(Data, InCount, InValue);
+            Size = InCount;
         }
     }
 
     TArray(std::initializer_list<TElement> InInitializerList)
     {
-        if (InInitializerList.size() > 0)
-        {
-            Reserve(InInitializerList.size());
-            for (const auto& Element : InInitializerList)
-            {
-                EmplaceBack(Element);
-            }
-        }
+        Append(std::span<const TElement>(InInitializerList.begin(), InInitializerList.size()));
     }
 
     TArray(const TArray& Other)
     {
-        if (Other.Size > 0)
-        {
-            Reserve(Other.Size);
-            for (size64 Index = 0; Index < Other.Size; ++Index)
-            {
-                EmplaceBack(Other.Data[Index]);
-            }
-        }
+        Append(std::span<const TElement>(Other.Data, Other.Size));
     }
 
     TArray(TArray&& Other) noexcept
@@ -89,14 +77,7 @@ public:
         if (this != &Other)
         {
             Clear();
-            if (Other.Size > 0)
-            {
-                Reserve(Other.Size);
-                for (size64 Index = 0; Index < Other.Size; ++Index)
-                {
-                    EmplaceBack(Other.Data[Index]);
-                }
-            }
+            Append(std::span<const TElement>(Other.Data, Other.Size));
         }
         return *this;
     }
@@ -121,14 +102,7 @@ public:
     TArray& operator=(std::initializer_list<TElement> InInitializerList)
     {
         Clear();
-        if (InInitializerList.size() > 0)
-        {
-            Reserve(InInitializerList.size());
-            for (const auto& Element : InInitializerList)
-            {
-                EmplaceBack(Element);
-            }
-        }
+        Append(std::span<const TElement>(InInitializerList.begin(), InInitializerList.size()));
         return *this;
     }
 
@@ -173,7 +147,6 @@ public:
         return true;
     }
 
-public:
 public:
     [[nodiscard]] TElement& At(const size64 Index)
     {
@@ -232,19 +205,128 @@ public:
         EmplaceBack(std::move(InValue));
     }
 
+    // Arguments may reference elements of the array, growing constructs the element before releasing the old block
     template <typename... TArguments>
     TElement& EmplaceBack(TArguments&&... Arguments) requires std::is_constructible_v<TElement, TArguments...>
     {
-        if (Size >= Capacity)
+        if (Size == Capacity)
         {
-            const size64 NewCapacity = Capacity == 0 ? DefaultCapacity : Capacity * GrowthFactor;
-            Reserve(NewCapacity);
+            return EmplaceBackGrow(std::forward<TArguments>(Arguments)...);
         }
         TElement* NewElement = std::construct_at(&Data[Size], std::forward<TArguments>(Arguments)...);
         ++Size;
         return *NewElement;
     }
 
+    template <typename... TArguments>
+    TElement& EmplaceAt(const size64 Index, TArguments&&... Arguments) requires std::is_constructible_v<TElement, TArguments...>
+    {
+        assert(Index <= Size && "Array index is out of bounds");
+        if (Index == Size)
+        {
+            return EmplaceBack(std::forward<TArguments>(Arguments)...);
+        }
+        // Build the element before shifting so arguments referencing existing elements stay valid
+        TElement NewValue(std::forward<TArguments>(Arguments)...);
+        EnsureCapacity(Size + 1);
+        OpenGap(Index, 1);
+        TElement* NewElement = std::construct_at(&Data[Index], std::move(NewValue));
+        ++Size;
+        return *NewElement;
+    }
+
+    void Insert(const size64 Index, const TElement& InValue)
+    {
+        EmplaceAt(Index, InValue);
+    }
+
+    void Insert(const size64 Index, TElement&& InValue)
+    {
+        EmplaceAt(Index, std::move(InValue));
+    }
+
+    void Insert(const size64 Index, std::span<const TElement> Elements) requires std::is_copy_constructible_v<TElement>
+    {
+        assert(Index <= Size && "Array index is out of bounds");
+        assert(!IsAliasing(Elements) && "Cannot insert elements of an array into itself");
+        const size64 Count = Elements.size();
+        if (Count == 0)
+        {
+            return;
+        }
+        EnsureCapacity(Size + Count);
+        OpenGap(Index, Count);
+        CopyConstructElements(Elements.data(), &Data[Index], Count);
+        Size += Count;
+    }
+
+    void Append(std::span<const TElement> Elements) requires std::is_copy_constructible_v<TElement>
+    {
+        assert(!IsAliasing(Elements) && "Cannot append elements of an array to itself");
+        const size64 Count = Elements.size();
+        if (Count == 0)
+        {
+            return;
+        }
+        EnsureCapacity(Size + Count);
+        CopyConstructElements(Elements.data(), &Data[Size], Count);
+        Size += Count;
+    }
+
+    void Append(TArray&& Other)
+    {
+        if (this == &Other || Other.Size == 0)
+        {
+            return;
+        }
+        if (Size == 0 && Capacity <= Other.Capacity)
+        {
+            *this = std::move(Other);
+            return;
+        }
+        EnsureCapacity(Size + Other.Size);
+        RelocateElements(Other.Data, &Data[Size], Other.Size);
+        Size += Other.Size;
+        Other.Size = 0;
+    }
+
+    size64 AddUninitialized(const size64 Count = 1) requires std::is_trivially_default_constructible_v<TElement> && std::is_trivially_destructible_v<TElement>
+    {
+        const size64 FirstIndex = Size;
+        EnsureCapacity(Size + Count);
+        Size += Count;
+        return FirstIndex;
+    }
+
+    void RemoveAt(const size64 Index, const size64 Count = 1)
+    {
+        assert(Index + Count <= Size && "Array index is out of bounds");
+        if (Count == 0)
+        {
+            return;
+        }
+        std::destroy_n(&Data[Index], Count);
+        CloseGap(Index, Count);
+        Size -= Count;
+    }
+
+    void RemoveAtSwap(const size64 Index, const size64 Count = 1)
+    {
+        assert(Index + Count <= Size && "Array index is out of bounds");
+        if (Count == 0)
+        {
+            return;
+        }
+        std::destroy_n(&Data[Index], Count);
+        const size64 TailCount = Size - Index - Count;
+        const size64 NumToMove = TailCount < Count ? TailCount : Count;
+        if (NumToMove > 0)
+        {
+            RelocateElements(&Data[Size - NumToMove], &Data[Index], NumToMove);
+        }
+        Size -= Count;
+    }
+
     void PopBack()
     {
         assert(Size > 0 && "Cannot pop from empty array");
@@ -256,23 +338,11 @@ public:
     {
         if (NewCapacity > Capacity)
         {
-            TElement* NewData = static_cast<TElement*>(FMemory::Allocate(sizeof(TElement) * NewCapacity));
+            TElement* NewData = static_cast<TElement*>(FMemory::Allocate(sizeof(TElement) * NewCapacity, ElementAlignment));
             if (Data != nullptr)
             {
-                if constexpr (std::is_trivially_copyable_v<TElement>)
-                {
-                    FMemory::Copy(Data, NewData, Size * sizeof(TElement));
-                }
-                else
-                {
-                    for (size64 Index = 0; Index < Size; ++Index)
-                    {
-                        std::construct_at(&NewData[Index], std::move(Data[Index]));
-                        std::destroy_at(&Data[Index]);
-                    }
-                }
-
-                FMemory::Free(Data);
+                RelocateElements(Data, NewData, Size);
+                FMemory::Free(Data, ElementAlignment);
             }
             Data = NewData;
             Capacity = NewCapacity;
@@ -284,47 +354,37 @@ public:
         if (NewSize > Size)
         {
             Reserve(NewSize);
-            for (size64 Index = Size; Index < NewSize; ++Index)
-            {
-                std::construct_at(&Data[Index]);
-            }
+            std::uninitialized_value_construct_n(&Data[Size], NewSize - Size);
         }
         else if (NewSize < Size)
         {
-            for (size64 Index = NewSize; Index < Size; ++Index)
-            {
-                std::destroy_at(&Data[Index]);
-            }
+            std::destroy_n(&Data[NewSize], Size - NewSize);
         }
         Size = NewSize;
     }
 
+    // Grows without constructing the new elements, the caller is expected to overwrite them
+    void ResizeUninitialized(const size64 NewSize) requires std::is_trivially_default_constructible_v<TElement> && std::is_trivially_destructible_v<TElement>
+    {
+        Reserve(NewSize);
+        Size = NewSize;
+    }
+
     void ShrinkToFit()
     {
         if (Capacity > Size)
         {
             if (Size == 0)
             {
-                FMemory::Free(Data);
+                FMemory::Free(Data, ElementAlignment);
                 Data = nullptr;
                 Capacity = 0;
             }
             else
             {
-                TElement* NewData = static_cast<TElement*>(FMemory::Allocate(Size * sizeof(TElement)));
-                if constexpr (std::is_trivially_copyable_v<TElement>)
-                {
-                    FMemory::Copy(Data, NewData, Size * sizeof(TElement));
-                }
-                else
-                {
-                    for (size64 Index = 0; Index < Size; ++Index)
-                    {
-                        std::construct_at(&NewData[Index], std::move(Data[Index]));
-                        std::destroy_at(&Data[Index]);
-                    }
-                }
-                FMemory::Free(Data);
+                TElement* NewData = static_cast<TElement*>(FMemory::Allocate(Size * sizeof(TElement), ElementAlignment));
+                RelocateElements(Data, NewData, Size);
+                FMemory::Free(Data, ElementAlignment);
                 Data = NewData;
                 Capacity = Size;
             }
@@ -333,10 +393,7 @@ public:
 
     void Clear()
     {
-        for (size64 Index = 0; Index < Size; ++Index)
-        {
-            std::destroy_at(&Data[Index]);
-        }
+        std::destroy_n(Data, Size);
         Size = 0;
     }
 
@@ -399,15 +456,109 @@ public:
     }
 
 private:
-    void DestroyAndDeallocate()
+    template <typename... TArguments>
+    TElement& EmplaceBackGrow(TArguments&&... Arguments)
     {
+        const size64 NewCapacity = Capacity == 0 ? DefaultCapacity : Capacity * GrowthFactor;
+        TElement* NewData = static_cast<TElement*>(FMemory::Allocate(sizeof(TElement) * NewCapacity, ElementAlignment));
+        TElement* NewElement = std::construct_at(&NewData[Size], std::forward<TArguments>(Arguments)...);
         if (Data != nullptr)
         {
-            for (size64 Index = 0; Index < Size; ++Index)
+            RelocateElements(Data, NewData, Size);
+            FMemory::Free(Data, ElementAlignment);
+        }
+        Data = NewData;
+        Capacity = NewCapacity;
+        ++Size;
+        return *NewElement;
+    }
+
+    void EnsureCapacity(const size64 RequiredCapacity)
+    {
+        if (RequiredCapacity > Capacity)
+        {
+            const size64 GrownCapacity = Capacity == 0 ? DefaultCapacity : Capacity * GrowthFactor;
+            Reserve(GrownCapacity > RequiredCapacity ? GrownCapacity : RequiredCapacity);
+        }
+    }
+
+    [[nodiscard]] bool8 IsAliasing(std::span<const TElement> Elements) const noexcept
+    {
+        // std::less gives a total order over unrelated pointers, the built in operators do not
+        constexpr std::less<const TElement*> Less;
+        return !Elements.empty() && Less(Elements.data(), Data + Capacity) && Less(Data, Elements.data() + Elements.size());
+    }
+
+    // Copy-constructs Count elements into uninitialized, non-overlapping storage
+    static void CopyConstructElements(const TElement* Source, TElement* Target, const size64 Count)
+    {
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            FMemory::Copy(Source, Target, Count * sizeof(TElement));
+        }
+        else
+        {
+            std::uninitialized_copy_n(Source, Count, Target);
+        }
+    }
+
+    // Moves Count elements into uninitialized, non-overlapping storage and destroys the sources
+    static void RelocateElements(TElement* Source, TElement* Target, const size64 Count)
+    {
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            FMemory::Copy(Source, Target, Count * sizeof(TElement));
+        }
+        else
+        {
+            for (size64 Index = 0; Index < Count; ++Index)
+            {
+                std::construct_at(&Target[Index], std::move(Source[Index]));
+                std::destroy_at(&Source[Index]);
+            }
+        }
+    }
+
+    // Shifts [Index, Size) up by Count, leaving [Index, Index + Count) uninitialized. Capacity must already fit
+    void OpenGap(const size64 Index, const size64 Count)
+    {
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            FMemory::Move(&Data[Index], &Data[Index + Count], (Size - Index) * sizeof(TElement));
+        }
+        else
+        {
+            for (size64 SourceIndex = Size; SourceIndex > Index; --SourceIndex)
             {
-                std::destroy_at(&Data[Index]);
+                std::construct_at(&Data[SourceIndex - 1 + Count], std::move(Data[SourceIndex - 1]));
+                std::destroy_at(&Data[SourceIndex - 1]);
             }
-            FMemory::Free(Data);
+        }
+    }
+
+    // Shifts [Index + Count, Size) down onto the already destroyed range [Index, Index + Count)
+    void CloseGap(const size64 Index, const size64 Count)
+    {
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            FMemory::Move(&Data[Index + Count], &Data[Index], (Size - Index - Count) * sizeof(TElement));
+        }
+        else
+        {
+            for (size64 SourceIndex = Index + Count; SourceIndex < Size; ++SourceIndex)
+            {
+                std::construct_at(&Data[SourceIndex - Count], std::move(Data[SourceIndex]));
+                std::destroy_at(&Data[SourceIndex]);
+            }
+        }
+    }
+
+    void DestroyAndDeallocate()
+    {
+        if (Data != nullptr)
+        {
+            std::destroy_n(Data, Size);
+            FMemory::Free(Data, ElementAlignment);
             Data = nullptr;
         }
         Size = 0;
@@ -0,0 +1,770 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/BitArrayVectorized.hpp"
+#include "Core/Hash/Hash.hpp"
+
+namespace BitArray
+{
+    static constexpr size64 BitsPerWord = 64;
+
+    // Returned by the searches when no bit qualifies
+    static constexpr size64 NotFound = static_cast<size64>(-1);
+
+    namespace Private
+    {
+        // Below this many words the call into the vectorized kernels costs more than the inline loop
+        static constexpr size64 VectorizationThreshold = 8;
+
+        enum class EWordOperation : uint8
+        {
+            And,
+            Or,
+            Xor,
+            AndNot
+        };
+
+        [[nodiscard]] constexpr size64 GetNumWords(const size64 NumBits) noexcept
+        {
+            return (NumBits + BitsPerWord - 1) / BitsPerWord;
+        }
+
+        // The bits of the last word that lie inside the array, the others are kept zero
+        [[nodiscard]] constexpr uint64 GetLastWordMask(const size64 NumBits) noexcept
+        {
+            return NumBits % BitsPerWord == 0 ? ~uint64(0) : (uint64(1) << (NumBits % BitsPerWord)) - 1;
+        }
+
+        [[nodiscard]] constexpr size64 CountSetBits(const uint64* Words, const size64 NumWords)
+        {
+            if (!std::is_constant_evaluated() && NumWords >= VectorizationThreshold)
+            {
+                return Vectorized::CountSetBits(Words, NumWords);
+            }
+            size64 Count = 0;
+            for (size64 Index = 0; Index < NumWords; ++Index)
+            {
+                Count += static_cast<size64>(std::popcount(Words[Index]));
+            }
+            return Count;
+        }
+
+        [[nodiscard]] constexpr size64 FindNonZeroWord(const uint64* Words, const size64 Start, const size64 NumWords)
+        {
+            if (!std::is_constant_evaluated() && Start + VectorizationThreshold <= NumWords)
+            {
+                return Vectorized::FindNonZeroWord(Words, Start, NumWords);
+            }
+            size64 Index = Start;
+            while (Index < NumWords && Words[Index] == 0)
+            {
+                ++Index;
+            }
+            return Index;
+        }
+
+        template <EWordOperation Operation>
+        constexpr void ApplyWords(uint64* Destination, const uint64* Source, const size64 NumWords)
+        {
+            if (!std::is_constant_evaluated() && NumWords >= VectorizationThreshold)
+            {
+                if constexpr (Operation == EWordOperation::And)
+                {
+                    Vectorized::And(Destination, Source, NumWords);
+                }
+                else if constexpr (Operation == EWordOperation::Or)
+                {
+                    Vectorized::Or(Destination, Source, NumWords);
+                }
+                else if constexpr (Operation == EWordOperation::Xor)
+                {
+                    Vectorized::Xor(Destination, Source, NumWords);
+                }
+                else
+                {
+                    Vectorized::AndNot(Destination, Source, NumWords);
+                }
+                return;
+            }
+            for (size64 Index = 0; Index < NumWords; ++Index)
+            {
+                if constexpr (Operation == EWordOperation::And)
+                {
+                    Destination[Index] &= Source[Index];
+                }
+                else if constexpr (Operation == EWordOperation::Or)
+                {
+                    Destination[Index] |= Source[Index];
+                }
+                else if constexpr (Operation == EWordOperation::Xor)
+                {
+                    Destination[Index] ^= Source[Index];
+                }
+                else
+                {
+                    Destination[Index] &= ~Source[Index];
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr bool8 ContainsAll(const uint64* Words, const uint64* OtherWords, const size64 NumWords)
+        {
+            for (size64 Index = 0; Index < NumWords; ++Index)
+            {
+                if ((Words[Index] & OtherWords[Index]) != OtherWords[Index])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        [[nodiscard]] constexpr bool8 ContainsAny(const uint64* Words, const uint64* OtherWords, const size64 NumWords)
+        {
+            for (size64 Index = 0; Index < NumWords; ++Index)
+            {
+                if ((Words[Index] & OtherWords[Index]) != 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] constexpr size64 FindSetBit(const uint64* Words, const size64 NumWords, const size64 Start)
+        {
+            size64 WordIndex = Start / BitsPerWord;
+            if (WordIndex >= NumWords)
+            {
+                return NotFound;
+            }
+            const uint64 FirstWord = Words[WordIndex] & (~uint64(0) << (Start % BitsPerWord));
+            if (FirstWord != 0)
+            {
+                return WordIndex * BitsPerWord + static_cast<size64>(std::countr_zero(FirstWord));
+            }
+            WordIndex = FindNonZeroWord(Words, WordIndex + 1, NumWords);
+            return WordIndex < NumWords ? WordIndex * BitsPerWord + static_cast<size64>(std::countr_zero(Words[WordIndex])) : NotFound;
+        }
+
+        [[nodiscard]] constexpr size64 FindUnsetBit(const uint64* Words, const size64 NumBits, const size64 Start)
+        {
+            const size64 NumWords = GetNumWords(NumBits);
+            for (size64 WordIndex = Start / BitsPerWord; WordIndex < NumWords; ++WordIndex)
+            {
+                uint64 Unset = ~Words[WordIndex];
+                if (WordIndex == Start / BitsPerWord)
+                {
+                    Unset &= ~uint64(0) << (Start % BitsPerWord);
+                }
+                if (Unset != 0)
+                {
+                    // The unused bits of the last word read as unset
+                    const size64 Index = WordIndex * BitsPerWord + static_cast<size64>(std::countr_zero(Unset));
+                    return Index < NumBits ? Index : NotFound;
+                }
+            }
+            return NotFound;
+        }
+
+        // Walks the set bits of every word with tzcnt, dense arrays never leave the loop while runs of empty words
+        // go to the vectorized scan
+        template <typename TFunction>
+        constexpr void ForEachSetBit(const uint64* Words, const size64 NumWords, const TFunction& Function)
+        {
+            size64 WordIndex = FindNonZeroWord(Words, 0, NumWords);
+            while (WordIndex < NumWords)
+            {
+                uint64 Word = Words[WordIndex];
+                do
+                {
+                    Function(WordIndex * BitsPerWord + static_cast<size64>(std::countr_zero(Word)));
+                    Word &= Word - 1;
+                }
+                while (Word != 0);
+                ++WordIndex;
+                if (WordIndex < NumWords && Words[WordIndex] == 0)
+                {
+                    WordIndex = FindNonZeroWord(Words, WordIndex, NumWords);
+                }
+            }
+        }
+    }
+
+    // Forward iterator over the indices of the set bits, in ascending order
+    class FSetBitIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = size64;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const size64*;
+        using reference = size64;
+
+    public:
+        constexpr FSetBitIterator() = default;
+
+        constexpr FSetBitIterator(const uint64* InWords, const size64 InNumWords, const size64 InWordIndex)
+            : Words(InWords), NumWords(InNumWords), WordIndex(Private::FindNonZeroWord(InWords, InWordIndex, InNumWords)),
+              CurrentWord(WordIndex < InNumWords ? InWords[WordIndex] : 0)
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr size64 operator*() const
+        {
+            assert(CurrentWord != 0 && "Cannot dereference end iterator");
+            return WordIndex * BitsPerWord + static_cast<size64>(std::countr_zero(CurrentWord));
+        }
+
+        constexpr FSetBitIterator& operator++()
+        {
+            assert(CurrentWord != 0 && "Cannot increment end iterator");
+            CurrentWord &= CurrentWord - 1;
+            if (CurrentWord == 0)
+            {
+                WordIndex = Private::FindNonZeroWord(Words, WordIndex + 1, NumWords);
+                CurrentWord = WordIndex < NumWords ? Words[WordIndex] : 0;
+            }
+            return *this;
+        }
+
+        constexpr FSetBitIterator operator++(int)
+        {
+            FSetBitIterator Temp = *this;
+            ++(*this);
+            return Temp;
+        }
+
+        constexpr bool8 operator==(const FSetBitIterator& Other) const noexcept
+        {
+            return WordIndex == Other.WordIndex && CurrentWord == Other.CurrentWord;
+        }
+
+    private:
+        const uint64* Words = nullptr;
+        size64 NumWords = 0;
+        size64 WordIndex = 0;
+
+        // What is left of the word at WordIndex, the bits already visited are cleared
+        uint64 CurrentWord = 0;
+    };
+
+    class FSetBitRange
+    {
+    public:
+        constexpr FSetBitRange(const uint64* InWords, const size64 InNumWords)
+            : Words(InWords), NumWords(InNumWords)
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr FSetBitIterator begin() const
+        {
+            return FSetBitIterator(Words, NumWords, 0);
+        }
+
+        [[nodiscard]] constexpr FSetBitIterator end() const
+        {
+            return FSetBitIterator(Words, NumWords, NumWords);
+        }
+
+    private:
+        const uint64* Words;
+        size64 NumWords;
+    };
+}
+
+// Fixed size packed bit array, for masks whose size is known at compile time like component signatures. Bits
+// past TNumBits in the last word are always zero. Everything is constexpr, bulk operations on large arrays go to
+// the vectorized kernels at run time
+template <size64 TNumBits> requires (TNumBits > 0)
+class TStaticBitArray
+{
+    static constexpr size64 NumWords = BitArray::Private::GetNumWords(TNumBits);
+    static constexpr uint64 LastWordMask = BitArray::Private::GetLastWordMask(TNumBits);
+
+public:
+    constexpr TStaticBitArray() = default;
+
+    constexpr explicit TStaticBitArray(const bool8 bValue)
+    {
+        if (bValue)
+        {
+            SetAll();
+        }
+    }
+
+    // Sets the bits at the given indices
+    constexpr TStaticBitArray(std::initializer_list<size64> InSetBits)
+    {
+        for (const size64 Index : InSetBits)
+        {
+            Set(Index);
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr bool8 operator[](const size64 Index) const
+    {
+        return Test(Index);
+    }
+
+    constexpr bool8 operator==(const TStaticBitArray& Other) const = default;
+
+    constexpr TStaticBitArray& operator&=(const TStaticBitArray& Other)
+    {
+        BitArray::Private::ApplyWords<BitArray::Private::EWordOperation::And>(Words, Other.Words, NumWords);
+        return *this;
+    }
+
+    constexpr TStaticBitArray& operator|=(const TStaticBitArray& Other)
+    {
+        BitArray::Private::ApplyWords<BitArray::Private::EWordOperation::Or>(Words, Other.Words, NumWords);
+        return *this;
+    }
+
+    constexpr TStaticBitArray& operator^=(const TStaticBitArray& Other)
+    {
+        BitArray::Private::ApplyWords<BitArray::Private::EWordOperation::Xor>(Words, Other.Words, NumWords);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr TStaticBitArray operator&(const TStaticBitArray& Other) const
+    {
+        TStaticBitArray Result(*this);
+        return Result &= Other;
+    }
+
+    [[nodiscard]] constexpr TStaticBitArray operator|(const TStaticBitArray& Other) const
+    {
+        TStaticBitArray Result(*this);
+        return Result |= Other;
+    }
+
+    [[nodiscard]] constexpr TStaticBitArray operator^(const TStaticBitArray& Other) const
+    {
+        TStaticBitArray Result(*this);
+        return Result ^= Other;
+    }
+
+    [[nodiscard]] constexpr TStaticBitArray operator~() const
+    {
+        TStaticBitArray Result(*this);
+        Result.FlipAll();
+        return Result;
+    }
+
+public:
+    [[nodiscard]] constexpr bool8 Test(const size64 Index) const
+    {
+        assert(Index < TNumBits && "Bit index is out of bounds");
+        return (Words[Index / BitArray::BitsPerWord] >> (Index % BitArray::BitsPerWord) & 1) != 0;
+    }
+
+    constexpr void Set(const size64 Index)
+    {
+        assert(Index < TNumBits && "Bit index is out of bounds");
+        Words[Index / BitArray::BitsPerWord] |= uint64(1) << (Index % BitArray::BitsPerWord);
+    }
+
+    constexpr void Set(const size64 Index, const bool8 bValue)
+    {
+        bValue ? Set(Index) : Reset(Index);
+    }
+
+    constexpr void Reset(const size64 Index)
+    {
+        assert(Index < TNumBits && "Bit index is out of bounds");
+        Words[Index / BitArray::BitsPerWord] &= ~(uint64(1) << (Index % BitArray::BitsPerWord));
+    }
+
+    constexpr void Flip(const size64 Index)
+    {
+        assert(Index < TNumBits && "Bit index is out of bounds");
+        Words[Index / BitArray::BitsPerWord] ^= uint64(1) << (Index % BitArray::BitsPerWord);
+    }
+
+    constexpr void SetAll()
+    {
+        for (uint64& Word : Words)
+        {
+            Word = ~uint64(0);
+        }
+        Words[NumWords - 1] &= LastWordMask;
+    }
+
+    constexpr void ResetAll()
+    {
+        for (uint64& Word : Words)
+        {
+            Word = 0;
+        }
+    }
+
+    constexpr void FlipAll()
+    {
+        for (uint64& Word : Words)
+        {
+            Word = ~Word;
+        }
+        Words[NumWords - 1] &= LastWordMask;
+    }
+
+    // Clears every bit that is set in Other
+    constexpr void AndNot(const TStaticBitArray& Other)
+    {
+        BitArray::Private::ApplyWords<BitArray::Private::EWordOperation::AndNot>(Words, Other.Words, NumWords);
+    }
+
+public:
+    [[nodiscard]] constexpr size64 CountSetBits() const
+    {
+        return BitArray::Private::CountSetBits(Words, NumWords);
+    }
+
+    [[nodiscard]] constexpr bool8 AnySet() const
+    {
+        return BitArray::Private::FindNonZeroWord(Words, 0, NumWords) < NumWords;
+    }
+
+    [[nodiscard]] constexpr bool8 AllSet() const
+    {
+        return FindUnsetBit() == BitArray::NotFound;
+    }
+
+    // Whether every bit set in Other is also set here
+    [[nodiscard]] constexpr bool8 ContainsAll(const TStaticBitArray& Other) const
+    {
+        return BitArray::Private::ContainsAll(Words, Other.Words, NumWords);
+    }
+
+    [[nodiscard]] constexpr bool8 ContainsAny(const TStaticBitArray& Other) const
+    {
+        return BitArray::Private::ContainsAny(Words, Other.Words, NumWords);
+    }
+
+    // Index of the first set bit at or after Start, BitArray::NotFound if there is none
+    [[nodiscard]] constexpr size64 FindSetBit(const size64 Start = 0) const
+    {
+        return BitArray::Private::FindSetBit(Words, NumWords, Start);
+    }
+
+    [[nodiscard]] constexpr size64 FindUnsetBit(const size64 Start = 0) const
+    {
+        return BitArray::Private::FindUnsetBit(Words, TNumBits, Start);
+    }
+
+    // Calls Function(size64) with the index of every set bit in ascending order
+    template <typename TFunction>
+    constexpr void ForEachSetBit(const TFunction& Function) const
+    {
+        BitArray::Private::ForEachSetBit(Words, NumWords, Function);
+    }
+
+    // The indices of the set bits as a range, for range based for loops
+    [[nodiscard]] constexpr BitArray::FSetBitRange GetSetBits() const
+    {
+        return BitArray::FSetBitRange(Words, NumWords);
+    }
+
+    [[nodiscard]] constexpr size64 GetHash() const
+    {
+        uint64 Result = 0;
+        for (const uint64 Word : Words)
+        {
+            Result = Hash::Combine(Result, Word);
+        }
+        return static_cast<size64>(Result);
+    }
+
+public:
+    [[nodiscard]] static constexpr size64 Num() noexcept
+    {
+        return TNumBits;
+    }
+
+    [[nodiscard]] static constexpr size64 GetNumWords() noexcept
+    {
+        return NumWords;
+    }
+
+    [[nodiscard]] constexpr const uint64* GetWords() const noexcept
+    {
+        return Words;
+    }
+
+private:
+    uint64 Words[NumWords] = {};
+};
+
+// Resizable packed bit array on a TArray of words, for masks sized at run time like visibility or occupancy over
+// all entities. Bits past Num() in the last word are always zero. Binary operations require equal sizes
+class TBitArray
+{
+public:
+    TBitArray() = default;
+
+    explicit TBitArray(const size64 InNumBits, const bool8 bValue = false)
+        : Words(BitArray::Private::GetNumWords(InNumBits), bValue ? ~uint64(0) : uint64(0)), NumBits(InNumBits)
+    {
+        ClearUnusedBits();
+    }
+
+public:
+    [[nodiscard]] bool8 operator[](const size64 Index) const
+    {
+        return Test(Index);
+    }
+
+    [[nodiscard]] bool8 operator==(const TBitArray& Other) const
+    {
+        return NumBits == Other.NumBits && Words == Other.Words;
+    }
+
+    TBitArray& operator&=(const TBitArray& Other)
+    {
+        assert(NumBits == Other.NumBits && "Bit arrays differ in size");
+        BitArray::Private::ApplyWords<BitArray::Private::EWordOperation::And>(Words.GetData(), Other.Words.GetData(), Words.Num());
+        return *this;
+    }
+
+    TBitArray& operator|=(const TBitArray& Other)
+    {
+        assert(NumBits == Other.NumBits && "Bit arrays differ in size");
+        BitArray::Private::ApplyWords<BitArray::Private::EWordOperation::Or>(Words.GetData(), Other.Words.GetData(), Words.Num());
+        return *this;
+    }
+
+    TBitArray& operator^=(const TBitArray& Other)
+    {
+        assert(NumBits == Other.NumBits && "Bit arrays differ in size");
+        BitArray::Private::ApplyWords<BitArray::Private::EWordOperation::Xor>(Words.GetData(), Other.Words.GetData(), Words.Num());
+        return *this;
+    }
+
+    [[nodiscard]] TBitArray operator&(const TBitArray& Other) const
+    {
+        TBitArray Result(*this);
+        Result &= Other;
+        return Result;
+    }
+
+    [[nodiscard]] TBitArray operator|(const TBitArray& Other) const
+    {
+        TBitArray Result(*this);
+        Result |= Other;
+        return Result;
+    }
+
+    [[nodiscard]] TBitArray operator^(const TBitArray& Other) const
+    {
+        TBitArray Result(*this);
+        Result ^= Other;
+        return Result;
+    }
+
+    [[nodiscard]] TBitArray operator~() const
+    {
+        TBitArray Result(*this);
+        Result.FlipAll();
+        return Result;
+    }
+
+public:
+    [[nodiscard]] bool8 Test(const size64 Index) const
+    {
+        assert(Index < NumBits && "Bit index is out of bounds");
+        return (Words[Index / BitArray::BitsPerWord] >> (Index % BitArray::BitsPerWord) & 1) != 0;
+    }
+
+    void Set(const size64 Index)
+    {
+        assert(Index < NumBits && "Bit index is out of bounds");
+        Words[Index / BitArray::BitsPerWord] |= uint64(1) << (Index % BitArray::BitsPerWord);
+    }
+
+    void Set(const size64 Index, const bool8 bValue)
+    {
+        bValue ? Set(Index) : Reset(Index);
+    }
+
+    void Reset(const size64 Index)
+    {
+        assert(Index < NumBits && "Bit index is out of bounds");
+        Words[Index / BitArray::BitsPerWord] &= ~(uint64(1) << (Index % BitArray::BitsPerWord));
+    }
+
+    void Flip(const size64 Index)
+    {
+        assert(Index < NumBits && "Bit index is out of bounds");
+        Words[Index / BitArray::BitsPerWord] ^= uint64(1) << (Index % BitArray::BitsPerWord);
+    }
+
+    void SetAll()
+    {
+        FMemory::Set(Words.GetData(), 0xFF, Words.Num() * sizeof(uint64));
+        ClearUnusedBits();
+    }
+
+    void ResetAll()
+    {
+        FMemory::Set(Words.GetData(), 0, Words.Num() * sizeof(uint64));
+    }
+
+    void FlipAll()
+    {
+        for (uint64& Word : Words)
+        {
+            Word = ~Word;
+        }
+        ClearUnusedBits();
+    }
+
+    // Clears every bit that is set in Other
+    void AndNot(const TBitArray& Other)
+    {
+        assert(NumBits == Other.NumBits && "Bit arrays differ in size");
+        BitArray::Private::ApplyWords<BitArray::Private::EWordOperation::AndNot>(Words.GetData(), Other.Words.GetData(), Words.Num());
+    }
+
+    void PushBack(const bool8 bValue)
+    {
+        if (NumBits % BitArray::BitsPerWord == 0)
+        {
+            Words.PushBack(0);
+        }
+        ++NumBits;
+        Set(NumBits - 1, bValue);
+    }
+
+    // New bits take bValue
+    void Resize(const size64 NewNumBits, const bool8 bValue = false)
+    {
+        const size64 OldNumBits = NumBits;
+        const size64 OldNumWords = Words.Num();
+        Words.Resize(BitArray::Private::GetNumWords(NewNumBits));
+        NumBits = NewNumBits;
+        if (bValue && NewNumBits > OldNumBits)
+        {
+            // The rest of the old last word, then whole words
+            if (OldNumBits % BitArray::BitsPerWord != 0)
+            {
+                Words[OldNumWords - 1] |= ~BitArray::Private::GetLastWordMask(OldNumBits);
+            }
+            FMemory::Set(Words.GetData() + OldNumWords, 0xFF, (Words.Num() - OldNumWords) * sizeof(uint64));
+        }
+        ClearUnusedBits();
+    }
+
+    void Reserve(const size64 InNumBits)
+    {
+        Words.Reserve(BitArray::Private::GetNumWords(InNumBits));
+    }
+
+    void Clear()
+    {
+        Words.Clear();
+        NumBits = 0;
+    }
+
+public:
+    [[nodiscard]] size64 CountSetBits() const
+    {
+        return BitArray::Private::CountSetBits(Words.GetData(), Words.Num());
+    }
+
+    [[nodiscard]] bool8 AnySet() const
+    {
+        return BitArray::Private::FindNonZeroWord(Words.GetData(), 0, Words.Num()) < Words.Num();
+    }
+
+    [[nodiscard]] bool8 AllSet() const
+    {
+        return FindUnsetBit() == BitArray::NotFound;
+    }
+
+    // Whether every bit set in Other is also set here
+    [[nodiscard]] bool8 ContainsAll(const TBitArray& Other) const
+    {
+        assert(NumBits == Other.NumBits && "Bit arrays differ in size");
+        return BitArray::Private::ContainsAll(Words.GetData(), Other.Words.GetData(), Words.Num());
+    }
+
+    [[nodiscard]] bool8 ContainsAny(const TBitArray& Other) const
+    {
+        assert(NumBits == Other.NumBits && "Bit arrays differ in size");
+        return BitArray::Private::ContainsAny(Words.GetData(), Other.Words.GetData(), Words.Num());
+    }
+
+    // Index of the first set bit at or after Start, BitArray::NotFound if there is none
+    [[nodiscard]] size64 FindSetBit(const size64 Start = 0) const
+    {
+        return BitArray::Private::FindSetBit(Words.GetData(), Words.Num(), Start);
+    }
+
+    [[nodiscard]] size64 FindUnsetBit(const size64 Start = 0) const
+    {
+        return BitArray::Private::FindUnsetBit(Words.GetData(), NumBits, Start);
+    }
+
+    // Calls Function(size64) with the index of every set bit in ascending order
+    template <typename TFunction>
+    void ForEachSetBit(const TFunction& Function) const
+    {
+        BitArray::Private::ForEachSetBit(Words.GetData(), Words.Num(), Function);
+    }
+
+    // The indices of the set bits as a range, for range based for loops
+    [[nodiscard]] BitArray::FSetBitRange GetSetBits() const
+    {
+        return BitArray::FSetBitRange(Words.GetData(), Words.Num());
+    }
+
+    [[nodiscard]] size64 GetHash() const
+    {
+        return static_cast<size64>(Hash::HashBytes(Words.GetData(), Words.Num() * sizeof(uint64), NumBits));
+    }
+
+public:
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return NumBits;
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return NumBits == 0;
+    }
+
+    [[nodiscard]] size64 GetNumWords() const noexcept
+    {
+        return Words.Num();
+    }
+
+    [[nodiscard]] const uint64* GetWords() const noexcept
+    {
+        return Words.GetData();
+    }
+
+private:
+    void ClearUnusedBits()
+    {
+        if (NumBits % BitArray::BitsPerWord != 0)
+        {
+            Words[Words.Num() - 1] &= BitArray::Private::GetLastWordMask(NumBits);
+        }
+    }
+
+private:
+    TArray<uint64> Words;
+    size64 NumBits = 0;
+};
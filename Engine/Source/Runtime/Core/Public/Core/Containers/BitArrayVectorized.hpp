@@ -0,0 +1,21 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+// Vectorized kernels behind TBitArray and TStaticBitArray, working on whole 64 bit words. Selected at runtime
+// between AVX2, SSE2 and scalar code depending on the host CPU. Population counts use the AVX2 nibble lookup
+// where available and the POPCNT instruction otherwise
+namespace BitArray::Vectorized
+{
+    CORE_API size64 CountSetBits(const uint64* Words, size64 NumWords);
+
+    CORE_API void And(uint64* Destination, const uint64* Source, size64 NumWords);
+    CORE_API void Or(uint64* Destination, const uint64* Source, size64 NumWords);
+    CORE_API void Xor(uint64* Destination, const uint64* Source, size64 NumWords);
+
+    // Destination &= ~Source
+    CORE_API void AndNot(uint64* Destination, const uint64* Source, size64 NumWords);
+
+    // Index of the first word at or after Start that is not zero, NumWords if there is none
+    CORE_API size64 FindNonZeroWord(const uint64* Words, size64 Start, size64 NumWords);
+}
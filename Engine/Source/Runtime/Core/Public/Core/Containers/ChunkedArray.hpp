@@ -0,0 +1,439 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Memory/Memory.hpp"
+
+namespace ChunkedArray::Private
+{
+    static constexpr size64 DefaultChunkSizeInBytes = 16 * 1024;
+
+    // As many elements as fit a 16 KiB chunk, rounded down to a power of two and at least one
+    template <typename TElement>
+    static constexpr size64 DefaultElementsPerChunk = sizeof(TElement) >= DefaultChunkSizeInBytes ? 1 : std::bit_floor(DefaultChunkSizeInBytes / sizeof(TElement));
+}
+
+// Array that grows by appending fixed size chunks instead of reallocating, so elements never move and pointers to
+// them stay valid until they are popped or the array is cleared. Chunks start on a cache line. Indexing is a shift
+// and a mask into the chunk table, and ForEachChunk hands out the contiguous runs for loops the compiler can
+// vectorize. Growing only reallocates the table of chunk pointers
+template <typename TElement, size64 TElementsPerChunk = ChunkedArray::Private::DefaultElementsPerChunk<TElement>>
+    requires std::is_object_v<TElement> && (!std::is_abstract_v<TElement>) && (std::has_single_bit(TElementsPerChunk))
+class TChunkedArray
+{
+private:
+    static constexpr uint32 ChunkShift = static_cast<uint32>(std::countr_zero(TElementsPerChunk));
+    static constexpr size64 ChunkMask = TElementsPerChunk - 1;
+    static constexpr uint8 ChunkAlignment = alignof(TElement) > 64 ? static_cast<uint8>(alignof(TElement)) : 64;
+
+    // Walks the elements of one chunk by pointer and only goes back to the chunk table at its end
+    template <typename TElementPointer>
+    class TChunkedArrayIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TElement;
+        using difference_type = ptrdiff_t;
+        using pointer = TElementPointer;
+        using reference = std::remove_pointer_t<TElementPointer>&;
+
+    public:
+        constexpr TChunkedArrayIterator() = default;
+
+        constexpr TChunkedArrayIterator(TElementPointer InElement, TElement* const* InChunk, TElement* const* InLastChunk) noexcept
+            : Element(InElement), ChunkEnd(InChunk != nullptr ? *InChunk + TElementsPerChunk : nullptr), Chunk(InChunk), LastChunk(InLastChunk)
+        {
+        }
+
+        template <typename TOtherElementPointer>
+        constexpr TChunkedArrayIterator(const TChunkedArrayIterator<TOtherElementPointer>& Other) noexcept
+            requires std::convertible_to<TOtherElementPointer, TElementPointer>
+            : Element(Other.Element), ChunkEnd(Other.ChunkEnd), Chunk(Other.Chunk), LastChunk(Other.LastChunk)
+        {
+        }
+
+    public:
+        constexpr reference operator*() const
+        {
+            return *Element;
+        }
+
+        constexpr pointer operator->() const
+        {
+            return Element;
+        }
+
+        constexpr TChunkedArrayIterator& operator++()
+        {
+            // The end of the last chunk is the end of a full array, it stays there
+            if (++Element == ChunkEnd && Chunk != LastChunk)
+            {
+                ++Chunk;
+                Element = *Chunk;
+                ChunkEnd = Element + TElementsPerChunk;
+            }
+            return *this;
+        }
+
+        constexpr TChunkedArrayIterator operator++(int)
+        {
+            TChunkedArrayIterator Temp = *this;
+            ++(*this);
+            return Temp;
+        }
+
+        constexpr bool8 operator==(const TChunkedArrayIterator& Other) const noexcept
+        {
+            return Element == Other.Element;
+        }
+
+    private:
+        TElementPointer Element = nullptr;
+        TElementPointer ChunkEnd = nullptr;
+        TElement* const* Chunk = nullptr;
+        TElement* const* LastChunk = nullptr;
+
+        template <typename>
+        friend class TChunkedArrayIterator;
+    };
+
+public:
+    using ValueType = TElement;
+    using Iterator = TChunkedArrayIterator<TElement*>;
+    using ConstIterator = TChunkedArrayIterator<const TElement*>;
+
+    static constexpr size64 ElementsPerChunk = TElementsPerChunk;
+
+public:
+    TChunkedArray() = default;
+
+    TChunkedArray(std::initializer_list<TElement> InInitializerList)
+    {
+        Reserve(InInitializerList.size());
+        for (const TElement& Element : InInitializerList)
+        {
+            PushBack(Element);
+        }
+    }
+
+    TChunkedArray(const TChunkedArray& Other)
+    {
+        AppendCopies(Other);
+    }
+
+    TChunkedArray(TChunkedArray&& Other) noexcept
+        : Chunks(std::move(Other.Chunks)), Size(Other.Size)
+    {
+        Other.Size = 0;
+    }
+
+    ~TChunkedArray()
+    {
+        DestroyAndDeallocate();
+    }
+
+public:
+    TChunkedArray& operator=(const TChunkedArray& Other)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            AppendCopies(Other);
+        }
+        return *this;
+    }
+
+    TChunkedArray& operator=(TChunkedArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAndDeallocate();
+            Chunks = std::move(Other.Chunks);
+            Size = Other.Size;
+            Other.Size = 0;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] TElement& operator[](const size64 Index)
+    {
+        assert(Index < Size && "Chunked array index is out of bounds");
+        return Chunks[Index >> ChunkShift][Index & ChunkMask];
+    }
+
+    [[nodiscard]] const TElement& operator[](const size64 Index) const
+    {
+        assert(Index < Size && "Chunked array index is out of bounds");
+        return Chunks[Index >> ChunkShift][Index & ChunkMask];
+    }
+
+    bool8 operator==(const TChunkedArray& Other) const noexcept requires CEqualityComparable<TElement>
+    {
+        if (Size != Other.Size)
+        {
+            return false;
+        }
+        for (size64 Index = 0; Index < Size; ++Index)
+        {
+            if (!((*this)[Index] == Other[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    [[nodiscard]] TElement& GetFirst()
+    {
+        assert(Size > 0 && "Cannot get first element of empty chunked array");
+        return Chunks[0][0];
+    }
+
+    [[nodiscard]] const TElement& GetFirst() const
+    {
+        assert(Size > 0 && "Cannot get first element of empty chunked array");
+        return Chunks[0][0];
+    }
+
+    [[nodiscard]] TElement& GetLast()
+    {
+        assert(Size > 0 && "Cannot get last element of empty chunked array");
+        return (*this)[Size - 1];
+    }
+
+    [[nodiscard]] const TElement& GetLast() const
+    {
+        assert(Size > 0 && "Cannot get last element of empty chunked array");
+        return (*this)[Size - 1];
+    }
+
+    void PushBack(const TElement& InValue)
+    {
+        EmplaceBack(InValue);
+    }
+
+    void PushBack(TElement&& InValue)
+    {
+        EmplaceBack(std::move(InValue));
+    }
+
+    template <typename... TArguments>
+    TElement& EmplaceBack(TArguments&&... Arguments) requires std::is_constructible_v<TElement, TArguments...>
+    {
+        if ((Size & ChunkMask) == 0 && (Size >> ChunkShift) == Chunks.Num())
+        {
+            AddChunk();
+        }
+        TElement* Element = std::construct_at(&Chunks[Size >> ChunkShift][Size & ChunkMask], std::forward<TArguments>(Arguments)...);
+        ++Size;
+        return *Element;
+    }
+
+    void PopBack()
+    {
+        assert(Size > 0 && "Cannot pop from empty chunked array");
+        --Size;
+        std::destroy_at(&Chunks[Size >> ChunkShift][Size & ChunkMask]);
+    }
+
+    // Allocates chunks up front, the elements already in the array stay where they are
+    void Reserve(const size64 NewCapacity)
+    {
+        const size64 NumChunks = (NewCapacity + ChunkMask) >> ChunkShift;
+        if (NumChunks > Chunks.Num())
+        {
+            Chunks.Reserve(NumChunks);
+            while (Chunks.Num() < NumChunks)
+            {
+                AddChunk();
+            }
+        }
+    }
+
+    void Resize(const size64 NewSize) requires std::is_default_constructible_v<TElement>
+    {
+        Reserve(NewSize);
+        while (Size < NewSize)
+        {
+            std::construct_at(&Chunks[Size >> ChunkShift][Size & ChunkMask]);
+            ++Size;
+        }
+        while (Size > NewSize)
+        {
+            PopBack();
+        }
+    }
+
+    // Frees the chunks past the last element
+    void ShrinkToFit()
+    {
+        const size64 NumUsedChunks = (Size + ChunkMask) >> ChunkShift;
+        while (Chunks.Num() > NumUsedChunks)
+        {
+            FMemory::Free(Chunks.GetLast(), ChunkAlignment);
+            Chunks.PopBack();
+        }
+        Chunks.ShrinkToFit();
+    }
+
+    // Destroys the elements and keeps the chunks for reuse
+    void Clear()
+    {
+        ForEachChunk([](const std::span<TElement> Elements) { std::destroy(Elements.begin(), Elements.end()); });
+        Size = 0;
+    }
+
+public:
+    // Calls Function(std::span<TElement>) for every chunk in order, the last span may be shorter than a chunk
+    template <typename TFunction>
+    void ForEachChunk(const TFunction& Function)
+    {
+        const size64 NumUsedChunks = (Size + ChunkMask) >> ChunkShift;
+        for (size64 ChunkIndex = 0; ChunkIndex < NumUsedChunks; ++ChunkIndex)
+        {
+            Function(GetChunk(ChunkIndex));
+        }
+    }
+
+    template <typename TFunction>
+    void ForEachChunk(const TFunction& Function) const
+    {
+        const size64 NumUsedChunks = (Size + ChunkMask) >> ChunkShift;
+        for (size64 ChunkIndex = 0; ChunkIndex < NumUsedChunks; ++ChunkIndex)
+        {
+            Function(GetChunk(ChunkIndex));
+        }
+    }
+
+    // The elements stored in one chunk
+    [[nodiscard]] std::span<TElement> GetChunk(const size64 ChunkIndex)
+    {
+        assert(ChunkIndex << ChunkShift < Size && "Chunk index is out of bounds");
+        const size64 First = ChunkIndex << ChunkShift;
+        return std::span<TElement>(Chunks[ChunkIndex], Size - First < TElementsPerChunk ? Size - First : TElementsPerChunk);
+    }
+
+    [[nodiscard]] std::span<const TElement> GetChunk(const size64 ChunkIndex) const
+    {
+        assert(ChunkIndex << ChunkShift < Size && "Chunk index is out of bounds");
+        const size64 First = ChunkIndex << ChunkShift;
+        return std::span<const TElement>(Chunks[ChunkIndex], Size - First < TElementsPerChunk ? Size - First : TElementsPerChunk);
+    }
+
+    // Chunks holding at least one element
+    [[nodiscard]] size64 GetNumChunks() const noexcept
+    {
+        return (Size + ChunkMask) >> ChunkShift;
+    }
+
+public:
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Size;
+    }
+
+    [[nodiscard]] size64 GetCapacity() const noexcept
+    {
+        return Chunks.Num() << ChunkShift;
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return Size == 0;
+    }
+
+public:
+    // Iterator Support
+    [[nodiscard]] Iterator begin() noexcept
+    {
+        return MakeIterator<Iterator>(0);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept
+    {
+        return MakeIterator<ConstIterator>(0);
+    }
+
+    [[nodiscard]] Iterator end() noexcept
+    {
+        return MakeIterator<Iterator>(Size);
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept
+    {
+        return MakeIterator<ConstIterator>(Size);
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+private:
+    // The iterator at Index, the end of a full last chunk belongs to that chunk rather than to the next one
+    template <typename TIterator>
+    [[nodiscard]] TIterator MakeIterator(const size64 Index) const noexcept
+    {
+        if (Size == 0)
+        {
+            return TIterator();
+        }
+        TElement* const* LastChunk = Chunks.GetData() + ((Size - 1) >> ChunkShift);
+        const size64 ChunkIndex = Index == Size ? (Size - 1) >> ChunkShift : Index >> ChunkShift;
+        TElement* const* Chunk = Chunks.GetData() + ChunkIndex;
+        return TIterator(*Chunk + (Index - (ChunkIndex << ChunkShift)), Chunk, LastChunk);
+    }
+
+    void AddChunk()
+    {
+        Chunks.PushBack(static_cast<TElement*>(FMemory::Allocate(sizeof(TElement) * TElementsPerChunk, ChunkAlignment)));
+    }
+
+    void AppendCopies(const TChunkedArray& Other)
+    {
+        Reserve(Other.Size);
+        Other.ForEachChunk([this](const std::span<const TElement> Elements)
+        {
+            // Source and target chunks line up, so a whole chunk is copied at once
+            TElement* Target = Chunks[Size >> ChunkShift];
+            if constexpr (std::is_trivially_copyable_v<TElement>)
+            {
+                FMemory::Copy(Elements.data(), Target, Elements.size() * sizeof(TElement));
+            }
+            else
+            {
+                std::uninitialized_copy_n(Elements.data(), Elements.size(), Target);
+            }
+            Size += Elements.size();
+        });
+    }
+
+    void DestroyAndDeallocate()
+    {
+        Clear();
+        for (TElement* Chunk : Chunks)
+        {
+            FMemory::Free(Chunk, ChunkAlignment);
+        }
+        Chunks.Clear();
+    }
+
+private:
+    TArray<TElement*> Chunks;
+    size64 Size = 0;
+};
@@ -0,0 +1,261 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/HashTable.hpp"
+#include "Core/Containers/Set.hpp"
+
+// Hash map that any number of threads may use at once, meant for shared caches. Keys are spread over NumShards
+// independent hash tables, each behind its own reader writer lock, so readers never wait for each other and a
+// writer only holds up threads that touch the same shard. Lookups hand out copies, a reference could be left
+// dangling by a Remove on another thread, so values should be cheap to copy, like handles or shared pointers
+template <CValidMapKey TKey, CValidMapValue TValue, typename THasher = THash<TKey>, typename TComparer = std::equal_to<TKey>,
+    size64 NumShards = 64>
+class TConcurrentMap
+{
+    static_assert(std::has_single_bit(NumShards), "NumShards must be a power of two");
+
+    using FTable = THashTable<std::pair<const TKey, TValue>, TPairKeyOf<TKey, TValue>, THasher, TComparer>;
+
+    // The tables pick their buckets from the low bits of the hash, so the shard comes from the high bits.
+    // Sharing the low bits would leave all but one in NumShards buckets of every table empty
+    static constexpr uint32 ShardShift = NumShards > 1 ? 64 - std::countr_zero(NumShards) : 0;
+
+    // One cache line per shard, so that locking a shard does not steal the line of its neighbours from other cores
+    struct alignas(64) FShard
+    {
+        mutable std::shared_mutex Mutex;
+        FTable Table;
+
+        // Keys whose FindOrAdd factory is running, and a counter bumped whenever one of them finishes
+        TSet<TKey, THasher, TComparer> PendingKeys;
+        std::atomic<uint32> Generation = 0;
+    };
+
+public:
+    using KeyType = TKey;
+    using MappedType = TValue;
+    using SizeType = size64;
+    using HasherType = THasher;
+    using ComparerType = TComparer;
+
+public:
+    TConcurrentMap() = default;
+    TConcurrentMap(const TConcurrentMap&) = delete;
+    TConcurrentMap& operator=(const TConcurrentMap&) = delete;
+
+public:
+    // Copies the value of Key into OutValue, returns whether there was one
+    [[nodiscard]] bool8 Find(const TKey& Key, TValue& OutValue) const requires std::is_copy_assignable_v<TValue>
+    {
+        const size64 KeyHash = Hasher(Key);
+        const FShard& Shard = GetShard(KeyHash);
+        std::shared_lock Lock(Shard.Mutex);
+        const auto Position = Shard.Table.Find(Key, KeyHash);
+        if (Position == Shard.Table.end())
+        {
+            return false;
+        }
+        OutValue = Position->second;
+        return true;
+    }
+
+    [[nodiscard]] bool8 Contains(const TKey& Key) const
+    {
+        const size64 KeyHash = Hasher(Key);
+        const FShard& Shard = GetShard(KeyHash);
+        std::shared_lock Lock(Shard.Mutex);
+        return Shard.Table.Find(Key, KeyHash) != Shard.Table.end();
+    }
+
+    // Calls Visitor with the value of Key while holding the shard's shared lock, for values too large to copy.
+    // Returns whether there was a value. Visitor must not call into the map
+    template <typename TVisitor>
+    bool8 Visit(const TKey& Key, TVisitor&& Visitor) const requires std::is_invocable_v<TVisitor, const TValue&>
+    {
+        const size64 KeyHash = Hasher(Key);
+        const FShard& Shard = GetShard(KeyHash);
+        std::shared_lock Lock(Shard.Mutex);
+        const auto Position = Shard.Table.Find(Key, KeyHash);
+        if (Position == Shard.Table.end())
+        {
+            return false;
+        }
+        std::invoke(std::forward<TVisitor>(Visitor), Position->second);
+        return true;
+    }
+
+    // Returns the value of Key, creating it with Factory() if there is none. Factory runs at most once for a
+    // missing key and without holding any lock: threads asking for the same key sleep until it is done, all
+    // others carry on. Factory may look up or add other keys, but must not ask for Key itself
+    template <typename TFactory>
+    TValue FindOrAdd(const TKey& Key, TFactory&& Factory)
+        requires std::is_invocable_v<TFactory> && std::is_constructible_v<TValue, std::invoke_result_t<TFactory>>
+    {
+        const size64 KeyHash = Hasher(Key);
+        FShard& Shard = GetShard(KeyHash);
+        {
+            std::shared_lock Lock(Shard.Mutex);
+            const auto Position = Shard.Table.Find(Key, KeyHash);
+            if (Position != Shard.Table.end())
+            {
+                return Position->second;
+            }
+        }
+
+        std::unique_lock Lock(Shard.Mutex);
+        while (true)
+        {
+            const auto Position = Shard.Table.Find(Key, KeyHash);
+            if (Position != Shard.Table.end())
+            {
+                return Position->second;
+            }
+            if (!Shard.PendingKeys.Contains(Key))
+            {
+                break;
+            }
+            // Another thread runs the factory of Key. The generation is read under the lock the factory's thread
+            // needs to finish, so the wait cannot miss its wake up
+            const uint32 Generation = Shard.Generation.load(std::memory_order_relaxed);
+            Lock.unlock();
+            Shard.Generation.wait(Generation, std::memory_order_relaxed);
+            Lock.lock();
+        }
+        Shard.PendingKeys.Insert(Key);
+        Lock.unlock();
+
+        TValue NewValue(std::invoke(std::forward<TFactory>(Factory)));
+
+        Lock.lock();
+        Shard.PendingKeys.Remove(Key);
+        Shard.Generation.fetch_add(1, std::memory_order_relaxed);
+        // An Insert of Key may have happened while the factory ran, like for any later caller its value wins
+        TValue Result = Shard.Table.FindOrEmplace(Key, KeyHash, Key, std::move(NewValue)).first->second;
+        Lock.unlock();
+        Shard.Generation.notify_all();
+        return Result;
+    }
+
+    // Adds Key with Value unless Key exists, returns whether it was added
+    bool8 Insert(const TKey& Key, const TValue& Value)
+    {
+        const size64 KeyHash = Hasher(Key);
+        FShard& Shard = GetShard(KeyHash);
+        std::unique_lock Lock(Shard.Mutex);
+        return Shard.Table.FindOrEmplace(Key, KeyHash, Key, Value).second;
+    }
+
+    bool8 Insert(const TKey& Key, TValue&& Value)
+    {
+        const size64 KeyHash = Hasher(Key);
+        FShard& Shard = GetShard(KeyHash);
+        std::unique_lock Lock(Shard.Mutex);
+        return Shard.Table.FindOrEmplace(Key, KeyHash, Key, std::move(Value)).second;
+    }
+
+    // Adds Key with Value or overwrites its current value, returns whether it was added
+    template <typename TValueArg>
+    bool8 InsertOrAssign(const TKey& Key, TValueArg&& Value) requires std::is_assignable_v<TValue&, TValueArg>
+    {
+        const size64 KeyHash = Hasher(Key);
+        FShard& Shard = GetShard(KeyHash);
+        std::unique_lock Lock(Shard.Mutex);
+        const auto Position = Shard.Table.Find(Key, KeyHash);
+        if (Position != Shard.Table.end())
+        {
+            Position->second = std::forward<TValueArg>(Value);
+            return false;
+        }
+        Shard.Table.EmplaceWithHash(KeyHash, Key, std::forward<TValueArg>(Value));
+        return true;
+    }
+
+    size64 Remove(const TKey& Key)
+    {
+        FShard& Shard = GetShard(Hasher(Key));
+        std::unique_lock Lock(Shard.Mutex);
+        return Shard.Table.Remove(Key);
+    }
+
+    // Shard by shard, keys added to an already cleared shard meanwhile stay
+    void Clear()
+    {
+        for (FShard& Shard : Shards)
+        {
+            std::unique_lock Lock(Shard.Mutex);
+            Shard.Table.Clear();
+        }
+    }
+
+    // Sizes every shard for an even share of NumElements
+    void Reserve(const size64 NumElements)
+    {
+        for (FShard& Shard : Shards)
+        {
+            std::unique_lock Lock(Shard.Mutex);
+            Shard.Table.Reserve((NumElements + NumShards - 1) / NumShards);
+        }
+    }
+
+    // Calls Visitor with every key and value, holding the shared lock of one shard at a time. This is not a
+    // snapshot, writers may change shards the visit has not reached yet. Visitor must not call into the map
+    template <typename TVisitor>
+    void ForEach(TVisitor&& Visitor) const requires std::is_invocable_v<TVisitor&, const TKey&, const TValue&>
+    {
+        for (const FShard& Shard : Shards)
+        {
+            std::shared_lock Lock(Shard.Mutex);
+            for (const auto& [Key, Value] : Shard.Table)
+            {
+                Visitor(Key, Value);
+            }
+        }
+    }
+
+public:
+    // Only exact while no other thread writes
+    [[nodiscard]] size64 Num() const
+    {
+        size64 NumElements = 0;
+        for (const FShard& Shard : Shards)
+        {
+            std::shared_lock Lock(Shard.Mutex);
+            NumElements += Shard.Table.Num();
+        }
+        return NumElements;
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const
+    {
+        return Num() == 0;
+    }
+
+    [[nodiscard]] static constexpr size64 GetShardCount() noexcept
+    {
+        return NumShards;
+    }
+
+private:
+    [[nodiscard]] FShard& GetShard(const size64 KeyHash) noexcept
+    {
+        return Shards[(KeyHash >> ShardShift) & (NumShards - 1)];
+    }
+
+    [[nodiscard]] const FShard& GetShard(const size64 KeyHash) const noexcept
+    {
+        return Shards[(KeyHash >> ShardShift) & (NumShards - 1)];
+    }
+
+private:
+    FShard Shards[NumShards];
+    THasher Hasher;
+};
@@ -0,0 +1,314 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+
+// Index plus generation packed into one integer. Generations start at 1, so a zero initialized handle is
+// always invalid. Lookups compare the generation the slot had when the handle was issued
+template <std::unsigned_integral TStorage, uint32 TIndexBits>
+struct THandle
+{
+    static_assert(TIndexBits > 0 && TIndexBits < sizeof(TStorage) * 8, "Handle needs both index and generation bits");
+    static_assert(TIndexBits <= 32 && sizeof(TStorage) * 8 - TIndexBits <= 32, "Index and generation are limited to 32 bits each");
+
+    using StorageType = TStorage;
+
+    static constexpr uint32 IndexBits = TIndexBits;
+    static constexpr uint32 GenerationBits = sizeof(TStorage) * 8 - TIndexBits;
+    static constexpr uint64 MaxIndex = (uint64(1) << IndexBits) - 1;
+    static constexpr uint64 MaxGeneration = (uint64(1) << GenerationBits) - 1;
+
+    TStorage Value = 0;
+
+    [[nodiscard]] static constexpr THandle Make(const uint64 Index, const uint64 Generation) noexcept
+    {
+        assert(Index <= MaxIndex && Generation <= MaxGeneration && "Handle index or generation out of range");
+        return THandle{static_cast<TStorage>(Generation << IndexBits | Index)};
+    }
+
+    [[nodiscard]] constexpr uint32 GetIndex() const noexcept
+    {
+        return static_cast<uint32>(Value & MaxIndex);
+    }
+
+    [[nodiscard]] constexpr uint32 GetGeneration() const noexcept
+    {
+        return static_cast<uint32>(Value >> IndexBits);
+    }
+
+    [[nodiscard]] constexpr bool8 IsValid() const noexcept
+    {
+        return Value != 0;
+    }
+
+    constexpr bool8 operator==(const THandle& Other) const noexcept = default;
+};
+
+// 1M slots with 4095 reuses each, or 4G slots with 4G reuses each
+using FHandle32 = THandle<uint32, 20>;
+using FHandle64 = THandle<uint64, 32>;
+
+template <std::unsigned_integral TStorage, uint32 TIndexBits>
+struct std::hash<THandle<TStorage, TIndexBits>>
+{
+    size64 operator()(const THandle<TStorage, TIndexBits>& Handle) const noexcept
+    {
+        return std::hash<TStorage>{}(Handle.Value);
+    }
+};
+
+// Slot array that handle based containers translate handles through. A live slot holds the position of its value
+// in the container, its target, which the container keeps up to date as values move. Free slots form an intrusive
+// list through the targets like the chunks of a TMemoryPool. A slot whose generation would overflow is retired
+// instead of being reused, so a stale handle never matches it again
+template <typename THandleType = FHandle64>
+class THandleSlots
+{
+public:
+    using HandleType = THandleType;
+
+private:
+    static constexpr uint32 EndOfFreeList = 0xFFFFFFFF;
+
+    struct FSlot
+    {
+        // Target while the slot is alive, next free slot otherwise
+        uint32 TargetOrNextFree;
+        uint32 Generation;
+    };
+
+public:
+    // Takes a free slot, or a new one, and points it at Target
+    [[nodiscard]] HandleType Acquire(const uint32 Target)
+    {
+        uint32 SlotIndex;
+        if (FreeListHead != EndOfFreeList)
+        {
+            SlotIndex = FreeListHead;
+            FreeListHead = Slots[SlotIndex].TargetOrNextFree;
+        }
+        else
+        {
+            assert(Slots.Num() < HandleType::MaxIndex && "Ran out of handle indices");
+            SlotIndex = static_cast<uint32>(Slots.Num());
+            Slots.PushBack(FSlot{.TargetOrNextFree = 0, .Generation = 1});
+        }
+
+        FSlot& Slot = Slots[SlotIndex];
+        Slot.TargetOrNextFree = Target;
+        return HandleType::Make(SlotIndex, Slot.Generation);
+    }
+
+    // Invalidates every handle issued for the slot
+    void Release(const uint32 SlotIndex)
+    {
+        FSlot& Slot = Slots[SlotIndex];
+        if (Slot.Generation < HandleType::MaxGeneration)
+        {
+            ++Slot.Generation;
+            Slot.TargetOrNextFree = FreeListHead;
+            FreeListHead = SlotIndex;
+        }
+        else
+        {
+            // Retired, generation 0 is never issued so no handle matches the slot again
+            Slot.Generation = 0;
+        }
+    }
+
+    [[nodiscard]] bool8 Contains(const HandleType Handle) const noexcept
+    {
+        const uint32 SlotIndex = Handle.GetIndex();
+        return Handle.GetGeneration() != 0 && SlotIndex < Slots.Num() && Slots[SlotIndex].Generation == Handle.GetGeneration();
+    }
+
+    [[nodiscard]] uint32 GetTarget(const uint32 SlotIndex) const
+    {
+        return Slots[SlotIndex].TargetOrNextFree;
+    }
+
+    void SetTarget(const uint32 SlotIndex, const uint32 Target)
+    {
+        Slots[SlotIndex].TargetOrNextFree = Target;
+    }
+
+    // Handle of a live slot
+    [[nodiscard]] HandleType GetHandle(const uint32 SlotIndex) const
+    {
+        return HandleType::Make(SlotIndex, Slots[SlotIndex].Generation);
+    }
+
+    void Reserve(const size64 NewCapacity)
+    {
+        Slots.Reserve(NewCapacity);
+    }
+
+private:
+    TArray<FSlot> Slots;
+    uint32 FreeListHead = EndOfFreeList;
+};
+
+// Slot map: values live densely packed in a TArray for iteration, THandleSlots translate handles into dense
+// indices. Insert, Remove and Find are O(1), removing moves the last value into the hole so value addresses are
+// not stable, handles are
+template <typename TElement, typename THandleType = FHandle64>
+class THandlePool
+{
+public:
+    using ValueType = TElement;
+    using HandleType = THandleType;
+
+public:
+    THandlePool() = default;
+
+    explicit THandlePool(const size64 InCapacity)
+    {
+        Reserve(InCapacity);
+    }
+
+public:
+    template <typename... TArguments> requires std::is_constructible_v<TElement, TArguments...>
+    HandleType Emplace(TArguments&&... Arguments)
+    {
+        const HandleType Handle = Slots.Acquire(static_cast<uint32>(Values.Num()));
+        Values.EmplaceBack(std::forward<TArguments>(Arguments)...);
+        DenseToSlot.PushBack(Handle.GetIndex());
+        return Handle;
+    }
+
+    HandleType Insert(const TElement& Value)
+    {
+        return Emplace(Value);
+    }
+
+    HandleType Insert(TElement&& Value)
+    {
+        return Emplace(std::move(Value));
+    }
+
+    // Returns false if the handle is stale or invalid
+    bool8 Remove(const HandleType Handle)
+    {
+        if (!Contains(Handle))
+        {
+            return false;
+        }
+
+        const uint32 SlotIndex = Handle.GetIndex();
+        const uint32 DenseIndex = Slots.GetTarget(SlotIndex);
+        const uint32 LastDenseIndex = static_cast<uint32>(Values.Num() - 1);
+        Values.RemoveAtSwap(DenseIndex);
+        DenseToSlot.RemoveAtSwap(DenseIndex);
+        if (DenseIndex != LastDenseIndex)
+        {
+            Slots.SetTarget(DenseToSlot[DenseIndex], DenseIndex);
+        }
+        Slots.Release(SlotIndex);
+        return true;
+    }
+
+    [[nodiscard]] bool8 Contains(const HandleType Handle) const noexcept
+    {
+        return Slots.Contains(Handle);
+    }
+
+    [[nodiscard]] TElement* Find(const HandleType Handle) noexcept
+    {
+        return Contains(Handle) ? &Values[Slots.GetTarget(Handle.GetIndex())] : nullptr;
+    }
+
+    [[nodiscard]] const TElement* Find(const HandleType Handle) const noexcept
+    {
+        return Contains(Handle) ? &Values[Slots.GetTarget(Handle.GetIndex())] : nullptr;
+    }
+
+    [[nodiscard]] TElement& operator[](const HandleType Handle)
+    {
+        assert(Contains(Handle) && "Stale or invalid handle");
+        return Values[Slots.GetTarget(Handle.GetIndex())];
+    }
+
+    [[nodiscard]] const TElement& operator[](const HandleType Handle) const
+    {
+        assert(Contains(Handle) && "Stale or invalid handle");
+        return Values[Slots.GetTarget(Handle.GetIndex())];
+    }
+
+    // Handle of the value at a dense index, for use while iterating the values
+    [[nodiscard]] HandleType GetHandleAt(const size64 DenseIndex) const
+    {
+        return Slots.GetHandle(DenseToSlot[DenseIndex]);
+    }
+
+    // Invalidates every issued handle but keeps the slots, their generations move on
+    void Clear()
+    {
+        for (const uint32 SlotIndex : DenseToSlot)
+        {
+            Slots.Release(SlotIndex);
+        }
+        Values.Clear();
+        DenseToSlot.Clear();
+    }
+
+    void Reserve(const size64 NewCapacity)
+    {
+        Values.Reserve(NewCapacity);
+        DenseToSlot.Reserve(NewCapacity);
+        Slots.Reserve(NewCapacity);
+    }
+
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Values.Num();
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return Values.IsEmpty();
+    }
+
+    [[nodiscard]] TElement* GetData() noexcept
+    {
+        return Values.GetData();
+    }
+
+    [[nodiscard]] const TElement* GetData() const noexcept
+    {
+        return Values.GetData();
+    }
+
+public:
+    // Iterates the dense values in unspecified order
+    [[nodiscard]] TElement* begin() noexcept
+    {
+        return Values.begin();
+    }
+
+    [[nodiscard]] const TElement* begin() const noexcept
+    {
+        return Values.begin();
+    }
+
+    [[nodiscard]] TElement* end() noexcept
+    {
+        return Values.end();
+    }
+
+    [[nodiscard]] const TElement* end() const noexcept
+    {
+        return Values.end();
+    }
+
+private:
+    TArray<TElement> Values;
+    TArray<uint32> DenseToSlot;
+    THandleSlots<HandleType> Slots;
+};
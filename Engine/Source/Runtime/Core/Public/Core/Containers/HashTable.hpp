@@ -0,0 +1,775 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Hash/Hash.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Memory/MemoryPool.hpp"
+
+template <typename TKey>
+concept CValidMapKey = std::is_object_v<TKey> && !std::is_abstract_v<TKey> && CHashable<TKey> &&
+    requires(const TKey& A, const TKey& B)
+    {
+        { A == B } -> std::convertible_to<bool>;
+    };
+
+template <typename TValue>
+concept CValidMapValue = std::is_object_v<TValue> && !std::is_abstract_v<TValue>;
+
+// Key of the elements of TSet, which are their own keys
+struct FIdentityKeyOf
+{
+    template <typename TElement>
+    [[nodiscard]] static constexpr const TElement& Get(const TElement& Element) noexcept
+    {
+        return Element;
+    }
+};
+
+// Key of the key value pairs of TMap and TMultiMap
+template <typename TKey, typename TValue>
+struct TPairKeyOf
+{
+    [[nodiscard]] static constexpr const TKey& Get(const std::pair<const TKey, TValue>& Pair) noexcept
+    {
+        return Pair.first;
+    }
+};
+
+// Separate chaining hash table behind TMap, TSet and TMultiMap, which inherit it privately and expose the
+// operations that fit them. TKeyOf extracts the key of an element. Nodes come from an embedded TMemoryPool,
+// so inserting does not hit the allocator once the pool has grown and removed nodes are recycled by later
+// inserts. Element addresses stay stable until the element is removed. Buckets are allocated on the first
+// insert, so empty tables cost no memory beyond the table itself, and the first occupied bucket is tracked
+// so begin() does not scan. Elements with equal keys, allowed through EmplaceMulti, are always adjacent in
+// their chain
+template <typename TElement, typename TKeyOf, typename THasher, typename TComparer>
+class THashTable
+{
+public:
+    using KeyType = std::remove_cvref_t<decltype(TKeyOf::Get(std::declval<const TElement&>()))>;
+    using ValueType = TElement;
+    using SizeType = size64;
+    using HasherType = THasher;
+    using ComparerType = TComparer;
+
+private:
+    static constexpr size64 DefaultBucketCount = 16;
+    static constexpr float64 MaxLoadFactor = 0.75;
+
+    struct FNode
+    {
+        ValueType Data;
+        FNode* NextNode;
+
+        template <typename... TArguments>
+        FNode(FNode* InNextNode, TArguments&&... Arguments)
+            : Data(std::forward<TArguments>(Arguments)...), NextNode(InNextNode)
+        {
+        }
+    };
+
+    template <typename TNodePointer, typename TValueReference>
+    class THashTableIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ValueType;
+        using difference_type = ptrdiff_t;
+        using pointer = std::remove_reference_t<TValueReference>*;
+        using reference = TValueReference;
+
+    public:
+        constexpr THashTableIterator()
+            : CurrentNode(nullptr), Buckets(nullptr), BucketCount(0), CurrentBucket(0)
+        {
+        }
+
+        constexpr THashTableIterator(TNodePointer InNode, FNode** InBuckets, const size64 InBucketCount, const size64 InCurrentBucket) noexcept
+            : CurrentNode(InNode), Buckets(InBuckets), BucketCount(InBucketCount), CurrentBucket(InCurrentBucket)
+        {
+        }
+
+        template <typename TOtherNodePointer, typename TOtherValueReference>
+        constexpr THashTableIterator(const THashTableIterator<TOtherNodePointer, TOtherValueReference>& Other) noexcept requires std::convertible_to<TOtherNodePointer, TNodePointer>
+            : CurrentNode(Other.CurrentNode), Buckets(Other.Buckets), BucketCount(Other.BucketCount), CurrentBucket(Other.CurrentBucket)
+        {
+        }
+
+    public:
+        constexpr reference operator*() const
+        {
+            assert(CurrentNode != nullptr && "Cannot dereference end iterator");
+            return CurrentNode->Data;
+        }
+
+        constexpr pointer operator->() const
+        {
+            assert(CurrentNode != nullptr && "Cannot access end iterator");
+            return &CurrentNode->Data;
+        }
+
+        constexpr THashTableIterator& operator++()
+        {
+            assert(CurrentNode != nullptr && "Cannot increment end iterator");
+            CurrentNode = CurrentNode->NextNode;
+            if (CurrentNode == nullptr)
+            {
+                ++CurrentBucket;
+                while (CurrentBucket < BucketCount && Buckets[CurrentBucket] == nullptr)
+                {
+                    ++CurrentBucket;
+                }
+                if (CurrentBucket < BucketCount)
+                {
+                    CurrentNode = Buckets[CurrentBucket];
+                }
+            }
+            return *this;
+        }
+
+        constexpr THashTableIterator operator++(int)
+        {
+            THashTableIterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        constexpr bool8 operator==(const THashTableIterator& Other) const noexcept
+        {
+            return CurrentNode == Other.CurrentNode;
+        }
+
+        constexpr auto operator<=>(const THashTableIterator& Other) const noexcept
+        {
+            return CurrentNode <=> Other.CurrentNode;
+        }
+
+    public:
+        TNodePointer CurrentNode;
+        FNode** Buckets;
+        size64 BucketCount;
+        size64 CurrentBucket;
+
+        template <typename, typename>
+        friend class THashTableIterator;
+    };
+
+    // Follows a single chain and never visits other buckets, for walking the run of one key
+    template <typename TNodePointer, typename TValueReference>
+    class TChainIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ValueType;
+        using difference_type = ptrdiff_t;
+        using pointer = std::remove_reference_t<TValueReference>*;
+        using reference = TValueReference;
+
+    public:
+        constexpr TChainIterator()
+            : CurrentNode(nullptr)
+        {
+        }
+
+        constexpr explicit TChainIterator(TNodePointer InNode) noexcept
+            : CurrentNode(InNode)
+        {
+        }
+
+    public:
+        constexpr reference operator*() const
+        {
+            assert(CurrentNode != nullptr && "Cannot dereference end iterator");
+            return CurrentNode->Data;
+        }
+
+        constexpr pointer operator->() const
+        {
+            assert(CurrentNode != nullptr && "Cannot access end iterator");
+            return &CurrentNode->Data;
+        }
+
+        constexpr TChainIterator& operator++()
+        {
+            assert(CurrentNode != nullptr && "Cannot increment end iterator");
+            CurrentNode = CurrentNode->NextNode;
+            return *this;
+        }
+
+        constexpr TChainIterator operator++(int)
+        {
+            TChainIterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        constexpr bool8 operator==(const TChainIterator& Other) const noexcept
+        {
+            return CurrentNode == Other.CurrentNode;
+        }
+
+    public:
+        TNodePointer CurrentNode;
+    };
+
+public:
+    using Iterator = THashTableIterator<FNode*, ValueType&>;
+    using ConstIterator = THashTableIterator<const FNode*, const ValueType&>;
+    using RunIterator = TChainIterator<FNode*, ValueType&>;
+    using ConstRunIterator = TChainIterator<const FNode*, const ValueType&>;
+
+public:
+    constexpr THashTable()
+        : Buckets(nullptr), BucketCount(0), ElementCount(0), FirstBucket(0), Hasher(), Comparer()
+    {
+    }
+
+    explicit THashTable(const size64 InBucketCount)
+        : Buckets(nullptr), BucketCount(0), ElementCount(0), FirstBucket(0), Hasher(), Comparer()
+    {
+        InitializeBuckets(InBucketCount > 0 ? InBucketCount : DefaultBucketCount);
+    }
+
+    THashTable(const THashTable& Other)
+        : Buckets(nullptr), BucketCount(0), ElementCount(0), FirstBucket(0), Hasher(Other.Hasher), Comparer(Other.Comparer)
+    {
+        if (Other.ElementCount > 0)
+        {
+            InitializeBuckets(Other.BucketCount);
+            CopyNodes(Other);
+        }
+    }
+
+    THashTable(THashTable&& Other) noexcept
+        : Buckets(Other.Buckets), BucketCount(Other.BucketCount), ElementCount(Other.ElementCount), FirstBucket(Other.FirstBucket),
+          Hasher(std::move(Other.Hasher)), Comparer(std::move(Other.Comparer)), NodePool(std::move(Other.NodePool))
+    {
+        Other.Buckets = nullptr;
+        Other.BucketCount = 0;
+        Other.ElementCount = 0;
+    }
+
+    ~THashTable()
+    {
+        DestroyAndDeallocate();
+    }
+
+public:
+    THashTable& operator=(const THashTable& Other)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            if (Other.ElementCount > 0 && BucketCount != Other.BucketCount)
+            {
+                DestroyAndDeallocate();
+                InitializeBuckets(Other.BucketCount);
+            }
+            Hasher = Other.Hasher;
+            Comparer = Other.Comparer;
+            if (Other.ElementCount > 0)
+            {
+                CopyNodes(Other);
+            }
+        }
+        return *this;
+    }
+
+    THashTable& operator=(THashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAndDeallocate();
+            Buckets = Other.Buckets;
+            BucketCount = Other.BucketCount;
+            ElementCount = Other.ElementCount;
+            FirstBucket = Other.FirstBucket;
+            Hasher = std::move(Other.Hasher);
+            Comparer = std::move(Other.Comparer);
+            NodePool = std::move(Other.NodePool);
+            Other.Buckets = nullptr;
+            Other.BucketCount = 0;
+            Other.ElementCount = 0;
+        }
+        return *this;
+    }
+
+public:
+    // Links a node constructed from Arguments unless an element with Key exists. Key and KeyHash must match
+    // the element Arguments construct, Arguments are left untouched if it exists
+    template <typename... TArguments>
+    std::pair<Iterator, bool8> FindOrEmplace(const KeyType& Key, const size64 KeyHash, TArguments&&... Arguments)
+    {
+        if (FNode* Existing = FindNode(Key, KeyHash))
+        {
+            return std::make_pair(MakeIterator(Existing, KeyHash), false);
+        }
+        return std::make_pair(LinkNode(NodePool.Allocate(nullptr, std::forward<TArguments>(Arguments)...), KeyHash), true);
+    }
+
+    // Constructs the element in a node first, the node goes back to the pool if its key already exists
+    template <typename... TArguments>
+    std::pair<Iterator, bool8> EmplaceUnique(TArguments&&... Arguments)
+    {
+        FNode* NewNode = NodePool.Allocate(nullptr, std::forward<TArguments>(Arguments)...);
+        const size64 KeyHash = Hasher(TKeyOf::Get(NewNode->Data));
+        if (FNode* Existing = FindNode(TKeyOf::Get(NewNode->Data), KeyHash))
+        {
+            NodePool.Free(NewNode);
+            return std::make_pair(MakeIterator(Existing, KeyHash), false);
+        }
+        return std::make_pair(LinkNode(NewNode, KeyHash), true);
+    }
+
+    // Links the element in front of the elements with an equal key, or at the head of its bucket
+    template <typename... TArguments>
+    Iterator EmplaceMulti(TArguments&&... Arguments)
+    {
+        FNode* NewNode = NodePool.Allocate(nullptr, std::forward<TArguments>(Arguments)...);
+        const KeyType& Key = TKeyOf::Get(NewNode->Data);
+        const size64 KeyHash = Hasher(Key);
+        CheckLoadFactorAndRehash();
+        const size64 BucketIndex = KeyHash & (BucketCount - 1);
+        FNode** Link = &Buckets[BucketIndex];
+        while (*Link != nullptr && !Comparer(TKeyOf::Get((*Link)->Data), Key))
+        {
+            Link = &(*Link)->NextNode;
+        }
+        if (*Link == nullptr)
+        {
+            Link = &Buckets[BucketIndex];
+        }
+        NewNode->NextNode = *Link;
+        *Link = NewNode;
+        OnNodeLinked(BucketIndex);
+        return Iterator(NewNode, Buckets, BucketCount, BucketIndex);
+    }
+
+    // Links a new element without looking for an equal key, the caller guarantees there is none
+    template <typename... TArguments>
+    Iterator EmplaceWithHash(const size64 KeyHash, TArguments&&... Arguments)
+    {
+        return LinkNode(NodePool.Allocate(nullptr, std::forward<TArguments>(Arguments)...), KeyHash);
+    }
+
+    [[nodiscard]] Iterator Find(const KeyType& Key)
+    {
+        if (BucketCount == 0)
+        {
+            return end();
+        }
+        return Find(Key, Hasher(Key));
+    }
+
+    [[nodiscard]] ConstIterator Find(const KeyType& Key) const
+    {
+        if (BucketCount == 0)
+        {
+            return end();
+        }
+        return Find(Key, Hasher(Key));
+    }
+
+    // Lookup with a hash computed by the caller, who may need it again for another table
+    [[nodiscard]] Iterator Find(const KeyType& Key, const size64 KeyHash)
+    {
+        FNode* Node = FindNode(Key, KeyHash);
+        return Node != nullptr ? MakeIterator(Node, KeyHash) : end();
+    }
+
+    [[nodiscard]] ConstIterator Find(const KeyType& Key, const size64 KeyHash) const
+    {
+        const FNode* Node = FindNode(Key, KeyHash);
+        return Node != nullptr ? ConstIterator(Node, Buckets, BucketCount, KeyHash & (BucketCount - 1)) : end();
+    }
+
+    [[nodiscard]] bool8 Contains(const KeyType& Key) const
+    {
+        return Find(Key) != end();
+    }
+
+    // The elements with a key equal to Key, which are next to each other in their chain
+    [[nodiscard]] std::pair<RunIterator, RunIterator> FindRange(const KeyType& Key)
+    {
+        FNode* First = FindNode(Key, BucketCount > 0 ? Hasher(Key) : 0);
+        return std::make_pair(RunIterator(First), RunIterator(FindRunEnd(First, Key)));
+    }
+
+    [[nodiscard]] std::pair<ConstRunIterator, ConstRunIterator> FindRange(const KeyType& Key) const
+    {
+        const FNode* First = FindNode(Key, BucketCount > 0 ? Hasher(Key) : 0);
+        return std::make_pair(ConstRunIterator(First), ConstRunIterator(FindRunEnd(First, Key)));
+    }
+
+    // Removes every element with a key equal to Key
+    size64 Remove(const KeyType& Key)
+    {
+        if (BucketCount == 0)
+        {
+            return 0;
+        }
+        const size64 BucketIndex = Hasher(Key) & (BucketCount - 1);
+        FNode** Link = &Buckets[BucketIndex];
+        while (*Link != nullptr && !Comparer(TKeyOf::Get((*Link)->Data), Key))
+        {
+            Link = &(*Link)->NextNode;
+        }
+        // The run is unlinked before any node is destroyed, Key may live in one of them
+        size64 NumRemoved = 0;
+        FNode* RunEnd = *Link;
+        while (RunEnd != nullptr && Comparer(TKeyOf::Get(RunEnd->Data), Key))
+        {
+            RunEnd = RunEnd->NextNode;
+            ++NumRemoved;
+        }
+        FNode* RemovedNode = *Link;
+        *Link = RunEnd;
+        while (RemovedNode != RunEnd)
+        {
+            FNode* NextNode = RemovedNode->NextNode;
+            DestroyNode(RemovedNode);
+            RemovedNode = NextNode;
+        }
+        if (NumRemoved > 0)
+        {
+            ElementCount -= NumRemoved;
+            UpdateFirstBucketAfterRemove(BucketIndex);
+        }
+        return NumRemoved;
+    }
+
+    Iterator Remove(ConstIterator Position)
+    {
+        assert(Position != end() && "Cannot remove end iterator");
+
+        const size64 BucketIndex = Position.CurrentBucket;
+        FNode** CurrentNodePtr = &Buckets[BucketIndex];
+        while (*CurrentNodePtr != nullptr)
+        {
+            FNode* CurrentNode = *CurrentNodePtr;
+            if (CurrentNode == Position.CurrentNode)
+            {
+                FNode* NextNode = CurrentNode->NextNode;
+                *CurrentNodePtr = NextNode;
+                DestroyNode(CurrentNode);
+                --ElementCount;
+                if (NextNode != nullptr)
+                {
+                    return Iterator(NextNode, Buckets, BucketCount, BucketIndex);
+                }
+                const size64 NextBucket = FindOccupiedBucket(BucketIndex + 1);
+                if (BucketIndex == FirstBucket && Buckets[BucketIndex] == nullptr)
+                {
+                    FirstBucket = NextBucket;
+                }
+
+                if (NextBucket < BucketCount)
+                {
+                    return Iterator(Buckets[NextBucket], Buckets, BucketCount, NextBucket);
+                }
+                return end();
+            }
+            CurrentNodePtr = &CurrentNode->NextNode;
+        }
+        return end();
+    }
+
+    // Keeps the buckets. Only the buckets from the first occupied one to the last node are visited, so clearing
+    // a small table with many buckets stays cheap
+    void Clear()
+    {
+        for (size64 BucketIndex = FirstBucket; ElementCount > 0 && BucketIndex < BucketCount; ++BucketIndex)
+        {
+            FNode* CurrentNode = Buckets[BucketIndex];
+            while (CurrentNode != nullptr)
+            {
+                FNode* NextNode = CurrentNode->NextNode;
+                DestroyNode(CurrentNode);
+                CurrentNode = NextNode;
+                --ElementCount;
+            }
+            Buckets[BucketIndex] = nullptr;
+        }
+        ElementCount = 0;
+        FirstBucket = 0;
+    }
+
+    // Sizes the buckets and the node pool, so the next ExpectedElements inserts do not allocate
+    void Reserve(const size64 ExpectedElements)
+    {
+        if (ExpectedElements == 0)
+        {
+            return;
+        }
+        const size64 NeededBuckets = static_cast<size64>(static_cast<float64>(ExpectedElements) / MaxLoadFactor) + 1;
+        if (NeededBuckets > BucketCount)
+        {
+            Rehash(NeededBuckets);
+        }
+        NodePool.Resize(ExpectedElements);
+    }
+
+    void Swap(THashTable& Other) noexcept
+    {
+        std::swap(Buckets, Other.Buckets);
+        std::swap(BucketCount, Other.BucketCount);
+        std::swap(ElementCount, Other.ElementCount);
+        std::swap(FirstBucket, Other.FirstBucket);
+        std::swap(Hasher, Other.Hasher);
+        std::swap(Comparer, Other.Comparer);
+        std::swap(NodePool, Other.NodePool);
+    }
+
+public:
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return ElementCount;
+    }
+
+    [[nodiscard]] size64 GetBucketCount() const noexcept
+    {
+        return BucketCount;
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return ElementCount == 0;
+    }
+
+    [[nodiscard]] float64 GetLoadFactor() const noexcept
+    {
+        return BucketCount > 0 ? static_cast<float64>(ElementCount) / static_cast<float64>(BucketCount) : 0.0;
+    }
+
+    static constexpr float64 GetMaxLoadFactor() noexcept
+    {
+        return MaxLoadFactor;
+    }
+
+    [[nodiscard]] const THasher& GetHasher() const noexcept
+    {
+        return Hasher;
+    }
+
+    [[nodiscard]] const TComparer& GetComparer() const noexcept
+    {
+        return Comparer;
+    }
+
+public:
+    // Iterator Support
+    Iterator begin() noexcept
+    {
+        if (ElementCount == 0)
+        {
+            return end();
+        }
+        return Iterator(Buckets[FirstBucket], Buckets, BucketCount, FirstBucket);
+    }
+
+    ConstIterator begin() const noexcept
+    {
+        if (ElementCount == 0)
+        {
+            return end();
+        }
+        return ConstIterator(Buckets[FirstBucket], Buckets, BucketCount, FirstBucket);
+    }
+
+    Iterator end() noexcept
+    {
+        return Iterator(nullptr, Buckets, BucketCount, BucketCount);
+    }
+
+    ConstIterator end() const noexcept
+    {
+        return ConstIterator(nullptr, Buckets, BucketCount, BucketCount);
+    }
+
+    ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+private:
+    // Bucket counts are powers of two, so the bucket of a hash is its low bits
+    void InitializeBuckets(const size64 Count)
+    {
+        BucketCount = std::bit_ceil(Count);
+        Buckets = static_cast<FNode**>(FMemory::Allocate(BucketCount * sizeof(FNode*)));
+        for (size64 Index = 0; Index < BucketCount; ++Index)
+        {
+            Buckets[Index] = nullptr;
+        }
+    }
+
+    // Copies the chains of a table with the same bucket count as they are, without hashing a single key
+    void CopyNodes(const THashTable& Other)
+    {
+        assert(BucketCount == Other.BucketCount && ElementCount == 0 && "Cannot copy nodes into a differently sized table");
+        NodePool.Resize(Other.ElementCount);
+        for (size64 BucketIndex = Other.FirstBucket; BucketIndex < BucketCount; ++BucketIndex)
+        {
+            FNode** Link = &Buckets[BucketIndex];
+            for (const FNode* OtherNode = Other.Buckets[BucketIndex]; OtherNode != nullptr; OtherNode = OtherNode->NextNode)
+            {
+                *Link = NodePool.Allocate(nullptr, OtherNode->Data);
+                Link = &(*Link)->NextNode;
+            }
+        }
+        ElementCount = Other.ElementCount;
+        FirstBucket = Other.FirstBucket;
+    }
+
+    void DestroyAndDeallocate()
+    {
+        if (Buckets != nullptr)
+        {
+            Clear();
+            FMemory::Free(static_cast<void*>(Buckets));
+            Buckets = nullptr;
+        }
+        BucketCount = 0;
+        ElementCount = 0;
+    }
+
+    // First occupied bucket at or after StartBucket, BucketCount if there is none
+    size64 FindOccupiedBucket(size64 StartBucket) const
+    {
+        while (StartBucket < BucketCount && Buckets[StartBucket] == nullptr)
+        {
+            ++StartBucket;
+        }
+        return StartBucket;
+    }
+
+    // The cached first bucket only moves forward on removal, so the scans add up to one pass over the buckets
+    // between two inserts into an earlier bucket
+    void UpdateFirstBucketAfterRemove(const size64 BucketIndex)
+    {
+        if (ElementCount == 0)
+        {
+            FirstBucket = 0;
+        }
+        else if (BucketIndex == FirstBucket && Buckets[BucketIndex] == nullptr)
+        {
+            FirstBucket = FindOccupiedBucket(BucketIndex + 1);
+        }
+    }
+
+    void OnNodeLinked(const size64 BucketIndex)
+    {
+        if (ElementCount == 0 || BucketIndex < FirstBucket)
+        {
+            FirstBucket = BucketIndex;
+        }
+        ++ElementCount;
+    }
+
+    void DestroyNode(FNode* NodeToDestroy)
+    {
+        NodePool.Free(NodeToDestroy);
+    }
+
+    FNode* FindNode(const KeyType& Key, const size64 KeyHash) const
+    {
+        if (BucketCount == 0)
+        {
+            return nullptr;
+        }
+        for (FNode* CurrentNode = Buckets[KeyHash & (BucketCount - 1)]; CurrentNode != nullptr; CurrentNode = CurrentNode->NextNode)
+        {
+            if (Comparer(TKeyOf::Get(CurrentNode->Data), Key))
+            {
+                return CurrentNode;
+            }
+        }
+        return nullptr;
+    }
+
+    // Node after the run of elements equal to Key that starts at First, null when the run ends its chain
+    FNode* FindRunEnd(const FNode* First, const KeyType& Key) const
+    {
+        FNode* Last = First != nullptr ? First->NextNode : nullptr;
+        while (Last != nullptr && Comparer(TKeyOf::Get(Last->Data), Key))
+        {
+            Last = Last->NextNode;
+        }
+        return Last;
+    }
+
+    Iterator MakeIterator(FNode* Node, const size64 KeyHash)
+    {
+        return Iterator(Node, Buckets, BucketCount, KeyHash & (BucketCount - 1));
+    }
+
+    // Puts a constructed node at the head of its bucket, growing the buckets first if needed
+    Iterator LinkNode(FNode* NewNode, const size64 KeyHash)
+    {
+        CheckLoadFactorAndRehash();
+        const size64 BucketIndex = KeyHash & (BucketCount - 1);
+        NewNode->NextNode = Buckets[BucketIndex];
+        Buckets[BucketIndex] = NewNode;
+        OnNodeLinked(BucketIndex);
+        return Iterator(NewNode, Buckets, BucketCount, BucketIndex);
+    }
+
+    void CheckLoadFactorAndRehash()
+    {
+        if (BucketCount == 0)
+        {
+            InitializeBuckets(DefaultBucketCount);
+        }
+        else if (GetLoadFactor() > MaxLoadFactor)
+        {
+            Rehash(BucketCount * 2);
+        }
+    }
+
+    // Moving the nodes of a chain one by one to the heads of their new chains keeps runs of equal keys adjacent
+    void Rehash(const size64 NewBucketCount)
+    {
+        FNode** OldBuckets = Buckets;
+        const size64 OldBucketCount = BucketCount;
+        InitializeBuckets(NewBucketCount);
+        FirstBucket = BucketCount;
+        for (size64 BucketIndex = 0; BucketIndex < OldBucketCount; ++BucketIndex)
+        {
+            FNode* CurrentNode = OldBuckets[BucketIndex];
+            while (CurrentNode != nullptr)
+            {
+                FNode* NextNode = CurrentNode->NextNode;
+                const size64 NewBucketIndex = Hasher(TKeyOf::Get(CurrentNode->Data)) & (BucketCount - 1);
+                CurrentNode->NextNode = Buckets[NewBucketIndex];
+                Buckets[NewBucketIndex] = CurrentNode;
+                FirstBucket = NewBucketIndex < FirstBucket ? NewBucketIndex : FirstBucket;
+                CurrentNode = NextNode;
+            }
+        }
+        FirstBucket = ElementCount > 0 ? FirstBucket : 0;
+        FMemory::Free(static_cast<void*>(OldBuckets));
+    }
+
+private:
+    FNode** Buckets;
+    size64 BucketCount;
+    size64 ElementCount;
+    size64 FirstBucket;
+    THasher Hasher;
+    TComparer Comparer;
+    TMemoryPool<FNode> NodePool;
+};
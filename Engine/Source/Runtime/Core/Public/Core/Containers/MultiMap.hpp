@@ -0,0 +1,155 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/HashTable.hpp"
+#include "Core/Containers/RangeViews.hpp"
+
+// Hash map from a key to any number of values, on the same THashTable as TMap. Every value is a pooled node, so
+// adding one never allocates a per key array, and the values of a key are adjacent in iteration order, which
+// makes FindAll a plain iterator range. Values of one key come in no particular order
+template <CValidMapKey TKey, CValidMapValue TValue, typename THasher = THash<TKey>, typename TComparer = std::equal_to<TKey>>
+class TMultiMap : private THashTable<std::pair<const TKey, TValue>, TPairKeyOf<TKey, TValue>, THasher, TComparer>
+{
+    using Super = THashTable<std::pair<const TKey, TValue>, TPairKeyOf<TKey, TValue>, THasher, TComparer>;
+
+public:
+    using KeyType = TKey;
+    using ValueType = std::pair<const TKey, TValue>;
+    using MappedType = TValue;
+    using SizeType = size64;
+    using HasherType = THasher;
+    using ComparerType = TComparer;
+    using Iterator = typename Super::Iterator;
+    using ConstIterator = typename Super::ConstIterator;
+    using RunIterator = typename Super::RunIterator;
+    using ConstRunIterator = typename Super::ConstRunIterator;
+
+public:
+    constexpr TMultiMap() = default;
+
+    explicit TMultiMap(const size64 InBucketCount)
+        : Super(InBucketCount)
+    {
+    }
+
+    TMultiMap(std::initializer_list<ValueType> InInitializerList)
+    {
+        Super::Reserve(InInitializerList.size());
+        for (const auto& Pair : InInitializerList)
+        {
+            Insert(Pair);
+        }
+    }
+
+public:
+    TMultiMap& operator=(std::initializer_list<ValueType> InInitializerList)
+    {
+        Super::Clear();
+        for (const auto& Pair : InInitializerList)
+        {
+            Insert(Pair);
+        }
+        return *this;
+    }
+
+public:
+    Iterator Insert(const ValueType& Pair)
+    {
+        return Super::EmplaceMulti(Pair);
+    }
+
+    Iterator Insert(ValueType&& Pair)
+    {
+        return Super::EmplaceMulti(std::move(Pair));
+    }
+
+    // Adds one more value for Key, constructed from Arguments
+    template <typename TKeyArg, typename... TArguments>
+    Iterator Emplace(TKeyArg&& Key, TArguments&&... Arguments)
+        requires std::is_constructible_v<TKey, TKeyArg> && std::is_constructible_v<TValue, TArguments...>
+    {
+        return Super::EmplaceMulti(std::piecewise_construct, std::forward_as_tuple(std::forward<TKeyArg>(Key)),
+            std::forward_as_tuple(std::forward<TArguments>(Arguments)...));
+    }
+
+    // First of the values of Key
+    using Super::Find;
+    using Super::Contains;
+
+    // All values of Key, as a range of key value pairs. Its iterators only walk the run of Key, they cannot
+    // be passed to Remove
+    [[nodiscard]] Ranges::Views::TSubRange<RunIterator> FindAll(const TKey& Key)
+    {
+        const auto [First, Last] = Super::FindRange(Key);
+        return Ranges::Views::TSubRange<RunIterator>(First, Last);
+    }
+
+    [[nodiscard]] Ranges::Views::TSubRange<ConstRunIterator> FindAll(const TKey& Key) const
+    {
+        const auto [First, Last] = Super::FindRange(Key);
+        return Ranges::Views::TSubRange<ConstRunIterator>(First, Last);
+    }
+
+    [[nodiscard]] size64 Count(const TKey& Key) const
+    {
+        size64 NumValues = 0;
+        for (auto [First, Last] = Super::FindRange(Key); First != Last; ++First)
+        {
+            ++NumValues;
+        }
+        return NumValues;
+    }
+
+    // Removes every value of Key
+    size64 Remove(const TKey& Key)
+    {
+        return Super::Remove(Key);
+    }
+
+    // Removes the first value of Key that equals Value
+    size64 Remove(const TKey& Key, const TValue& Value) requires std::equality_comparable<TValue>
+    {
+        for (Iterator Position = Super::Find(Key); Position != end() && Super::GetComparer()(Position->first, Key); ++Position)
+        {
+            if (Position->second == Value)
+            {
+                Super::Remove(Position);
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    Iterator Remove(ConstIterator Position)
+    {
+        return Super::Remove(Position);
+    }
+
+    using Super::Clear;
+    using Super::Reserve;
+
+    void Swap(TMultiMap& Other) noexcept
+    {
+        Super::Swap(Other);
+    }
+
+public:
+    using Super::Num;
+    using Super::GetBucketCount;
+    using Super::IsEmpty;
+    using Super::GetLoadFactor;
+    using Super::GetMaxLoadFactor;
+
+public:
+    // Iterator Support
+    using Super::begin;
+    using Super::end;
+    using Super::cbegin;
+    using Super::cend;
+};
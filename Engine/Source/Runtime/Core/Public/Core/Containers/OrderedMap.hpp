@@ -0,0 +1,462 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "Core/Memory/Memory.hpp"
+
+// Hash map that keeps its entries in insertion order, in one dense TArray. A separate open addressed index maps
+// hashes to entry positions with slots of 8, 16 or 32 bits depending on the table size, so iterating is a linear
+// scan and the index costs a few bytes per entry. Inserting can move entries, which invalidates iterators and
+// element addresses, unlike TMap
+template <CValidMapKey TKey, CValidMapValue TValue, typename THasher = THash<TKey>, typename TComparer = std::equal_to<TKey>>
+class TOrderedMap
+{
+public:
+    using KeyType = TKey;
+    using ValueType = std::pair<const TKey, TValue>;
+    using MappedType = TValue;
+    using SizeType = size64;
+    using HasherType = THasher;
+    using ComparerType = TComparer;
+    using Iterator = ValueType*;
+    using ConstIterator = const ValueType*;
+
+private:
+    static constexpr size64 MinSlotCount = 8;
+    static constexpr size64 InvalidIndex = static_cast<size64>(-1);
+
+    // Linear probing stays short while at most half of the slots are used
+    static constexpr float64 MaxLoadFactor = 0.5;
+
+    // The largest table whose entry positions plus one still fit the slot type, zero marks an empty slot
+    template <typename TSlot>
+    static constexpr size64 MaxSlotCount = static_cast<size64>(std::numeric_limits<TSlot>::max()) + 1;
+
+public:
+    constexpr TOrderedMap() = default;
+
+    TOrderedMap(std::initializer_list<ValueType> InInitializerList)
+    {
+        Reserve(InInitializerList.size());
+        for (const auto& Pair : InInitializerList)
+        {
+            Insert(Pair);
+        }
+    }
+
+    TOrderedMap(const TOrderedMap& Other)
+        : Entries(Other.Entries), Hasher(Other.Hasher), Comparer(Other.Comparer)
+    {
+        if (Other.Slots != nullptr)
+        {
+            SlotCount = Other.SlotCount;
+            Slots = static_cast<uint8*>(FMemory::Allocate(GetIndexSize()));
+            FMemory::Copy(Other.Slots, Slots, GetIndexSize());
+        }
+    }
+
+    TOrderedMap(TOrderedMap&& Other) noexcept
+        : Entries(std::move(Other.Entries)), Slots(Other.Slots), SlotCount(Other.SlotCount), Hasher(std::move(Other.Hasher)),
+          Comparer(std::move(Other.Comparer))
+    {
+        Other.Slots = nullptr;
+        Other.SlotCount = 0;
+    }
+
+    ~TOrderedMap()
+    {
+        FMemory::Free(Slots);
+    }
+
+public:
+    TOrderedMap& operator=(const TOrderedMap& Other)
+    {
+        if (this != &Other)
+        {
+            TOrderedMap Copy(Other);
+            Swap(Copy);
+        }
+        return *this;
+    }
+
+    TOrderedMap& operator=(TOrderedMap&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            TOrderedMap Moved(std::move(Other));
+            Swap(Moved);
+        }
+        return *this;
+    }
+
+    TOrderedMap& operator=(std::initializer_list<ValueType> InInitializerList)
+    {
+        Clear();
+        Reserve(InInitializerList.size());
+        for (const auto& Pair : InInitializerList)
+        {
+            Insert(Pair);
+        }
+        return *this;
+    }
+
+    TValue& operator[](const TKey& Key) requires std::is_default_constructible_v<TValue>
+    {
+        return TryEmplace(Key).first->second;
+    }
+
+    TValue& operator[](TKey&& Key) requires std::is_default_constructible_v<TValue>
+    {
+        return TryEmplace(std::move(Key)).first->second;
+    }
+
+public:
+    std::pair<Iterator, bool8> Insert(const ValueType& Value)
+    {
+        return TryEmplaceImpl(Value.first, Value.second);
+    }
+
+    std::pair<Iterator, bool8> Insert(ValueType&& Value)
+    {
+        return TryEmplaceImpl(Value.first, std::move(Value.second));
+    }
+
+    // Appends Key with a value constructed from Arguments, unless Key is already present
+    template <typename... TArguments>
+    std::pair<Iterator, bool8> TryEmplace(const TKey& Key, TArguments&&... Arguments)
+    {
+        return TryEmplaceImpl(Key, std::forward<TArguments>(Arguments)...);
+    }
+
+    template <typename... TArguments>
+    std::pair<Iterator, bool8> TryEmplace(TKey&& Key, TArguments&&... Arguments)
+    {
+        return TryEmplaceImpl(std::move(Key), std::forward<TArguments>(Arguments)...);
+    }
+
+    [[nodiscard]] Iterator Find(const TKey& Key)
+    {
+        const size64 EntryIndex = FindEntryIndex(Key);
+        return EntryIndex != InvalidIndex ? Entries.GetData() + EntryIndex : end();
+    }
+
+    [[nodiscard]] ConstIterator Find(const TKey& Key) const
+    {
+        const size64 EntryIndex = FindEntryIndex(Key);
+        return EntryIndex != InvalidIndex ? Entries.GetData() + EntryIndex : end();
+    }
+
+    [[nodiscard]] bool8 Contains(const TKey& Key) const
+    {
+        return FindEntryIndex(Key) != InvalidIndex;
+    }
+
+    // Keeps the order of the remaining entries, so it shifts every later entry down and costs O(n)
+    size64 Remove(const TKey& Key)
+    {
+        const size64 EntryIndex = UnlinkEntry(Key);
+        if (EntryIndex == InvalidIndex)
+        {
+            return 0;
+        }
+        VisitSlots([&]<typename TSlot>(TSlot* SlotData)
+        {
+            const TSlot RemovedSlot = static_cast<TSlot>(EntryIndex + 1);
+            for (size64 SlotIndex = 0; SlotIndex < SlotCount; ++SlotIndex)
+            {
+                SlotData[SlotIndex] = static_cast<TSlot>(SlotData[SlotIndex] - (SlotData[SlotIndex] > RemovedSlot ? 1 : 0));
+            }
+        });
+        Entries.RemoveAt(EntryIndex);
+        return 1;
+    }
+
+    // Moves the last entry into the hole in O(1), which changes the iteration order
+    size64 RemoveSwap(const TKey& Key)
+    {
+        const size64 EntryIndex = UnlinkEntry(Key);
+        if (EntryIndex == InvalidIndex)
+        {
+            return 0;
+        }
+        const size64 LastIndex = Entries.Num() - 1;
+        if (EntryIndex != LastIndex)
+        {
+            VisitSlots([&]<typename TSlot>(TSlot* SlotData)
+            {
+                const size64 Mask = SlotCount - 1;
+                size64 SlotIndex = Hasher(Entries[LastIndex].first) & Mask;
+                while (SlotData[SlotIndex] != static_cast<TSlot>(LastIndex + 1))
+                {
+                    SlotIndex = (SlotIndex + 1) & Mask;
+                }
+                SlotData[SlotIndex] = static_cast<TSlot>(EntryIndex + 1);
+            });
+        }
+        Entries.RemoveAtSwap(EntryIndex);
+        return 1;
+    }
+
+    // Keeps the entry storage and the index
+    void Clear()
+    {
+        Entries.Clear();
+        if (Slots != nullptr)
+        {
+            FMemory::Set(Slots, 0, GetIndexSize());
+        }
+    }
+
+    void Reserve(const size64 ExpectedElements)
+    {
+        Entries.Reserve(ExpectedElements);
+        ReserveSlots(ExpectedElements);
+    }
+
+    void Swap(TOrderedMap& Other) noexcept
+    {
+        std::swap(Entries, Other.Entries);
+        std::swap(Slots, Other.Slots);
+        std::swap(SlotCount, Other.SlotCount);
+        std::swap(Hasher, Other.Hasher);
+        std::swap(Comparer, Other.Comparer);
+    }
+
+public:
+    // Entry at Position in insertion order
+    [[nodiscard]] ValueType& At(const size64 Position)
+    {
+        return Entries.At(Position);
+    }
+
+    [[nodiscard]] const ValueType& At(const size64 Position) const
+    {
+        return Entries.At(Position);
+    }
+
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Entries.Num();
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return Entries.IsEmpty();
+    }
+
+    [[nodiscard]] size64 GetSlotCount() const noexcept
+    {
+        return SlotCount;
+    }
+
+    // Bytes held by the entries and the index
+    [[nodiscard]] size64 GetAllocatedSize() const noexcept
+    {
+        return Entries.GetCapacityInBytes() + GetIndexSize();
+    }
+
+    static constexpr float64 GetMaxLoadFactor() noexcept
+    {
+        return MaxLoadFactor;
+    }
+
+public:
+    // Iterator Support
+    [[nodiscard]] Iterator begin() noexcept
+    {
+        return Entries.begin();
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept
+    {
+        return Entries.begin();
+    }
+
+    [[nodiscard]] Iterator end() noexcept
+    {
+        return Entries.end();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept
+    {
+        return Entries.end();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+private:
+    [[nodiscard]] size64 GetSlotSize() const noexcept
+    {
+        return SlotCount <= MaxSlotCount<uint8> ? sizeof(uint8) : SlotCount <= MaxSlotCount<uint16> ? sizeof(uint16) : sizeof(uint32);
+    }
+
+    [[nodiscard]] size64 GetIndexSize() const noexcept
+    {
+        return SlotCount * GetSlotSize();
+    }
+
+    // Calls Function with the slots viewed as the narrowest type that fits the table
+    template <typename TFunction>
+    decltype(auto) VisitSlots(TFunction&& Function) const
+    {
+        if (SlotCount <= MaxSlotCount<uint8>)
+        {
+            return Function(reinterpret_cast<uint8*>(Slots));
+        }
+        if (SlotCount <= MaxSlotCount<uint16>)
+        {
+            return Function(reinterpret_cast<uint16*>(Slots));
+        }
+        return Function(reinterpret_cast<uint32*>(Slots));
+    }
+
+    [[nodiscard]] size64 FindEntryIndex(const TKey& Key) const
+    {
+        if (Entries.IsEmpty())
+        {
+            return InvalidIndex;
+        }
+        return VisitSlots([&]<typename TSlot>(const TSlot* SlotData)
+        {
+            const size64 Mask = SlotCount - 1;
+            for (size64 SlotIndex = Hasher(Key) & Mask; SlotData[SlotIndex] != 0; SlotIndex = (SlotIndex + 1) & Mask)
+            {
+                const size64 EntryIndex = SlotData[SlotIndex] - 1;
+                if (Comparer(Entries[EntryIndex].first, Key))
+                {
+                    return EntryIndex;
+                }
+            }
+            return InvalidIndex;
+        });
+    }
+
+    template <typename TKeyArg, typename... TArguments>
+    std::pair<Iterator, bool8> TryEmplaceImpl(TKeyArg&& Key, TArguments&&... Arguments)
+    {
+        ReserveSlots(Entries.Num() + 1);
+        const size64 EntryIndex = Entries.Num();
+        const size64 FoundIndex = VisitSlots([&]<typename TSlot>(TSlot* SlotData)
+        {
+            const size64 Mask = SlotCount - 1;
+            size64 SlotIndex = Hasher(Key) & Mask;
+            for (; SlotData[SlotIndex] != 0; SlotIndex = (SlotIndex + 1) & Mask)
+            {
+                if (Comparer(Entries[SlotData[SlotIndex] - 1].first, Key))
+                {
+                    return static_cast<size64>(SlotData[SlotIndex] - 1);
+                }
+            }
+            SlotData[SlotIndex] = static_cast<TSlot>(EntryIndex + 1);
+            return InvalidIndex;
+        });
+        if (FoundIndex != InvalidIndex)
+        {
+            return std::make_pair(Entries.GetData() + FoundIndex, false);
+        }
+        Entries.EmplaceBack(std::piecewise_construct, std::forward_as_tuple(std::forward<TKeyArg>(Key)),
+            std::forward_as_tuple(std::forward<TArguments>(Arguments)...));
+        return std::make_pair(Entries.GetData() + EntryIndex, true);
+    }
+
+    // Takes the slot of Key out of the index and returns the position of its entry, which is left in place.
+    // Later slots of the probe run move back into the hole, so lookups never need tombstones
+    size64 UnlinkEntry(const TKey& Key)
+    {
+        if (Entries.IsEmpty())
+        {
+            return InvalidIndex;
+        }
+        return VisitSlots([&]<typename TSlot>(TSlot* SlotData)
+        {
+            const size64 Mask = SlotCount - 1;
+            size64 HoleIndex = Hasher(Key) & Mask;
+            for (; SlotData[HoleIndex] != 0; HoleIndex = (HoleIndex + 1) & Mask)
+            {
+                if (Comparer(Entries[SlotData[HoleIndex] - 1].first, Key))
+                {
+                    break;
+                }
+            }
+            if (SlotData[HoleIndex] == 0)
+            {
+                return InvalidIndex;
+            }
+
+            const size64 EntryIndex = SlotData[HoleIndex] - 1;
+            for (size64 SlotIndex = (HoleIndex + 1) & Mask; SlotData[SlotIndex] != 0; SlotIndex = (SlotIndex + 1) & Mask)
+            {
+                // A slot may fill the hole unless its home lies cyclically after the hole
+                const size64 HomeIndex = Hasher(Entries[SlotData[SlotIndex] - 1].first) & Mask;
+                if (((SlotIndex - HomeIndex) & Mask) >= ((SlotIndex - HoleIndex) & Mask))
+                {
+                    SlotData[HoleIndex] = SlotData[SlotIndex];
+                    HoleIndex = SlotIndex;
+                }
+            }
+            SlotData[HoleIndex] = 0;
+            return EntryIndex;
+        });
+    }
+
+    // Grows the index so that ExpectedElements stay under the load factor
+    void ReserveSlots(const size64 ExpectedElements)
+    {
+        if (ExpectedElements == 0)
+        {
+            return;
+        }
+        const size64 NeededSlots = std::bit_ceil(static_cast<size64>(static_cast<float64>(ExpectedElements) / MaxLoadFactor));
+        if (NeededSlots > SlotCount)
+        {
+            RebuildIndex(NeededSlots > MinSlotCount ? NeededSlots : MinSlotCount);
+        }
+    }
+
+    void RebuildIndex(const size64 NewSlotCount)
+    {
+        assert(NewSlotCount <= MaxSlotCount<uint32> && "Ordered map index is out of 32 bit slots");
+        FMemory::Free(Slots);
+        SlotCount = NewSlotCount;
+        Slots = static_cast<uint8*>(FMemory::Allocate(GetIndexSize()));
+        FMemory::Set(Slots, 0, GetIndexSize());
+        VisitSlots([&]<typename TSlot>(TSlot* SlotData)
+        {
+            const size64 Mask = SlotCount - 1;
+            for (size64 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+            {
+                size64 SlotIndex = Hasher(Entries[EntryIndex].first) & Mask;
+                while (SlotData[SlotIndex] != 0)
+                {
+                    SlotIndex = (SlotIndex + 1) & Mask;
+                }
+                SlotData[SlotIndex] = static_cast<TSlot>(EntryIndex + 1);
+            }
+        });
+    }
+
+private:
+    TArray<ValueType> Entries;
+    uint8* Slots = nullptr;
+    size64 SlotCount = 0;
+    THasher Hasher;
+    TComparer Comparer;
+};
@@ -0,0 +1,435 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/HandlePool.hpp"
+
+namespace PriorityQueue::Private
+{
+    // Moves the entry at Index towards the root until its parent does not come after it. The entry is held aside
+    // and every parent it passes moves down one level, OnPlaced(Entry, Index) reports every new position
+    template <size64 Arity, typename TEntry, typename TLess, typename TOnPlaced>
+    constexpr void SiftUp(TEntry* Entries, size64 Index, const TLess& Less, const TOnPlaced& OnPlaced)
+    {
+        TEntry Moving = std::move(Entries[Index]);
+        while (Index > 0)
+        {
+            const size64 Parent = (Index - 1) / Arity;
+            if (!Less(Moving, Entries[Parent]))
+            {
+                break;
+            }
+            Entries[Index] = std::move(Entries[Parent]);
+            OnPlaced(Entries[Index], Index);
+            Index = Parent;
+        }
+        Entries[Index] = std::move(Moving);
+        OnPlaced(Entries[Index], Index);
+    }
+
+    // Picks A or B by arithmetic rather than a branch or a ternary, compilers turn both of those into jumps and the
+    // outcome of comparisons between siblings is random, so those jumps would mostly mispredict
+    [[nodiscard]] constexpr size64 SelectIndex(const bool8 bPickB, const size64 A, const size64 B)
+    {
+        return A + ((B - A) & (size64(0) - size64(bPickB)));
+    }
+
+    // Index of the entry among Count adjacent ones from First that sorts first. Halves are decided independently and
+    // then compared, a tournament whose chain of dependent comparisons is log2(Count) long instead of Count - 1
+    template <size64 Count, typename TEntry, typename TLess>
+    [[nodiscard]] constexpr size64 FindFirstOf(const TEntry* Entries, const size64 First, const TLess& Less)
+    {
+        if constexpr (Count == 1)
+        {
+            return First;
+        }
+        else
+        {
+            const size64 A = FindFirstOf<Count / 2>(Entries, First, Less);
+            const size64 B = FindFirstOf<Count - Count / 2>(Entries, First + Count / 2, Less);
+            return SelectIndex(Less(Entries[B], Entries[A]), A, B);
+        }
+    }
+
+    // Index of the child of Parent that sorts first. Only the last node with children can have fewer than Arity
+    template <size64 Arity, typename TEntry, typename TLess>
+    [[nodiscard]] constexpr size64 FindFirstChild(const TEntry* Entries, const size64 NumEntries, const size64 Parent, const TLess& Less)
+    {
+        const size64 FirstChild = Parent * Arity + 1;
+        if (FirstChild + Arity <= NumEntries)
+        {
+            return FindFirstOf<Arity>(Entries, FirstChild, Less);
+        }
+
+        size64 BestChild = FirstChild;
+        for (size64 Child = FirstChild + 1; Child < NumEntries; ++Child)
+        {
+            BestChild = SelectIndex(Less(Entries[Child], Entries[BestChild]), BestChild, Child);
+        }
+        return BestChild;
+    }
+
+    // Moves the entry at Index towards the leaves, trading places with the child that sorts first while that child
+    // comes before it. The children of a node are adjacent, so finding it touches one or two cache lines
+    template <size64 Arity, typename TEntry, typename TLess, typename TOnPlaced>
+    constexpr void SiftDown(TEntry* Entries, const size64 NumEntries, size64 Index, const TLess& Less, const TOnPlaced& OnPlaced)
+    {
+        TEntry Moving = std::move(Entries[Index]);
+        while (Index * Arity + 1 < NumEntries)
+        {
+            const size64 BestChild = FindFirstChild<Arity>(Entries, NumEntries, Index, Less);
+            if (!Less(Entries[BestChild], Moving))
+            {
+                break;
+            }
+            Entries[Index] = std::move(Entries[BestChild]);
+            OnPlaced(Entries[Index], Index);
+            Index = BestChild;
+        }
+        Entries[Index] = std::move(Moving);
+        OnPlaced(Entries[Index], Index);
+    }
+
+    // Fills the hole at Index with the entry at the end of the heap, which is removed from it. The hole first sinks
+    // to a leaf along the children that sort first, then the last entry rises from there. The last entry nearly
+    // always belongs close to the leaves, so this skips the comparison against it on the way down that SiftDown
+    // makes on every level
+    template <size64 Arity, typename TEntry, typename TLess, typename TOnPlaced>
+    constexpr void FillHoleFromBack(TEntry* Entries, const size64 NumEntries, size64 Index, const TLess& Less, const TOnPlaced& OnPlaced)
+    {
+        const size64 LastIndex = NumEntries - 1;
+        while (Index * Arity + 1 < LastIndex)
+        {
+            const size64 BestChild = FindFirstChild<Arity>(Entries, LastIndex, Index, Less);
+            Entries[Index] = std::move(Entries[BestChild]);
+            OnPlaced(Entries[Index], Index);
+            Index = BestChild;
+        }
+        if (Index != LastIndex)
+        {
+            Entries[Index] = std::move(Entries[LastIndex]);
+            SiftUp<Arity>(Entries, Index, Less, OnPlaced);
+        }
+    }
+
+    struct FIgnorePlacement
+    {
+        template <typename TEntry>
+        constexpr void operator()(const TEntry&, const size64) const noexcept
+        {
+        }
+    };
+}
+
+// Priority queue on an implicit d-ary heap in a TArray. Top is the element that sorts first under TLess, so with
+// the default std::less<> elements come out in ascending order like Ranges::Sort would leave them; use
+// std::greater<> to get the largest first. Four children per node halve the depth of a binary heap and keep
+// every set of siblings within one or two cache lines, which pays off on Pop where most of the time goes
+template <typename TElement, typename TLess = std::less<>, size64 TArity = 4>
+    requires std::is_object_v<TElement> && std::is_move_constructible_v<TElement> && std::is_move_assignable_v<TElement> && (TArity >= 2)
+class TPriorityQueue
+{
+public:
+    using ValueType = TElement;
+
+    static constexpr size64 Arity = TArity;
+
+public:
+    TPriorityQueue() = default;
+
+    explicit TPriorityQueue(const TLess& InLess)
+        : Less(InLess)
+    {
+    }
+
+    // Builds the heap bottom up in O(n) instead of n pushes
+    explicit TPriorityQueue(std::span<const TElement> InElements, const TLess& InLess = TLess()) requires std::is_copy_constructible_v<TElement>
+        : Less(InLess)
+    {
+        Elements.Append(InElements);
+        if (Elements.Num() > 1)
+        {
+            // From the last node that has children back to the root
+            for (size64 Index = (Elements.Num() - 2) / TArity + 1; Index-- > 0;)
+            {
+                PriorityQueue::Private::SiftDown<TArity>(Elements.GetData(), Elements.Num(), Index, Less, PriorityQueue::Private::FIgnorePlacement());
+            }
+        }
+    }
+
+public:
+    void Push(const TElement& InValue)
+    {
+        Emplace(InValue);
+    }
+
+    void Push(TElement&& InValue)
+    {
+        Emplace(std::move(InValue));
+    }
+
+    template <typename... TArguments> requires std::is_constructible_v<TElement, TArguments...>
+    void Emplace(TArguments&&... Arguments)
+    {
+        Elements.EmplaceBack(std::forward<TArguments>(Arguments)...);
+        PriorityQueue::Private::SiftUp<TArity>(Elements.GetData(), Elements.Num() - 1, Less, PriorityQueue::Private::FIgnorePlacement());
+    }
+
+    [[nodiscard]] const TElement& Top() const
+    {
+        assert(!Elements.IsEmpty() && "Cannot get top of empty priority queue");
+        return Elements[0];
+    }
+
+    void Pop()
+    {
+        assert(!Elements.IsEmpty() && "Cannot pop from empty priority queue");
+        PriorityQueue::Private::FillHoleFromBack<TArity>(Elements.GetData(), Elements.Num(), 0, Less, PriorityQueue::Private::FIgnorePlacement());
+        Elements.PopBack();
+    }
+
+    // Removes the top element and returns it
+    [[nodiscard]] TElement PopTop()
+    {
+        assert(!Elements.IsEmpty() && "Cannot pop from empty priority queue");
+        TElement Result = std::move(Elements[0]);
+        Pop();
+        return Result;
+    }
+
+    void Reserve(const size64 NewCapacity)
+    {
+        Elements.Reserve(NewCapacity);
+    }
+
+    void Clear()
+    {
+        Elements.Clear();
+    }
+
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Elements.Num();
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return Elements.IsEmpty();
+    }
+
+public:
+    // Iterates the elements in heap order, which is not sorted beyond the first one
+    [[nodiscard]] const TElement* begin() const noexcept
+    {
+        return Elements.begin();
+    }
+
+    [[nodiscard]] const TElement* end() const noexcept
+    {
+        return Elements.end();
+    }
+
+private:
+    TArray<TElement> Elements;
+    TLess Less;
+};
+
+// Priority queue whose elements can be changed or removed after they were pushed, for Dijkstra and A* style
+// searches that lower the cost of queued nodes and for schedulers that cancel timers. Push returns a handle like
+// THandlePool does, THandleSlots map it to the element's position in the heap, kept up to date as elements
+// move. DecreaseKey, Update and Remove are O(log n), stale handles are detected by their generation
+template <typename TElement, typename TLess = std::less<>, size64 TArity = 4, typename THandleType = FHandle64>
+    requires std::is_object_v<TElement> && std::is_move_constructible_v<TElement> && std::is_move_assignable_v<TElement> && (TArity >= 2)
+class TIndexedPriorityQueue
+{
+public:
+    using ValueType = TElement;
+    using HandleType = THandleType;
+
+    static constexpr size64 Arity = TArity;
+
+private:
+    struct FEntry
+    {
+        TElement Element;
+        uint32 SlotIndex;
+    };
+
+public:
+    TIndexedPriorityQueue() = default;
+
+    explicit TIndexedPriorityQueue(const TLess& InLess)
+        : Less(InLess)
+    {
+    }
+
+public:
+    HandleType Push(const TElement& InValue)
+    {
+        return Emplace(InValue);
+    }
+
+    HandleType Push(TElement&& InValue)
+    {
+        return Emplace(std::move(InValue));
+    }
+
+    template <typename... TArguments> requires std::is_constructible_v<TElement, TArguments...>
+    HandleType Emplace(TArguments&&... Arguments)
+    {
+        const HandleType Handle = Slots.Acquire(static_cast<uint32>(Entries.Num()));
+        Entries.PushBack(FEntry{TElement(std::forward<TArguments>(Arguments)...), Handle.GetIndex()});
+        SiftUp(Entries.Num() - 1);
+        return Handle;
+    }
+
+    [[nodiscard]] const TElement& Top() const
+    {
+        assert(!Entries.IsEmpty() && "Cannot get top of empty priority queue");
+        return Entries[0].Element;
+    }
+
+    [[nodiscard]] HandleType GetTopHandle() const
+    {
+        assert(!Entries.IsEmpty() && "Cannot get top of empty priority queue");
+        return Slots.GetHandle(Entries[0].SlotIndex);
+    }
+
+    void Pop()
+    {
+        assert(!Entries.IsEmpty() && "Cannot pop from empty priority queue");
+        RemoveAt(0);
+    }
+
+    // Removes the top element and returns it
+    [[nodiscard]] TElement PopTop()
+    {
+        assert(!Entries.IsEmpty() && "Cannot pop from empty priority queue");
+        TElement Result = std::move(Entries[0].Element);
+        RemoveAt(0);
+        return Result;
+    }
+
+    // Replaces the element with one that sorts no later, which can only move it towards the top
+    void DecreaseKey(const HandleType Handle, TElement NewValue)
+    {
+        assert(Contains(Handle) && "Stale or invalid handle");
+        const uint32 HeapIndex = Slots.GetTarget(Handle.GetIndex());
+        assert(!Less(Entries[HeapIndex].Element, NewValue) && "DecreaseKey would move the element away from the top, use Update");
+        Entries[HeapIndex].Element = std::move(NewValue);
+        SiftUp(HeapIndex);
+    }
+
+    // Replaces the element with any value and moves it whichever way it has to go
+    void Update(const HandleType Handle, TElement NewValue)
+    {
+        assert(Contains(Handle) && "Stale or invalid handle");
+        const uint32 HeapIndex = Slots.GetTarget(Handle.GetIndex());
+        const bool8 bMovesUp = Less(NewValue, Entries[HeapIndex].Element);
+        Entries[HeapIndex].Element = std::move(NewValue);
+        bMovesUp ? SiftUp(HeapIndex) : SiftDown(HeapIndex);
+    }
+
+    // Returns false if the handle is stale or invalid
+    bool8 Remove(const HandleType Handle)
+    {
+        if (!Contains(Handle))
+        {
+            return false;
+        }
+        RemoveAt(Slots.GetTarget(Handle.GetIndex()));
+        return true;
+    }
+
+    [[nodiscard]] bool8 Contains(const HandleType Handle) const noexcept
+    {
+        return Slots.Contains(Handle);
+    }
+
+    [[nodiscard]] const TElement* Find(const HandleType Handle) const noexcept
+    {
+        return Contains(Handle) ? &Entries[Slots.GetTarget(Handle.GetIndex())].Element : nullptr;
+    }
+
+    [[nodiscard]] const TElement& operator[](const HandleType Handle) const
+    {
+        assert(Contains(Handle) && "Stale or invalid handle");
+        return Entries[Slots.GetTarget(Handle.GetIndex())].Element;
+    }
+
+    // Invalidates every issued handle but keeps the slots, their generations move on
+    void Clear()
+    {
+        for (const FEntry& Entry : Entries)
+        {
+            Slots.Release(Entry.SlotIndex);
+        }
+        Entries.Clear();
+    }
+
+    void Reserve(const size64 NewCapacity)
+    {
+        Entries.Reserve(NewCapacity);
+        Slots.Reserve(NewCapacity);
+    }
+
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Entries.Num();
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return Entries.IsEmpty();
+    }
+
+private:
+    void SiftUp(const size64 HeapIndex)
+    {
+        PriorityQueue::Private::SiftUp<TArity>(Entries.GetData(), HeapIndex, GetEntryLess(), GetPlacement());
+    }
+
+    void SiftDown(const size64 HeapIndex)
+    {
+        PriorityQueue::Private::SiftDown<TArity>(Entries.GetData(), Entries.Num(), HeapIndex, GetEntryLess(), GetPlacement());
+    }
+
+    [[nodiscard]] auto GetEntryLess() const noexcept
+    {
+        return [this](const FEntry& A, const FEntry& B) { return Less(A.Element, B.Element); };
+    }
+
+    [[nodiscard]] auto GetPlacement() noexcept
+    {
+        return [this](const FEntry& Entry, const size64 HeapIndex) { Slots.SetTarget(Entry.SlotIndex, static_cast<uint32>(HeapIndex)); };
+    }
+
+    // Fills the hole with the last entry, which then moves up or down from there
+    void RemoveAt(const size64 HeapIndex)
+    {
+        Slots.Release(Entries[HeapIndex].SlotIndex);
+        const size64 LastIndex = Entries.Num() - 1;
+        if (HeapIndex > 0 && HeapIndex != LastIndex && Less(Entries[LastIndex].Element, Entries[(HeapIndex - 1) / TArity].Element))
+        {
+            Entries[HeapIndex] = std::move(Entries[LastIndex]);
+            SiftUp(HeapIndex);
+        }
+        else
+        {
+            PriorityQueue::Private::FillHoleFromBack<TArity>(Entries.GetData(), Entries.Num(), HeapIndex, GetEntryLess(), GetPlacement());
+        }
+        Entries.PopBack();
+    }
+
+private:
+    TArray<FEntry> Entries;
+    THandleSlots<HandleType> Slots;
+    TLess Less;
+};
@@ -0,0 +1,796 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Ranges.hpp"
+
+// Lazy views over any CRangeWithValueType (TArray, TStaticArray, TQueue, TMap, other views). Views never
+// own elements: containers are referenced, nested views are stored by value, so a whole pipeline is a
+// single object on the stack and iterating it inlines down to the underlying iterator loop.
+//
+//     for (const int32 Value : Array | Views::Filter(IsEven) | Views::Map(Square) | Views::Take(10))
+//
+// Views must not outlive the containers they reference
+template <typename TView>
+concept CRangeView = requires
+{
+    { TView::bIsRangeView } -> std::convertible_to<bool8>;
+} && TView::bIsRangeView;
+
+template <typename TRange>
+concept CViewableRange = CRangeWithValueType<std::remove_cvref_t<TRange>> &&
+    (CRangeView<std::remove_cvref_t<TRange>> || std::is_lvalue_reference_v<TRange>);
+
+namespace Ranges::Views
+{
+    namespace Private
+    {
+        template <typename TRange>
+        class TRangeReference
+        {
+        public:
+            static constexpr bool8 bIsRangeView = true;
+            using ValueType = typename std::remove_const_t<TRange>::ValueType;
+
+        public:
+            constexpr explicit TRangeReference(TRange& InRange) noexcept
+                : Range(&InRange)
+            {
+            }
+
+        public:
+            [[nodiscard]] constexpr auto begin() const
+            {
+                return Range->begin();
+            }
+
+            [[nodiscard]] constexpr auto end() const
+            {
+                return Range->end();
+            }
+
+        private:
+            TRange* Range;
+        };
+
+        template <typename TRange>
+        [[nodiscard]] constexpr auto MakeStorage(TRange&& Range)
+        {
+            if constexpr (CRangeView<std::remove_cvref_t<TRange>>)
+            {
+                return std::remove_cvref_t<TRange>(std::forward<TRange>(Range));
+            }
+            else
+            {
+                return TRangeReference<std::remove_reference_t<TRange>>(Range);
+            }
+        }
+
+        template <typename TRange>
+        using TStorage = decltype(MakeStorage(std::declval<TRange>()));
+
+        template <typename TBase>
+        using TIteratorOf = decltype(std::declval<const TBase&>().begin());
+
+        template <typename TIterator>
+        using TReferenceOf = decltype(*std::declval<const TIterator&>());
+
+        // Advances at most Count steps without passing End, jumping directly for random access iterators
+        template <typename TIterator>
+        [[nodiscard]] constexpr TIterator AdvanceBounded(TIterator Current, const TIterator& End, size64 Count)
+        {
+            if constexpr (std::random_access_iterator<TIterator>)
+            {
+                const size64 Remaining = static_cast<size64>(End - Current);
+                return Current + static_cast<ptrdiff_t>(Count < Remaining ? Count : Remaining);
+            }
+            else
+            {
+                while (Count > 0 && Current != End)
+                {
+                    ++Current;
+                    --Count;
+                }
+                return Current;
+            }
+        }
+    }
+
+    template <typename TIterator>
+    class TSubRange
+    {
+    public:
+        static constexpr bool8 bIsRangeView = true;
+        using ValueType = std::iter_value_t<TIterator>;
+
+    public:
+        constexpr TSubRange() = default;
+
+        constexpr TSubRange(TIterator InFirst, TIterator InLast)
+            : First(InFirst), Last(InLast)
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr TIterator begin() const
+        {
+            return First;
+        }
+
+        [[nodiscard]] constexpr TIterator end() const
+        {
+            return Last;
+        }
+
+    private:
+        TIterator First{};
+        TIterator Last{};
+    };
+
+    template <typename TBase, typename TPredicate>
+    class TFilterView
+    {
+    public:
+        static constexpr bool8 bIsRangeView = true;
+        using ValueType = typename TBase::ValueType;
+        using BaseIterator = Private::TIteratorOf<TBase>;
+
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ValueType;
+            using difference_type = ptrdiff_t;
+            using reference = Private::TReferenceOf<BaseIterator>;
+
+        public:
+            constexpr Iterator() = default;
+
+            constexpr Iterator(const BaseIterator InCurrent, const BaseIterator InEnd, const TPredicate* InPredicate)
+                : Current(InCurrent), End(InEnd), Predicate(InPredicate)
+            {
+                SkipRejected();
+            }
+
+        public:
+            constexpr reference operator*() const
+            {
+                return *Current;
+            }
+
+            constexpr Iterator& operator++()
+            {
+                ++Current;
+                SkipRejected();
+                return *this;
+            }
+
+            constexpr Iterator operator++(int)
+            {
+                Iterator Temp = *this;
+                ++(*this);
+                return Temp;
+            }
+
+            constexpr bool8 operator==(const Iterator& Other) const
+            {
+                return Current == Other.Current;
+            }
+
+        private:
+            constexpr void SkipRejected()
+            {
+                while (Current != End && !std::invoke(*Predicate, *Current))
+                {
+                    ++Current;
+                }
+            }
+
+        private:
+            BaseIterator Current{};
+            BaseIterator End{};
+            const TPredicate* Predicate = nullptr;
+        };
+
+    public:
+        constexpr TFilterView(TBase InBase, TPredicate InPredicate)
+            : Base(std::move(InBase)), Predicate(std::move(InPredicate))
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr Iterator begin() const
+        {
+            return Iterator(Base.begin(), Base.end(), &Predicate);
+        }
+
+        [[nodiscard]] constexpr Iterator end() const
+        {
+            return Iterator(Base.end(), Base.end(), &Predicate);
+        }
+
+    private:
+        TBase Base;
+        TPredicate Predicate;
+    };
+
+    template <typename TBase, typename TFunction>
+    class TMapView
+    {
+    public:
+        static constexpr bool8 bIsRangeView = true;
+        using BaseIterator = Private::TIteratorOf<TBase>;
+        using ResultType = std::invoke_result_t<const TFunction&, Private::TReferenceOf<BaseIterator>>;
+        using ValueType = std::remove_cvref_t<ResultType>;
+
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = ValueType;
+            using difference_type = ptrdiff_t;
+            using reference = ResultType;
+
+        public:
+            constexpr Iterator() = default;
+
+            constexpr Iterator(const BaseIterator InCurrent, const TFunction* InFunction)
+                : Current(InCurrent), Function(InFunction)
+            {
+            }
+
+        public:
+            constexpr reference operator*() const
+            {
+                return std::invoke(*Function, *Current);
+            }
+
+            constexpr Iterator& operator++()
+            {
+                ++Current;
+                return *this;
+            }
+
+            constexpr Iterator operator++(int)
+            {
+                Iterator Temp = *this;
+                ++Current;
+                return Temp;
+            }
+
+            constexpr bool8 operator==(const Iterator& Other) const
+            {
+                return Current == Other.Current;
+            }
+
+        private:
+            BaseIterator Current{};
+            const TFunction* Function = nullptr;
+        };
+
+    public:
+        constexpr TMapView(TBase InBase, TFunction InFunction)
+            : Base(std::move(InBase)), Function(std::move(InFunction))
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr Iterator begin() const
+        {
+            return Iterator(Base.begin(), &Function);
+        }
+
+        [[nodiscard]] constexpr Iterator end() const
+        {
+            return Iterator(Base.end(), &Function);
+        }
+
+    private:
+        TBase Base;
+        TFunction Function;
+    };
+
+    template <typename TBase>
+    class TTakeView
+    {
+    public:
+        static constexpr bool8 bIsRangeView = true;
+        using ValueType = typename TBase::ValueType;
+        using BaseIterator = Private::TIteratorOf<TBase>;
+
+        // Only used for bases without random access, those have their end computed up front instead
+        class FCountedIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ValueType;
+            using difference_type = ptrdiff_t;
+            using reference = Private::TReferenceOf<BaseIterator>;
+
+        public:
+            constexpr FCountedIterator() = default;
+
+            constexpr FCountedIterator(const BaseIterator InCurrent, const BaseIterator InEnd, const size64 InRemaining)
+                : Current(InCurrent), End(InEnd), Remaining(InRemaining)
+            {
+            }
+
+        public:
+            constexpr reference operator*() const
+            {
+                return *Current;
+            }
+
+            // The last step leaves the base iterator alone, a filtered base would otherwise scan ahead for nothing
+            constexpr FCountedIterator& operator++()
+            {
+                if (--Remaining > 0)
+                {
+                    ++Current;
+                }
+                return *this;
+            }
+
+            constexpr FCountedIterator operator++(int)
+            {
+                FCountedIterator Temp = *this;
+                ++(*this);
+                return Temp;
+            }
+
+            constexpr bool8 operator==(const FCountedIterator& Other) const
+            {
+                const bool8 bIsEnd = Remaining == 0 || Current == End;
+                const bool8 bOtherIsEnd = Other.Remaining == 0 || Other.Current == Other.End;
+                return bIsEnd || bOtherIsEnd ? bIsEnd == bOtherIsEnd : Current == Other.Current;
+            }
+
+        private:
+            BaseIterator Current{};
+            BaseIterator End{};
+            size64 Remaining = 0;
+        };
+
+        using Iterator = std::conditional_t<std::random_access_iterator<BaseIterator>, BaseIterator, FCountedIterator>;
+
+    public:
+        constexpr TTakeView(TBase InBase, const size64 InCount)
+            : Base(std::move(InBase)), Count(InCount)
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr Iterator begin() const
+        {
+            if constexpr (std::random_access_iterator<BaseIterator>)
+            {
+                return Base.begin();
+            }
+            else
+            {
+                return FCountedIterator(Base.begin(), Base.end(), Count);
+            }
+        }
+
+        [[nodiscard]] constexpr Iterator end() const
+        {
+            if constexpr (std::random_access_iterator<BaseIterator>)
+            {
+                return Private::AdvanceBounded(Base.begin(), Base.end(), Count);
+            }
+            else
+            {
+                return FCountedIterator(Base.end(), Base.end(), 0);
+            }
+        }
+
+    private:
+        TBase Base;
+        size64 Count;
+    };
+
+    template <typename TBase>
+    class TDropView
+    {
+    public:
+        static constexpr bool8 bIsRangeView = true;
+        using ValueType = typename TBase::ValueType;
+        using BaseIterator = Private::TIteratorOf<TBase>;
+
+    public:
+        constexpr TDropView(TBase InBase, const size64 InCount)
+            : Base(std::move(InBase)), Count(InCount)
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr BaseIterator begin() const
+        {
+            return Private::AdvanceBounded(Base.begin(), Base.end(), Count);
+        }
+
+        [[nodiscard]] constexpr BaseIterator end() const
+        {
+            return Base.end();
+        }
+
+    private:
+        TBase Base;
+        size64 Count;
+    };
+
+    template <typename TBaseA, typename TBaseB>
+    class TZipView
+    {
+    public:
+        static constexpr bool8 bIsRangeView = true;
+        using ValueType = std::pair<typename TBaseA::ValueType, typename TBaseB::ValueType>;
+        using BaseIteratorA = Private::TIteratorOf<TBaseA>;
+        using BaseIteratorB = Private::TIteratorOf<TBaseB>;
+
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = ValueType;
+            using difference_type = ptrdiff_t;
+            using reference = std::pair<Private::TReferenceOf<BaseIteratorA>, Private::TReferenceOf<BaseIteratorB>>;
+
+        public:
+            constexpr Iterator() = default;
+
+            constexpr Iterator(const BaseIteratorA InCurrentA, const BaseIteratorB InCurrentB)
+                : CurrentA(InCurrentA), CurrentB(InCurrentB)
+            {
+            }
+
+        public:
+            constexpr reference operator*() const
+            {
+                return reference(*CurrentA, *CurrentB);
+            }
+
+            constexpr Iterator& operator++()
+            {
+                ++CurrentA;
+                ++CurrentB;
+                return *this;
+            }
+
+            constexpr Iterator operator++(int)
+            {
+                Iterator Temp = *this;
+                ++(*this);
+                return Temp;
+            }
+
+            // Either side reaching its end ends the zip, so it stops at the shorter range
+            constexpr bool8 operator==(const Iterator& Other) const
+            {
+                return CurrentA == Other.CurrentA || CurrentB == Other.CurrentB;
+            }
+
+        private:
+            BaseIteratorA CurrentA{};
+            BaseIteratorB CurrentB{};
+        };
+
+    public:
+        constexpr TZipView(TBaseA InBaseA, TBaseB InBaseB)
+            : BaseA(std::move(InBaseA)), BaseB(std::move(InBaseB))
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr Iterator begin() const
+        {
+            return Iterator(BaseA.begin(), BaseB.begin());
+        }
+
+        [[nodiscard]] constexpr Iterator end() const
+        {
+            return Iterator(BaseA.end(), BaseB.end());
+        }
+
+    private:
+        TBaseA BaseA;
+        TBaseB BaseB;
+    };
+
+    template <typename TBase>
+    class TEnumerateView
+    {
+    public:
+        static constexpr bool8 bIsRangeView = true;
+        using ValueType = std::pair<size64, typename TBase::ValueType>;
+        using BaseIterator = Private::TIteratorOf<TBase>;
+
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = ValueType;
+            using difference_type = ptrdiff_t;
+            using reference = std::pair<size64, Private::TReferenceOf<BaseIterator>>;
+
+        public:
+            constexpr Iterator() = default;
+
+            constexpr Iterator(const BaseIterator InCurrent, const size64 InIndex)
+                : Current(InCurrent), Index(InIndex)
+            {
+            }
+
+        public:
+            constexpr reference operator*() const
+            {
+                return reference(Index, *Current);
+            }
+
+            constexpr Iterator& operator++()
+            {
+                ++Current;
+                ++Index;
+                return *this;
+            }
+
+            constexpr Iterator operator++(int)
+            {
+                Iterator Temp = *this;
+                ++(*this);
+                return Temp;
+            }
+
+            constexpr bool8 operator==(const Iterator& Other) const
+            {
+                return Current == Other.Current;
+            }
+
+        private:
+            BaseIterator Current{};
+            size64 Index = 0;
+        };
+
+    public:
+        constexpr explicit TEnumerateView(TBase InBase)
+            : Base(std::move(InBase))
+        {
+        }
+
+    public:
+        [[nodiscard]] constexpr Iterator begin() const
+        {
+            return Iterator(Base.begin(), 0);
+        }
+
+        [[nodiscard]] constexpr Iterator end() const
+        {
+            return Iterator(Base.end(), 0);
+        }
+
+    private:
+        TBase Base;
+    };
+
+    template <typename TBase>
+    class TChunkView
+    {
+    public:
+        static constexpr bool8 bIsRangeView = true;
+        using BaseIterator = Private::TIteratorOf<TBase>;
+        using ValueType = TSubRange<BaseIterator>;
+
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ValueType;
+            using difference_type = ptrdiff_t;
+            using reference = ValueType;
+
+        public:
+            constexpr Iterator() = default;
+
+            constexpr Iterator(const BaseIterator InCurrent, const BaseIterator InEnd, const size64 InChunkSize)
+                : Current(InCurrent), ChunkEnd(Private::AdvanceBounded(InCurrent, InEnd, InChunkSize)), End(InEnd), ChunkSize(InChunkSize)
+            {
+            }
+
+        public:
+            constexpr reference operator*() const
+            {
+                return ValueType(Current, ChunkEnd);
+            }
+
+            constexpr Iterator& operator++()
+            {
+                Current = ChunkEnd;
+                ChunkEnd = Private::AdvanceBounded(Current, End, ChunkSize);
+                return *this;
+            }
+
+            constexpr Iterator operator++(int)
+            {
+                Iterator Temp = *this;
+                ++(*this);
+                return Temp;
+            }
+
+            constexpr bool8 operator==(const Iterator& Other) const
+            {
+                return Current == Other.Current;
+            }
+
+        private:
+            BaseIterator Current{};
+            BaseIterator ChunkEnd{};
+            BaseIterator End{};
+            size64 ChunkSize = 0;
+        };
+
+    public:
+        constexpr TChunkView(TBase InBase, const size64 InChunkSize)
+            : Base(std::move(InBase)), ChunkSize(InChunkSize)
+        {
+            assert(ChunkSize > 0 && "Chunk size must be greater than zero");
+        }
+
+    public:
+        [[nodiscard]] constexpr Iterator begin() const
+        {
+            return Iterator(Base.begin(), Base.end(), ChunkSize);
+        }
+
+        [[nodiscard]] constexpr Iterator end() const
+        {
+            return Iterator(Base.end(), Base.end(), ChunkSize);
+        }
+
+    private:
+        TBase Base;
+        size64 ChunkSize;
+    };
+
+    namespace Private
+    {
+        // Partially applied view, the range is supplied through operator| or by calling it
+        template <typename TFactory>
+        struct TViewAdaptor
+        {
+            TFactory Factory;
+
+            template <CViewableRange TRange>
+            [[nodiscard]] constexpr auto operator()(TRange&& Range) const
+            {
+                return Factory(std::forward<TRange>(Range));
+            }
+        };
+
+        template <CViewableRange TRange, typename TFactory>
+        [[nodiscard]] constexpr auto operator|(TRange&& Range, const TViewAdaptor<TFactory>& Adaptor)
+        {
+            return Adaptor(std::forward<TRange>(Range));
+        }
+
+        template <typename TFactory>
+        [[nodiscard]] constexpr TViewAdaptor<TFactory> MakeAdaptor(TFactory Factory)
+        {
+            return TViewAdaptor<TFactory>{std::move(Factory)};
+        }
+    }
+
+    template <CViewableRange TRange>
+    [[nodiscard]] constexpr auto All(TRange&& Range)
+    {
+        return Private::MakeStorage(std::forward<TRange>(Range));
+    }
+
+    template <CViewableRange TRange, typename TPredicate>
+    [[nodiscard]] constexpr auto Filter(TRange&& Range, TPredicate Predicate)
+    {
+        return TFilterView<Private::TStorage<TRange>, TPredicate>(Private::MakeStorage(std::forward<TRange>(Range)), std::move(Predicate));
+    }
+
+    template <typename TPredicate>
+    [[nodiscard]] constexpr auto Filter(TPredicate Predicate)
+    {
+        return Private::MakeAdaptor([Predicate = std::move(Predicate)]<typename TRange>(TRange&& Range)
+        {
+            return Filter(std::forward<TRange>(Range), Predicate);
+        });
+    }
+
+    template <CViewableRange TRange, typename TFunction>
+    [[nodiscard]] constexpr auto Map(TRange&& Range, TFunction Function)
+    {
+        return TMapView<Private::TStorage<TRange>, TFunction>(Private::MakeStorage(std::forward<TRange>(Range)), std::move(Function));
+    }
+
+    template <typename TFunction>
+    [[nodiscard]] constexpr auto Map(TFunction Function)
+    {
+        return Private::MakeAdaptor([Function = std::move(Function)]<typename TRange>(TRange&& Range)
+        {
+            return Map(std::forward<TRange>(Range), Function);
+        });
+    }
+
+    template <CViewableRange TRange>
+    [[nodiscard]] constexpr auto Take(TRange&& Range, const size64 Count)
+    {
+        return TTakeView<Private::TStorage<TRange>>(Private::MakeStorage(std::forward<TRange>(Range)), Count);
+    }
+
+    [[nodiscard]] constexpr auto Take(const size64 Count)
+    {
+        return Private::MakeAdaptor([Count]<typename TRange>(TRange&& Range)
+        {
+            return Take(std::forward<TRange>(Range), Count);
+        });
+    }
+
+    template <CViewableRange TRange>
+    [[nodiscard]] constexpr auto Drop(TRange&& Range, const size64 Count)
+    {
+        return TDropView<Private::TStorage<TRange>>(Private::MakeStorage(std::forward<TRange>(Range)), Count);
+    }
+
+    [[nodiscard]] constexpr auto Drop(const size64 Count)
+    {
+        return Private::MakeAdaptor([Count]<typename TRange>(TRange&& Range)
+        {
+            return Drop(std::forward<TRange>(Range), Count);
+        });
+    }
+
+    template <CViewableRange TRangeA, CViewableRange TRangeB>
+    [[nodiscard]] constexpr auto Zip(TRangeA&& RangeA, TRangeB&& RangeB)
+    {
+        return TZipView<Private::TStorage<TRangeA>, Private::TStorage<TRangeB>>(
+            Private::MakeStorage(std::forward<TRangeA>(RangeA)), Private::MakeStorage(std::forward<TRangeB>(RangeB)));
+    }
+
+    template <CViewableRange TRangeB>
+    [[nodiscard]] constexpr auto Zip(TRangeB&& RangeB)
+    {
+        return Private::MakeAdaptor([StorageB = Private::MakeStorage(std::forward<TRangeB>(RangeB))]<typename TRangeA>(TRangeA&& RangeA)
+        {
+            return Zip(std::forward<TRangeA>(RangeA), StorageB);
+        });
+    }
+
+    template <CViewableRange TRange>
+    [[nodiscard]] constexpr auto Enumerate(TRange&& Range)
+    {
+        return TEnumerateView<Private::TStorage<TRange>>(Private::MakeStorage(std::forward<TRange>(Range)));
+    }
+
+    [[nodiscard]] constexpr auto Enumerate()
+    {
+        return Private::MakeAdaptor([]<typename TRange>(TRange&& Range)
+        {
+            return Enumerate(std::forward<TRange>(Range));
+        });
+    }
+
+    template <CViewableRange TRange>
+    [[nodiscard]] constexpr auto Chunk(TRange&& Range, const size64 ChunkSize)
+    {
+        return TChunkView<Private::TStorage<TRange>>(Private::MakeStorage(std::forward<TRange>(Range)), ChunkSize);
+    }
+
+    [[nodiscard]] constexpr auto Chunk(const size64 ChunkSize)
+    {
+        return Private::MakeAdaptor([ChunkSize]<typename TRange>(TRange&& Range)
+        {
+            return Chunk(std::forward<TRange>(Range), ChunkSize);
+        });
+    }
+}
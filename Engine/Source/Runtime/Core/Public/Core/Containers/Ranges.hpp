@@ -2,9 +2,15 @@
 
 #pragma once
 
+#include <bit>
+#include <concepts>
 #include <functional>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 
+#include "Core/Containers/RangesVectorized.hpp"
+
 template <typename TRange>
 concept CRange = requires(TRange Range)
 {
@@ -19,6 +25,16 @@ concept CRangeWithValueType = CRange<TRange> && requires
     typename TRange::ValueType;
 };
 
+template <typename TRange>
+concept CContiguousRange = CRangeWithValueType<TRange> && std::contiguous_iterator<decltype(std::declval<TRange&>().begin())>;
+
+template <typename TElement>
+concept CVectorizableElement = std::same_as<TElement, float32> || std::same_as<TElement, float64> ||
+    (std::integral<TElement> && !std::same_as<TElement, bool8> && sizeof(TElement) <= 8);
+
+template <typename TRange>
+concept CVectorizableRange = CContiguousRange<TRange> && CVectorizableElement<typename TRange::ValueType>;
+
 template <typename TPredicate, typename TElement>
 concept CRangeBoolPredicate = std::is_invocable_v<TPredicate, TElement> && std::convertible_to<std::invoke_result_t<TPredicate, TElement>, bool8>;
 
@@ -27,6 +43,28 @@ concept CRangeTransformPredicate = std::is_invocable_v<TPredicate, TElement> &&
 
 namespace Ranges
 {
+    namespace Private
+    {
+        // Below this many elements the call into the vectorized kernels costs more than the scalar loop
+        static constexpr size64 VectorizationThreshold = 32;
+
+        // Unsigned integer with the width of TElement, used where only the bit pattern matters
+        template <typename TElement>
+        using TBitLane = std::conditional_t<sizeof(TElement) == 1, uint8,
+            std::conditional_t<sizeof(TElement) == 2, uint16,
+            std::conditional_t<sizeof(TElement) == 4, uint32, uint64>>>;
+
+        // Integers compare bitwise, floating point keeps its own lane type for IEEE equality
+        template <typename TElement>
+        using TVectorLane = std::conditional_t<std::floating_point<TElement>, TElement, TBitLane<TElement>>;
+
+        template <typename TElement>
+        [[nodiscard]] const TVectorLane<TElement>* ToVectorLanes(const TElement* Data) noexcept
+        {
+            return reinterpret_cast<const TVectorLane<TElement>*>(Data);
+        }
+    }
+
     template <typename TRange, typename TFunc> requires CRangeWithValueType<std::remove_cvref_t<TRange>>
     constexpr void ForEach(TRange&& Range, const TFunc& Function)
     {
@@ -96,6 +134,16 @@ namespace Ranges
         }
     [[nodiscard]] constexpr size64 Find(const TRange& Range, const typename std::remove_cvref_t<TRange>::ValueType& Value)
     {
+        if constexpr (CVectorizableRange<std::remove_cvref_t<TRange>>)
+        {
+            using FElement = typename std::remove_cvref_t<TRange>::ValueType;
+            const FElement* Data = std::to_address(Range.begin());
+            const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+            if (!std::is_constant_evaluated() && NumElements >= Private::VectorizationThreshold)
+            {
+                return Vectorized::Find(Private::ToVectorLanes(Data), NumElements, std::bit_cast<Private::TVectorLane<FElement>>(Value));
+            }
+        }
         size64 Index = 0;
         for (const auto& Element : Range)
         {
@@ -108,6 +156,50 @@ namespace Ranges
         return static_cast<size64>(-1);
     }
 
+    template <typename TRange>
+        requires CRangeWithValueType<std::remove_cvref_t<TRange>> && requires
+        {
+            requires requires(const typename std::remove_cvref_t<TRange>::ValueType& a,
+                              const typename std::remove_cvref_t<TRange>::ValueType& b)
+            {
+                { a == b } -> std::convertible_to<bool8>;
+            };
+        }
+    [[nodiscard]] constexpr size64 Count(const TRange& Range, const typename std::remove_cvref_t<TRange>::ValueType& Value)
+    {
+        if constexpr (CVectorizableRange<std::remove_cvref_t<TRange>>)
+        {
+            using FElement = typename std::remove_cvref_t<TRange>::ValueType;
+            const FElement* Data = std::to_address(Range.begin());
+            const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+            if (!std::is_constant_evaluated() && NumElements >= Private::VectorizationThreshold)
+            {
+                return Vectorized::Count(Private::ToVectorLanes(Data), NumElements, std::bit_cast<Private::TVectorLane<FElement>>(Value));
+            }
+        }
+        size64 Result = 0;
+        for (const auto& Element : Range)
+        {
+            if (Element == Value)
+            {
+                ++Result;
+            }
+        }
+        return Result;
+    }
+
+    template <typename TRange, typename TProjection = std::identity> requires CRangeWithValueType<std::remove_cvref_t<TRange>>
+    [[nodiscard]] constexpr auto Sum(const TRange& Range, const TProjection& Projection = TProjection())
+    {
+        using FResult = std::remove_cvref_t<std::invoke_result_t<const TProjection&, const typename std::remove_cvref_t<TRange>::ValueType&>>;
+        FResult Result{};
+        for (const auto& Element : Range)
+        {
+            Result += std::invoke(Projection, Element);
+        }
+        return Result;
+    }
+
     template <typename TRange, typename TPredicate> requires CRangeWithValueType<std::remove_cvref_t<TRange>> && CRangeBoolPredicate<TPredicate, typename std::remove_cvref_t<TRange>::ValueType>
     [[nodiscard]] constexpr size64 FindIf(const TRange& Range, const TPredicate& Predicate)
     {
@@ -146,6 +238,19 @@ namespace Ranges
     template <typename TRange> requires CRangeWithValueType<std::remove_cvref_t<TRange>>
     constexpr void Fill(TRange&& Range, const typename std::remove_cvref_t<TRange>::ValueType& Value)
     {
+        if constexpr (CVectorizableRange<std::remove_cvref_t<TRange>>)
+        {
+            using FElement = typename std::remove_cvref_t<TRange>::ValueType;
+            using FBits = Private::TBitLane<FElement>;
+            FElement* Data = std::to_address(Range.begin());
+            const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+            if (!std::is_constant_evaluated() && NumElements >= Private::VectorizationThreshold)
+            {
+                // Fill only stores bit patterns, so floating point ranges go through the integer kernel of the same width
+                Vectorized::Fill(reinterpret_cast<FBits*>(Data), NumElements, std::bit_cast<FBits>(Value));
+                return;
+            }
+        }
         for (auto&& Element : std::forward<TRange>(Range))
         {
             Element = Value;
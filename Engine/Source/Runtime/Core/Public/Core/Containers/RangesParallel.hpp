@@ -0,0 +1,194 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Ranges.hpp"
+#include "Core/Threading/JobSystem.hpp"
+
+// Parallel counterparts of the Ranges algorithms for contiguous ranges, executed on FJobSystem.
+// Ranges are cut into chunks whose size only depends on the element size, never on the thread count,
+// so the reductions (Count, CountIf, Sum) combine the same partial results in the same order on
+// every machine and produce bit-identical results, including for floating point sums
+namespace Ranges::Parallel
+{
+    // Below this many elements the algorithms run the sequential version, dispatch would dominate
+    static constexpr size64 MinParallelElements = 16384;
+
+    // Chunks stay well inside a per-core L2 slice while being large enough to amortize task claiming
+    static constexpr size64 TargetChunkBytes = 64 * 1024;
+
+    namespace Private
+    {
+        template <typename TElement>
+        struct TSlice
+        {
+            using ValueType = std::remove_const_t<TElement>;
+
+            TElement* First;
+            TElement* Last;
+
+            [[nodiscard]] TElement* begin() const noexcept
+            {
+                return First;
+            }
+
+            [[nodiscard]] TElement* end() const noexcept
+            {
+                return Last;
+            }
+        };
+
+        [[nodiscard]] constexpr size64 GetChunkSize(const size64 ElementSize) noexcept
+        {
+            const size64 ChunkSize = TargetChunkBytes / ElementSize;
+            return ChunkSize > 0 ? ChunkSize : 1;
+        }
+
+        // Only depends on the element count, an uninitialized job system still runs the chunked path inline so
+        // reductions keep their association
+        [[nodiscard]] constexpr bool8 ShouldRunSequential(const size64 NumElements) noexcept
+        {
+            return NumElements < MinParallelElements;
+        }
+
+        // Calls Function(TSlice<TElement>, ChunkIndex) once per chunk across the worker threads
+        template <typename TElement, typename TFunction>
+        void ForEachChunk(TElement* Data, const size64 NumElements, const TFunction& Function)
+        {
+            const size64 ChunkSize = GetChunkSize(sizeof(TElement));
+            const size64 NumChunks = (NumElements + ChunkSize - 1) / ChunkSize;
+            FJobSystem::ParallelFor(NumChunks, [Data, NumElements, ChunkSize, &Function](const size64 ChunkIndex)
+            {
+                const size64 First = ChunkIndex * ChunkSize;
+                const size64 Last = First + ChunkSize < NumElements ? First + ChunkSize : NumElements;
+                Function(TSlice<TElement>{Data + First, Data + Last}, ChunkIndex);
+            });
+        }
+
+        // Computes one partial result per chunk, then folds them sequentially in chunk order
+        template <typename TResult, typename TElement, typename TChunkFunction>
+        [[nodiscard]] TResult Reduce(TElement* Data, const size64 NumElements, const TChunkFunction& ChunkFunction)
+        {
+            const size64 ChunkSize = GetChunkSize(sizeof(TElement));
+            TArray<TResult> PartialResults((NumElements + ChunkSize - 1) / ChunkSize, TResult{});
+            ForEachChunk(Data, NumElements, [&PartialResults, &ChunkFunction](const TSlice<TElement> Slice, const size64 ChunkIndex)
+            {
+                PartialResults[ChunkIndex] = ChunkFunction(Slice);
+            });
+            TResult Result{};
+            for (const TResult& PartialResult : PartialResults)
+            {
+                Result += PartialResult;
+            }
+            return Result;
+        }
+    }
+
+    template <typename TRange, typename TFunc> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    void ForEach(TRange&& Range, const TFunc& Function)
+    {
+        auto* Data = std::to_address(Range.begin());
+        const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+        if (Private::ShouldRunSequential(NumElements))
+        {
+            Ranges::ForEach(std::forward<TRange>(Range), Function);
+            return;
+        }
+        Private::ForEachChunk(Data, NumElements, [&Function](const auto Slice, size64)
+        {
+            for (auto& Element : Slice)
+            {
+                std::invoke(Function, Element);
+            }
+        });
+    }
+
+    template <typename TRange, typename TTransform> requires CContiguousRange<std::remove_cvref_t<TRange>> && CRangeTransformPredicate<TTransform, typename std::remove_cvref_t<TRange>::ValueType>
+    void Transform(TRange&& Range, const TTransform& Transform)
+    {
+        auto* Data = std::to_address(Range.begin());
+        const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+        if (Private::ShouldRunSequential(NumElements))
+        {
+            Ranges::Transform(std::forward<TRange>(Range), Transform);
+            return;
+        }
+        Private::ForEachChunk(Data, NumElements, [&Transform](const auto Slice, size64)
+        {
+            for (auto& Element : Slice)
+            {
+                Element = std::invoke(Transform, Element);
+            }
+        });
+    }
+
+    template <typename TRange> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    void Fill(TRange&& Range, const typename std::remove_cvref_t<TRange>::ValueType& Value)
+    {
+        auto* Data = std::to_address(Range.begin());
+        const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+        if (Private::ShouldRunSequential(NumElements))
+        {
+            Ranges::Fill(std::forward<TRange>(Range), Value);
+            return;
+        }
+        Private::ForEachChunk(Data, NumElements, [&Value](const auto Slice, size64)
+        {
+            Ranges::Fill(Slice, Value);
+        });
+    }
+
+    template <typename TRange> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    [[nodiscard]] size64 Count(const TRange& Range, const typename std::remove_cvref_t<TRange>::ValueType& Value)
+    {
+        const auto* Data = std::to_address(Range.begin());
+        const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+        if (Private::ShouldRunSequential(NumElements))
+        {
+            return Ranges::Count(Range, Value);
+        }
+        return Private::Reduce<size64>(Data, NumElements, [&Value](const auto Slice)
+        {
+            return Ranges::Count(Slice, Value);
+        });
+    }
+
+    template <typename TRange, typename TPredicate> requires CContiguousRange<std::remove_cvref_t<TRange>> && CRangeBoolPredicate<TPredicate, typename std::remove_cvref_t<TRange>::ValueType>
+    [[nodiscard]] size64 CountIf(const TRange& Range, const TPredicate& Predicate)
+    {
+        const auto* Data = std::to_address(Range.begin());
+        const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+        if (Private::ShouldRunSequential(NumElements))
+        {
+            return Ranges::CountIf(Range, Predicate);
+        }
+        return Private::Reduce<size64>(Data, NumElements, [&Predicate](const auto Slice)
+        {
+            return Ranges::CountIf(Slice, Predicate);
+        });
+    }
+
+    // Deterministic for floating point as well, but the association differs from the sequential
+    // Ranges::Sum, so the two may differ in the last bits for ranges above MinParallelElements
+    template <typename TRange, typename TProjection = std::identity> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    [[nodiscard]] auto Sum(const TRange& Range, const TProjection& Projection = TProjection())
+    {
+        using FResult = std::remove_cvref_t<std::invoke_result_t<const TProjection&, const typename std::remove_cvref_t<TRange>::ValueType&>>;
+
+        const auto* Data = std::to_address(Range.begin());
+        const size64 NumElements = static_cast<size64>(std::to_address(Range.end()) - Data);
+        if (Private::ShouldRunSequential(NumElements))
+        {
+            return Ranges::Sum(Range, Projection);
+        }
+        return Private::Reduce<FResult>(Data, NumElements, [&Projection](const auto Slice)
+        {
+            return Ranges::Sum(Slice, Projection);
+        });
+    }
+}
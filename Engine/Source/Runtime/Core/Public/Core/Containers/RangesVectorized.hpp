@@ -0,0 +1,29 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+// Vectorized kernels behind Ranges::Find, Ranges::Count and Ranges::Fill for contiguous arithmetic ranges.
+// Integers are compared bitwise so every integral type maps onto the unsigned lane type of the same width,
+// floating point keeps IEEE equality (-0 == +0, NaN matches nothing). Selected at runtime between AVX2,
+// SSE2 and scalar code depending on the host CPU
+namespace Ranges::Vectorized
+{
+    CORE_API size64 Find(const uint8* Data, size64 Count, uint8 Value);
+    CORE_API size64 Find(const uint16* Data, size64 Count, uint16 Value);
+    CORE_API size64 Find(const uint32* Data, size64 Count, uint32 Value);
+    CORE_API size64 Find(const uint64* Data, size64 Count, uint64 Value);
+    CORE_API size64 Find(const float32* Data, size64 Count, float32 Value);
+    CORE_API size64 Find(const float64* Data, size64 Count, float64 Value);
+
+    CORE_API size64 Count(const uint8* Data, size64 Count, uint8 Value);
+    CORE_API size64 Count(const uint16* Data, size64 Count, uint16 Value);
+    CORE_API size64 Count(const uint32* Data, size64 Count, uint32 Value);
+    CORE_API size64 Count(const uint64* Data, size64 Count, uint64 Value);
+    CORE_API size64 Count(const float32* Data, size64 Count, float32 Value);
+    CORE_API size64 Count(const float64* Data, size64 Count, float64 Value);
+
+    CORE_API void Fill(uint8* Data, size64 Count, uint8 Value);
+    CORE_API void Fill(uint16* Data, size64 Count, uint16 Value);
+    CORE_API void Fill(uint32* Data, size64 Count, uint32 Value);
+    CORE_API void Fill(uint64* Data, size64 Count, uint64 Value);
+}
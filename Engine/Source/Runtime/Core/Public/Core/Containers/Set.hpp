@@ -0,0 +1,228 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/HashTable.hpp"
+
+// Hash set on the same THashTable as TMap, nodes hold the element and nothing else. Elements are immutable
+// through the set, since changing one would change its hash. The bulk operations walk the smaller operand
+// and hash every element once, reusing that hash for both the lookup and the insert
+template <CValidMapKey TElement, typename THasher = THash<TElement>, typename TComparer = std::equal_to<TElement>>
+class TSet : private THashTable<TElement, FIdentityKeyOf, THasher, TComparer>
+{
+    using Super = THashTable<TElement, FIdentityKeyOf, THasher, TComparer>;
+
+public:
+    using KeyType = TElement;
+    using ValueType = TElement;
+    using SizeType = size64;
+    using HasherType = THasher;
+    using ComparerType = TComparer;
+    using Iterator = typename Super::ConstIterator;
+    using ConstIterator = typename Super::ConstIterator;
+
+public:
+    constexpr TSet() = default;
+
+    explicit TSet(const size64 InBucketCount)
+        : Super(InBucketCount)
+    {
+    }
+
+    TSet(std::initializer_list<TElement> InInitializerList)
+    {
+        Super::Reserve(InInitializerList.size());
+        for (const TElement& Element : InInitializerList)
+        {
+            Insert(Element);
+        }
+    }
+
+public:
+    TSet& operator=(std::initializer_list<TElement> InInitializerList)
+    {
+        Super::Clear();
+        for (const TElement& Element : InInitializerList)
+        {
+            Insert(Element);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] bool8 operator==(const TSet& Other) const
+    {
+        return Num() == Other.Num() && IsSubsetOf(Other);
+    }
+
+public:
+    std::pair<ConstIterator, bool8> Insert(const TElement& Element)
+    {
+        return Super::FindOrEmplace(Element, Super::GetHasher()(Element), Element);
+    }
+
+    std::pair<ConstIterator, bool8> Insert(TElement&& Element)
+    {
+        const size64 ElementHash = Super::GetHasher()(Element);
+        return Super::FindOrEmplace(Element, ElementHash, std::move(Element));
+    }
+
+    // Constructs the element in a node first, the node goes back to the pool if the element already exists
+    template <typename... TArguments>
+    std::pair<ConstIterator, bool8> Emplace(TArguments&&... Arguments)
+        requires std::is_constructible_v<TElement, TArguments...>
+    {
+        return Super::EmplaceUnique(std::forward<TArguments>(Arguments)...);
+    }
+
+    [[nodiscard]] ConstIterator Find(const TElement& Element) const
+    {
+        return Super::Find(Element);
+    }
+
+    using Super::Contains;
+
+    size64 Remove(const TElement& Element)
+    {
+        return Super::Remove(Element);
+    }
+
+    ConstIterator Remove(ConstIterator Position)
+    {
+        return Super::Remove(Position);
+    }
+
+    using Super::Clear;
+    using Super::Reserve;
+
+    void Swap(TSet& Other) noexcept
+    {
+        Super::Swap(Other);
+    }
+
+public:
+    // Elements of either set
+    [[nodiscard]] TSet Union(const TSet& Other) const
+    {
+        const bool8 bThisIsLarger = Num() >= Other.Num();
+        TSet Result(bThisIsLarger ? *this : Other);
+        Result.UnionWith(bThisIsLarger ? Other : *this);
+        return Result;
+    }
+
+    // Elements of both sets
+    [[nodiscard]] TSet Intersect(const TSet& Other) const
+    {
+        const TSet& Smaller = Num() <= Other.Num() ? *this : Other;
+        const TSet& Larger = Num() <= Other.Num() ? Other : *this;
+        TSet Result;
+        Result.Reserve(Smaller.Num());
+        for (const TElement& Element : Smaller)
+        {
+            const size64 ElementHash = Super::GetHasher()(Element);
+            if (Larger.Super::Find(Element, ElementHash) != Larger.end())
+            {
+                Result.Super::EmplaceWithHash(ElementHash, Element);
+            }
+        }
+        return Result;
+    }
+
+    // Elements of this set that are not in Other
+    [[nodiscard]] TSet Difference(const TSet& Other) const
+    {
+        TSet Result;
+        Result.Reserve(Num());
+        for (const TElement& Element : *this)
+        {
+            const size64 ElementHash = Super::GetHasher()(Element);
+            if (Other.Super::Find(Element, ElementHash) == Other.end())
+            {
+                Result.Super::EmplaceWithHash(ElementHash, Element);
+            }
+        }
+        return Result;
+    }
+
+    void UnionWith(const TSet& Other)
+    {
+        Reserve(Num() + Other.Num());
+        for (const TElement& Element : Other)
+        {
+            Insert(Element);
+        }
+    }
+
+    // Walks whichever set is smaller, a smaller Other builds the result from its elements
+    void IntersectWith(const TSet& Other)
+    {
+        if (Other.Num() < Num())
+        {
+            TSet Result = Intersect(Other);
+            Swap(Result);
+            return;
+        }
+        for (ConstIterator Position = begin(); Position != end();)
+        {
+            Position = Other.Contains(*Position) ? std::next(Position) : Remove(Position);
+        }
+    }
+
+    // Walks whichever set is smaller
+    void DifferenceWith(const TSet& Other)
+    {
+        if (Other.Num() < Num())
+        {
+            for (const TElement& Element : Other)
+            {
+                Remove(Element);
+            }
+            return;
+        }
+        for (ConstIterator Position = begin(); Position != end();)
+        {
+            Position = Other.Contains(*Position) ? Remove(Position) : std::next(Position);
+        }
+    }
+
+    [[nodiscard]] bool8 IsSubsetOf(const TSet& Other) const
+    {
+        if (Num() > Other.Num())
+        {
+            return false;
+        }
+        for (const TElement& Element : *this)
+        {
+            if (!Other.Contains(Element))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    using Super::Num;
+    using Super::GetBucketCount;
+    using Super::IsEmpty;
+    using Super::GetLoadFactor;
+    using Super::GetMaxLoadFactor;
+
+public:
+    // Iterator Support
+    [[nodiscard]] ConstIterator begin() const noexcept
+    {
+        return Super::begin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept
+    {
+        return Super::end();
+    }
+
+    using Super::cbegin;
+    using Super::cend;
+};
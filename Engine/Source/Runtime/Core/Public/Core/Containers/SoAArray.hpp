@@ -0,0 +1,445 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Memory/Memory.hpp"
+
+// Structure of arrays with one column per field, for data where most passes read a few fields of every row like
+// particles or transforms. The columns share one allocation, size and capacity, and each starts on a cache line,
+// so GetColumn<I>() is a contiguous aligned span that SIMD loops can stream through. A row is accessed as a tuple
+// of references, which also works with structured bindings: auto [Position, Velocity] = Particles[Index];
+template <typename... TFields> requires (sizeof...(TFields) > 0) && (... && (std::is_object_v<TFields> && !std::is_abstract_v<TFields>))
+class TSoAArray
+{
+private:
+    static constexpr size64 DefaultCapacity = 4;
+    static constexpr size64 GrowthFactor = 2;
+    static constexpr size64 NumFields = sizeof...(TFields);
+    static constexpr uint8 ColumnAlignment = static_cast<uint8>(std::max({size64(64), size64(alignof(TFields))...}));
+    static constexpr size64 PageSize = 4096;
+
+    using FFieldIndices = std::make_index_sequence<NumFields>;
+
+public:
+    template <size64 FieldIndex>
+    using FieldType = std::tuple_element_t<FieldIndex, std::tuple<TFields...>>;
+
+    using RowReference = std::tuple<TFields&...>;
+    using ConstRowReference = std::tuple<const TFields&...>;
+
+private:
+    // Yields the rows as tuples of references built from the column pointers
+    template <typename TColumns, typename TRowReference>
+    class TSoAArrayIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::tuple<TFields...>;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = TRowReference;
+
+    public:
+        constexpr TSoAArrayIterator() = default;
+
+        constexpr TSoAArrayIterator(const TColumns* InColumns, const size64 InIndex) noexcept
+            : Columns(InColumns), Index(InIndex)
+        {
+        }
+
+    public:
+        constexpr reference operator*() const
+        {
+            return std::apply([this](auto*... Column) { return TRowReference(Column[Index]...); }, *Columns);
+        }
+
+        constexpr TSoAArrayIterator& operator++()
+        {
+            ++Index;
+            return *this;
+        }
+
+        constexpr TSoAArrayIterator operator++(int)
+        {
+            TSoAArrayIterator Temp = *this;
+            ++Index;
+            return Temp;
+        }
+
+        constexpr bool8 operator==(const TSoAArrayIterator& Other) const noexcept
+        {
+            return Index == Other.Index;
+        }
+
+    private:
+        const TColumns* Columns = nullptr;
+        size64 Index = 0;
+    };
+
+    using FColumns = std::tuple<TFields*...>;
+
+public:
+    using Iterator = TSoAArrayIterator<FColumns, RowReference>;
+    using ConstIterator = TSoAArrayIterator<FColumns, ConstRowReference>;
+
+public:
+    TSoAArray() = default;
+
+    TSoAArray(const TSoAArray& Other)
+    {
+        AppendCopies(Other);
+    }
+
+    TSoAArray(TSoAArray&& Other) noexcept
+        : Columns(Other.Columns), Size(Other.Size), Capacity(Other.Capacity)
+    {
+        Other.Columns = FColumns();
+        Other.Size = 0;
+        Other.Capacity = 0;
+    }
+
+    ~TSoAArray()
+    {
+        DestroyAndDeallocate();
+    }
+
+public:
+    TSoAArray& operator=(const TSoAArray& Other)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            AppendCopies(Other);
+        }
+        return *this;
+    }
+
+    TSoAArray& operator=(TSoAArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAndDeallocate();
+
+            Columns = Other.Columns;
+            Size = Other.Size;
+            Capacity = Other.Capacity;
+
+            Other.Columns = FColumns();
+            Other.Size = 0;
+            Other.Capacity = 0;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] RowReference operator[](const size64 Index)
+    {
+        assert(Index < Size && "SoA array index is out of bounds");
+        return std::apply([Index](TFields*... Column) { return RowReference(Column[Index]...); }, Columns);
+    }
+
+    [[nodiscard]] ConstRowReference operator[](const size64 Index) const
+    {
+        assert(Index < Size && "SoA array index is out of bounds");
+        return std::apply([Index](TFields*... Column) { return ConstRowReference(Column[Index]...); }, Columns);
+    }
+
+public:
+    // One field of one row
+    template <size64 FieldIndex>
+    [[nodiscard]] FieldType<FieldIndex>& Get(const size64 Index)
+    {
+        assert(Index < Size && "SoA array index is out of bounds");
+        return std::get<FieldIndex>(Columns)[Index];
+    }
+
+    template <size64 FieldIndex>
+    [[nodiscard]] const FieldType<FieldIndex>& Get(const size64 Index) const
+    {
+        assert(Index < Size && "SoA array index is out of bounds");
+        return std::get<FieldIndex>(Columns)[Index];
+    }
+
+    // Every row of one field, contiguous and aligned to a cache line
+    template <size64 FieldIndex>
+    [[nodiscard]] std::span<FieldType<FieldIndex>> GetColumn() noexcept
+    {
+        return std::span<FieldType<FieldIndex>>(std::get<FieldIndex>(Columns), Size);
+    }
+
+    template <size64 FieldIndex>
+    [[nodiscard]] std::span<const FieldType<FieldIndex>> GetColumn() const noexcept
+    {
+        return std::span<const FieldType<FieldIndex>>(std::get<FieldIndex>(Columns), Size);
+    }
+
+    // Takes one argument per field, each column constructs its field from its argument. Arguments may reference an
+    // existing row, growing constructs the new row before the old rows leave their block
+    template <typename... TArguments> requires (sizeof...(TArguments) == NumFields) && (... && std::is_constructible_v<TFields, TArguments>)
+    RowReference EmplaceBack(TArguments&&... Arguments)
+    {
+        if (Size == Capacity)
+        {
+            const size64 NewCapacity = Capacity == 0 ? DefaultCapacity : Capacity * GrowthFactor;
+            const FColumns NewColumns = AllocateColumns(NewCapacity);
+            ConstructRow(NewColumns, std::forward<TArguments>(Arguments)...);
+            ReplaceColumns(NewColumns, NewCapacity);
+        }
+        else
+        {
+            ConstructRow(Columns, std::forward<TArguments>(Arguments)...);
+        }
+        ++Size;
+        return (*this)[Size - 1];
+    }
+
+    // Replaces the row with the last one, which keeps every column dense in constant time but changes the order
+    void RemoveAtSwap(const size64 Index)
+    {
+        assert(Index < Size && "SoA array index is out of bounds");
+        const size64 Last = Size - 1;
+        std::apply([Index, Last](TFields*... Column)
+        {
+            ((std::destroy_at(&Column[Index]), Index != Last ? RelocateElements(&Column[Last], &Column[Index], 1) : void()), ...);
+        }, Columns);
+        --Size;
+    }
+
+    void PopBack()
+    {
+        assert(Size > 0 && "Cannot pop from empty SoA array");
+        --Size;
+        std::apply([this](TFields*... Column) { (std::destroy_at(&Column[Size]), ...); }, Columns);
+    }
+
+    void Reserve(const size64 NewCapacity)
+    {
+        if (NewCapacity > Capacity)
+        {
+            ReplaceColumns(AllocateColumns(NewCapacity), NewCapacity);
+        }
+    }
+
+    // New rows are value initialized
+    void Resize(const size64 NewSize) requires (... && std::is_default_constructible_v<TFields>)
+    {
+        if (NewSize > Size)
+        {
+            Reserve(NewSize);
+            std::apply([this, NewSize](TFields*... Column) { (std::uninitialized_value_construct_n(&Column[Size], NewSize - Size), ...); }, Columns);
+        }
+        else if (NewSize < Size)
+        {
+            std::apply([this, NewSize](TFields*... Column) { (std::destroy_n(&Column[NewSize], Size - NewSize), ...); }, Columns);
+        }
+        Size = NewSize;
+    }
+
+    void Clear()
+    {
+        std::apply([this](TFields*... Column) { (std::destroy_n(Column, Size), ...); }, Columns);
+        Size = 0;
+    }
+
+public:
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Size;
+    }
+
+    [[nodiscard]] size64 GetCapacity() const noexcept
+    {
+        return Capacity;
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return Size == 0;
+    }
+
+    [[nodiscard]] static constexpr size64 GetNumFields() noexcept
+    {
+        return NumFields;
+    }
+
+public:
+    // Iterator Support
+    [[nodiscard]] Iterator begin() noexcept
+    {
+        return Iterator(&Columns, 0);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept
+    {
+        return ConstIterator(&Columns, 0);
+    }
+
+    [[nodiscard]] Iterator end() noexcept
+    {
+        return Iterator(&Columns, Size);
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept
+    {
+        return ConstIterator(&Columns, Size);
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+private:
+    [[nodiscard]] static constexpr size64 AlignColumnOffset(const size64 Offset) noexcept
+    {
+        return (Offset + ColumnAlignment - 1) & ~size64(ColumnAlignment - 1);
+    }
+
+    // Start of every column followed by the size of the block. The columns follow each other in field order, each
+    // on a cache line. Columns of equal size that are a multiple of a page long would start at the same offset
+    // within a page, so a pass over all of them maps every stream onto the same cache sets and stalls on 4K
+    // aliasing. Each column moves forward by cache lines until its page offset differs from those before it
+    [[nodiscard]] static constexpr std::array<size64, NumFields + 1> GetColumnOffsets(const size64 InCapacity) noexcept
+    {
+        constexpr size64 FieldSizes[NumFields] = {sizeof(TFields)...};
+        constexpr size64 NumPageOffsets = PageSize / ColumnAlignment;
+        std::array<size64, NumFields + 1> Offsets = {};
+        size64 Offset = 0;
+        for (size64 Field = 0; Field < NumFields; ++Field)
+        {
+            // Only a page's worth of columns can have distinct offsets, the ones before that are not checked
+            const size64 FirstChecked = Field > NumPageOffsets - 1 ? Field - (NumPageOffsets - 1) : 0;
+            for (size64 Other = FirstChecked; Other < Field; ++Other)
+            {
+                if (Offsets[Other] % PageSize == Offset % PageSize)
+                {
+                    Offset += ColumnAlignment;
+                    Other = FirstChecked - 1;
+                }
+            }
+            Offsets[Field] = Offset;
+            Offset = AlignColumnOffset(Offset + InCapacity * FieldSizes[Field]);
+        }
+        Offsets[NumFields] = Offset;
+        return Offsets;
+    }
+
+    template <size64... FieldIndices>
+    static void SetColumns(FColumns& OutColumns, void* Block, const std::array<size64, NumFields + 1>& Offsets, std::index_sequence<FieldIndices...>)
+    {
+        ((std::get<FieldIndices>(OutColumns) = reinterpret_cast<FieldType<FieldIndices>*>(static_cast<uint8*>(Block) + Offsets[FieldIndices])), ...);
+    }
+
+    template <size64... FieldIndices>
+    void RelocateColumns(const FColumns& NewColumns, std::index_sequence<FieldIndices...>)
+    {
+        (RelocateElements(std::get<FieldIndices>(Columns), std::get<FieldIndices>(NewColumns), Size), ...);
+    }
+
+    [[nodiscard]] static FColumns AllocateColumns(const size64 NewCapacity)
+    {
+        const std::array<size64, NumFields + 1> Offsets = GetColumnOffsets(NewCapacity);
+        FColumns NewColumns;
+        SetColumns(NewColumns, FMemory::Allocate(Offsets[NumFields], ColumnAlignment), Offsets, FFieldIndices());
+        return NewColumns;
+    }
+
+    // Moves the rows into the columns of a new block and releases the old one
+    void ReplaceColumns(const FColumns& NewColumns, const size64 NewCapacity)
+    {
+        if (Capacity > 0)
+        {
+            RelocateColumns(NewColumns, FFieldIndices());
+            FMemory::Free(std::get<0>(Columns), ColumnAlignment);
+        }
+        Columns = NewColumns;
+        Capacity = NewCapacity;
+    }
+
+    // Constructs row Size of the given columns
+    template <typename... TArguments>
+    void ConstructRow(const FColumns& InColumns, TArguments&&... Arguments)
+    {
+        std::apply([this, &Arguments...](TFields*... Column) { (std::construct_at(&Column[Size], std::forward<TArguments>(Arguments)), ...); }, InColumns);
+    }
+
+    void AppendCopies(const TSoAArray& Other)
+    {
+        if (Other.Size > 0)
+        {
+            Reserve(Other.Size);
+            AppendCopies(Other, FFieldIndices());
+            Size = Other.Size;
+        }
+    }
+
+    template <size64... FieldIndices>
+    void AppendCopies(const TSoAArray& Other, std::index_sequence<FieldIndices...>)
+    {
+        (CopyConstructElements(std::get<FieldIndices>(Other.Columns), std::get<FieldIndices>(Columns), Other.Size), ...);
+    }
+
+    // Copy-constructs Count elements into uninitialized, non-overlapping storage
+    template <typename TElement>
+    static void CopyConstructElements(const TElement* Source, TElement* Target, const size64 Count)
+    {
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            FMemory::Copy(Source, Target, Count * sizeof(TElement));
+        }
+        else
+        {
+            std::uninitialized_copy_n(Source, Count, Target);
+        }
+    }
+
+    // Moves Count elements into uninitialized, non-overlapping storage and destroys the sources
+    template <typename TElement>
+    static void RelocateElements(TElement* Source, TElement* Target, const size64 Count)
+    {
+        if constexpr (std::is_trivially_copyable_v<TElement>)
+        {
+            FMemory::Copy(Source, Target, Count * sizeof(TElement));
+        }
+        else
+        {
+            for (size64 Index = 0; Index < Count; ++Index)
+            {
+                std::construct_at(&Target[Index], std::move(Source[Index]));
+                std::destroy_at(&Source[Index]);
+            }
+        }
+    }
+
+    void DestroyAndDeallocate()
+    {
+        if (Capacity > 0)
+        {
+            Clear();
+            FMemory::Free(std::get<0>(Columns), ColumnAlignment);
+            Columns = FColumns();
+        }
+        Size = 0;
+        Capacity = 0;
+    }
+
+private:
+    // The first column starts the allocation
+    FColumns Columns;
+    size64 Size = 0;
+    size64 Capacity = 0;
+};
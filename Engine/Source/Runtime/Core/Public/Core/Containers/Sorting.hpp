@@ -0,0 +1,430 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Ranges.hpp"
+
+template <typename TKey>
+concept CRadixSortKey = (std::integral<TKey> && !std::same_as<TKey, bool8>) || std::same_as<TKey, float32> || std::same_as<TKey, float64>;
+
+namespace Ranges
+{
+    namespace Private
+    {
+        static constexpr size64 InsertionSortThreshold = 16;
+
+        template <typename TElement, typename TLess>
+        constexpr void InsertionSort(TElement* First, TElement* Last, const TLess& Less)
+        {
+            if (First == Last)
+            {
+                return;
+            }
+            for (TElement* Current = First + 1; Current < Last; ++Current)
+            {
+                if (std::invoke(Less, *Current, *First))
+                {
+                    TElement Value = std::move(*Current);
+                    std::move_backward(First, Current, Current + 1);
+                    *First = std::move(Value);
+                }
+                else
+                {
+                    // The first element acts as a sentinel, so the inner loop needs no bounds check
+                    TElement Value = std::move(*Current);
+                    TElement* Hole = Current;
+                    while (std::invoke(Less, Value, *(Hole - 1)))
+                    {
+                        *Hole = std::move(*(Hole - 1));
+                        --Hole;
+                    }
+                    *Hole = std::move(Value);
+                }
+            }
+        }
+
+        template <typename TElement, typename TLess>
+        constexpr void SiftDown(TElement* First, size64 Root, const size64 Count, const TLess& Less)
+        {
+            TElement Value = std::move(First[Root]);
+            while (true)
+            {
+                size64 Child = Root * 2 + 1;
+                if (Child >= Count)
+                {
+                    break;
+                }
+                if (Child + 1 < Count && std::invoke(Less, First[Child], First[Child + 1]))
+                {
+                    ++Child;
+                }
+                if (!std::invoke(Less, Value, First[Child]))
+                {
+                    break;
+                }
+                First[Root] = std::move(First[Child]);
+                Root = Child;
+            }
+            First[Root] = std::move(Value);
+        }
+
+        template <typename TElement, typename TLess>
+        constexpr void HeapSort(TElement* First, TElement* Last, const TLess& Less)
+        {
+            const size64 Count = static_cast<size64>(Last - First);
+            for (size64 Index = Count / 2; Index > 0; --Index)
+            {
+                SiftDown(First, Index - 1, Count, Less);
+            }
+            for (size64 End = Count; End > 1; --End)
+            {
+                std::swap(First[0], First[End - 1]);
+                SiftDown(First, 0, End - 1, Less);
+            }
+        }
+
+        template <typename TElement, typename TLess>
+        constexpr void MoveMedianToFirst(TElement* Result, TElement* A, TElement* B, TElement* C, const TLess& Less)
+        {
+            if (std::invoke(Less, *A, *B))
+            {
+                if (std::invoke(Less, *B, *C))
+                {
+                    std::swap(*Result, *B);
+                }
+                else if (std::invoke(Less, *A, *C))
+                {
+                    std::swap(*Result, *C);
+                }
+                else
+                {
+                    std::swap(*Result, *A);
+                }
+            }
+            else if (std::invoke(Less, *A, *C))
+            {
+                std::swap(*Result, *A);
+            }
+            else if (std::invoke(Less, *B, *C))
+            {
+                std::swap(*Result, *C);
+            }
+            else
+            {
+                std::swap(*Result, *B);
+            }
+        }
+
+        template <typename TElement, typename TLess>
+        constexpr void IntroSortLoop(TElement* First, TElement* Last, size64 DepthLimit, const TLess& Less)
+        {
+            while (static_cast<size64>(Last - First) > InsertionSortThreshold)
+            {
+                if (DepthLimit == 0)
+                {
+                    HeapSort(First, Last, Less);
+                    return;
+                }
+                --DepthLimit;
+
+                // Median-of-three pivot is parked at First, then Hoare partition around it
+                TElement* Middle = First + (Last - First) / 2;
+                MoveMedianToFirst(First, First + 1, Middle, Last - 1, Less);
+                TElement* Left = First + 1;
+                TElement* Right = Last;
+                while (true)
+                {
+                    while (std::invoke(Less, *Left, *First))
+                    {
+                        ++Left;
+                    }
+                    --Right;
+                    while (std::invoke(Less, *First, *Right))
+                    {
+                        --Right;
+                    }
+                    if (!(Left < Right))
+                    {
+                        break;
+                    }
+                    std::swap(*Left, *Right);
+                    ++Left;
+                }
+
+                // Recurse into the smaller half to bound stack depth
+                if (Left - First < Last - Left)
+                {
+                    IntroSortLoop(First, Left, DepthLimit, Less);
+                    First = Left;
+                }
+                else
+                {
+                    IntroSortLoop(Left, Last, DepthLimit, Less);
+                    Last = Left;
+                }
+            }
+        }
+
+        template <typename TElement, typename TLess>
+        void MergeSort(TElement* First, const size64 Count, TArray<TElement>& Buffer, const TLess& Less)
+        {
+            if (Count <= InsertionSortThreshold)
+            {
+                InsertionSort(First, First + Count, Less);
+                return;
+            }
+            const size64 HalfCount = Count / 2;
+            TElement* Middle = First + HalfCount;
+            TElement* Last = First + Count;
+            MergeSort(First, HalfCount, Buffer, Less);
+            MergeSort(Middle, Count - HalfCount, Buffer, Less);
+            if (!std::invoke(Less, *Middle, *(Middle - 1)))
+            {
+                return;
+            }
+
+            // Move the left half aside and merge back in place, taking from the left on ties to stay stable
+            Buffer.Clear();
+            for (TElement* Current = First; Current < Middle; ++Current)
+            {
+                Buffer.EmplaceBack(std::move(*Current));
+            }
+            TElement* Left = Buffer.begin();
+            TElement* LeftEnd = Buffer.end();
+            TElement* Right = Middle;
+            TElement* Output = First;
+            while (Left < LeftEnd && Right < Last)
+            {
+                if (std::invoke(Less, *Right, *Left))
+                {
+                    *Output++ = std::move(*Right++);
+                }
+                else
+                {
+                    *Output++ = std::move(*Left++);
+                }
+            }
+            while (Left < LeftEnd)
+            {
+                *Output++ = std::move(*Left++);
+            }
+        }
+
+        // Maps a key onto an unsigned integer whose natural order matches the key's order
+        template <CRadixSortKey TKey>
+        [[nodiscard]] constexpr auto ToRadixKey(const TKey Key) noexcept
+        {
+            if constexpr (std::floating_point<TKey>)
+            {
+                using FBits = std::conditional_t<sizeof(TKey) == 4, uint32, uint64>;
+                constexpr FBits SignBit = FBits(1) << (sizeof(TKey) * 8 - 1);
+                const FBits Bits = std::bit_cast<FBits>(Key);
+                return (Bits & SignBit) != 0 ? static_cast<FBits>(~Bits) : static_cast<FBits>(Bits | SignBit);
+            }
+            else
+            {
+                using FBits = std::make_unsigned_t<TKey>;
+                if constexpr (std::is_signed_v<TKey>)
+                {
+                    constexpr FBits SignBit = FBits(1) << (sizeof(TKey) * 8 - 1);
+                    return static_cast<FBits>(static_cast<FBits>(Key) ^ SignBit);
+                }
+                else
+                {
+                    return static_cast<FBits>(Key);
+                }
+            }
+        }
+
+        template <typename TElement, typename TProjection>
+        void RadixSort(TElement* Data, const size64 Count, const TProjection& Projection)
+        {
+            using FKey = std::remove_cvref_t<std::invoke_result_t<TProjection, const TElement&>>;
+            static constexpr size64 NumPasses = sizeof(FKey);
+            static constexpr size64 NumBuckets = 256;
+
+            if (Count <= InsertionSortThreshold)
+            {
+                InsertionSort(Data, Data + Count, [&Projection](const TElement& A, const TElement& B)
+                {
+                    return ToRadixKey(std::invoke(Projection, A)) < ToRadixKey(std::invoke(Projection, B));
+                });
+                return;
+            }
+
+            // Build every byte histogram in a single read pass
+            TArray<size64> Histograms(NumPasses * NumBuckets);
+            for (size64 Index = 0; Index < Count; ++Index)
+            {
+                const auto Key = ToRadixKey(std::invoke(Projection, Data[Index]));
+                for (size64 Pass = 0; Pass < NumPasses; ++Pass)
+                {
+                    ++Histograms[Pass * NumBuckets + ((Key >> (Pass * 8)) & 0xFF)];
+                }
+            }
+
+            TElement* Scratch = static_cast<TElement*>(FMemory::Allocate(Count * sizeof(TElement), alignof(TElement)));
+            TElement* Source = Data;
+            TElement* Target = Scratch;
+            for (size64 Pass = 0; Pass < NumPasses; ++Pass)
+            {
+                size64* Histogram = &Histograms[Pass * NumBuckets];
+
+                // A byte that is identical across all keys cannot reorder anything, so skip the scatter
+                if (Histogram[(ToRadixKey(std::invoke(Projection, Source[0])) >> (Pass * 8)) & 0xFF] == Count)
+                {
+                    continue;
+                }
+
+                size64 Offset = 0;
+                for (size64 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+                {
+                    const size64 BucketCount = Histogram[Bucket];
+                    Histogram[Bucket] = Offset;
+                    Offset += BucketCount;
+                }
+                for (size64 Index = 0; Index < Count; ++Index)
+                {
+                    const auto Key = ToRadixKey(std::invoke(Projection, Source[Index]));
+                    std::construct_at(&Target[Histogram[(Key >> (Pass * 8)) & 0xFF]++], Source[Index]);
+                }
+                std::swap(Source, Target);
+            }
+
+            if (Source != Data)
+            {
+                FMemory::Copy(Source, Data, Count * sizeof(TElement));
+            }
+            FMemory::Free(Scratch, alignof(TElement));
+        }
+    }
+
+    template <typename TRange, typename TLess = std::less<>> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    constexpr void Sort(TRange&& Range, const TLess& Less = TLess())
+    {
+        auto* First = std::to_address(Range.begin());
+        auto* Last = std::to_address(Range.end());
+        const size64 Count = static_cast<size64>(Last - First);
+        if (Count < 2)
+        {
+            return;
+        }
+        Private::IntroSortLoop(First, Last, 2 * static_cast<size64>(std::bit_width(Count)), Less);
+        Private::InsertionSort(First, Last, Less);
+    }
+
+    template <typename TRange, typename TLess = std::less<>> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    void StableSort(TRange&& Range, const TLess& Less = TLess())
+    {
+        using FElement = typename std::remove_cvref_t<TRange>::ValueType;
+
+        FElement* First = std::to_address(Range.begin());
+        const size64 Count = static_cast<size64>(std::to_address(Range.end()) - First);
+        if (Count < 2)
+        {
+            return;
+        }
+        TArray<FElement> Buffer;
+        Buffer.Reserve(Count / 2);
+        Private::MergeSort(First, Count, Buffer, Less);
+    }
+
+    // LSD radix sort over the element's key, stable and O(n) per key byte. Elements are copied between
+    // ping-pong buffers each pass, which is why they have to be trivially copyable
+    template <typename TRange, typename TProjection = std::identity>
+        requires CContiguousRange<std::remove_cvref_t<TRange>> &&
+                 std::is_trivially_copyable_v<typename std::remove_cvref_t<TRange>::ValueType> &&
+                 CRadixSortKey<std::remove_cvref_t<std::invoke_result_t<TProjection, const typename std::remove_cvref_t<TRange>::ValueType&>>>
+    void RadixSort(TRange&& Range, const TProjection& Projection = TProjection())
+    {
+        auto* First = std::to_address(Range.begin());
+        const size64 Count = static_cast<size64>(std::to_address(Range.end()) - First);
+        if (Count < 2)
+        {
+            return;
+        }
+        Private::RadixSort(First, Count, Projection);
+    }
+
+    template <typename TRange, typename TValue, typename TLess = std::less<>> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    [[nodiscard]] constexpr size64 LowerBound(const TRange& Range, const TValue& Value, const TLess& Less = TLess())
+    {
+        const auto* First = std::to_address(Range.begin());
+        size64 Low = 0;
+        size64 Count = static_cast<size64>(std::to_address(Range.end()) - First);
+        while (Count > 0)
+        {
+            const size64 Step = Count / 2;
+            if (std::invoke(Less, First[Low + Step], Value))
+            {
+                Low += Step + 1;
+                Count -= Step + 1;
+            }
+            else
+            {
+                Count = Step;
+            }
+        }
+        return Low;
+    }
+
+    template <typename TRange, typename TValue, typename TLess = std::less<>> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    [[nodiscard]] constexpr size64 UpperBound(const TRange& Range, const TValue& Value, const TLess& Less = TLess())
+    {
+        const auto* First = std::to_address(Range.begin());
+        size64 Low = 0;
+        size64 Count = static_cast<size64>(std::to_address(Range.end()) - First);
+        while (Count > 0)
+        {
+            const size64 Step = Count / 2;
+            if (!std::invoke(Less, Value, First[Low + Step]))
+            {
+                Low += Step + 1;
+                Count -= Step + 1;
+            }
+            else
+            {
+                Count = Step;
+            }
+        }
+        return Low;
+    }
+
+    // Returns the index of an element equivalent to Value, or static_cast<size64>(-1) like Find
+    template <typename TRange, typename TValue, typename TLess = std::less<>> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    [[nodiscard]] constexpr size64 BinarySearch(const TRange& Range, const TValue& Value, const TLess& Less = TLess())
+    {
+        const size64 Index = LowerBound(Range, Value, Less);
+        const auto* First = std::to_address(Range.begin());
+        const size64 Count = static_cast<size64>(std::to_address(Range.end()) - First);
+        if (Index < Count && !std::invoke(Less, Value, First[Index]))
+        {
+            return Index;
+        }
+        return static_cast<size64>(-1);
+    }
+
+    template <typename TRange, typename TLess = std::less<>> requires CContiguousRange<std::remove_cvref_t<TRange>>
+    [[nodiscard]] constexpr bool8 IsSorted(const TRange& Range, const TLess& Less = TLess())
+    {
+        const auto* First = std::to_address(Range.begin());
+        const auto* Last = std::to_address(Range.end());
+        for (const auto* Current = First; Current + 1 < Last; ++Current)
+        {
+            if (std::invoke(Less, *(Current + 1), *Current))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -9,7 +9,7 @@
 
 #include "Core/CoreConcepts.hpp"
 
-template <typename TElement, size64 TSize> requires std::is_object_v<TElement> && !std::is_abstract_v<TElement> && std::is_trivially_constructible_v<TElement> && (TSize > 0)
+template <typename TElement, size64 TSize> requires std::is_object_v<TElement> && !std::is_abstract_v<TElement> && std::is_default_constructible_v<TElement> && (TSize > 0)
 class TStaticArray
 {
 public:
@@ -94,15 +94,7 @@ public:
         }
     }
 
-    constexpr ~TStaticArray() requires std::is_trivially_destructible_v<TElement> = default;
-
-    ~TStaticArray() requires (!std::is_trivially_destructible_v<TElement>)
-    {
-        for (size64 Index = 0; Index < TSize; ++Index)
-        {
-            Data[Index].~TElement();
-        }
-    }
+    constexpr ~TStaticArray() = default;
 
 public:
     constexpr TStaticArray& operator=(const TStaticArray& Other)
@@ -0,0 +1,286 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/StaticArray.hpp"
+#include "Core/Hash/Hash.hpp"
+
+// Hash of the TStaticMap keys. The map is laid out at compile time and searched at run time, so unlike THash it
+// has to be computable in both and give the same value. Specialize it for other key types
+template <typename T>
+struct TStaticHash;
+
+template <typename T> requires std::is_integral_v<T> || std::is_enum_v<T>
+struct TStaticHash<T>
+{
+    [[nodiscard]] constexpr size64 operator()(const T Value) const noexcept
+    {
+        return THash<T>{}(Value);
+    }
+};
+
+// Reads the characters as overlapping words the way Hash::HashBytes does, so that at run time a short name costs
+// two loads and one mix
+template <typename TChar, typename TTraits>
+struct TStaticHash<std::basic_string_view<TChar, TTraits>>
+{
+    [[nodiscard]] constexpr size64 operator()(const std::basic_string_view<TChar, TTraits> Value) const noexcept
+    {
+        const TChar* Characters = Value.data();
+        const size64 Size = Value.size() * sizeof(TChar);
+        uint64 State = Size;
+        if (Size <= 8)
+        {
+            if (Size >= 4)
+            {
+                return Hash::MixInteger(State ^ ((ReadBytes<4>(Characters, 0) << 32) | ReadBytes<4>(Characters, Size - 4)));
+            }
+            if (Size > 0)
+            {
+                return Hash::MixInteger(State ^ ((GetByte(Characters, 0) << 16) | (GetByte(Characters, Size >> 1) << 8) | GetByte(Characters, Size - 1)));
+            }
+            return State;
+        }
+        size64 Offset = 0;
+        for (; Offset + 8 < Size; Offset += 8)
+        {
+            State = Hash::MixInteger(State ^ ReadBytes<8>(Characters, Offset));
+        }
+        // The last eight bytes, overlapping what was already consumed
+        return Hash::MixInteger(State ^ ReadBytes<8>(Characters, Size - 8));
+    }
+
+private:
+    [[nodiscard]] static constexpr uint64 GetByte(const TChar* Characters, const size64 ByteOffset) noexcept
+    {
+        const auto Character = static_cast<std::make_unsigned_t<TChar>>(Characters[ByteOffset / sizeof(TChar)]);
+        return (static_cast<uint64>(Character) >> (ByteOffset % sizeof(TChar) * 8)) & 0xFF;
+    }
+
+    // Little endian load of NumBytes bytes, byte by byte in constant evaluation
+    template <size64 NumBytes>
+    [[nodiscard]] static constexpr uint64 ReadBytes(const TChar* Characters, const size64 ByteOffset) noexcept
+    {
+        if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+        {
+            std::conditional_t<NumBytes == 8, uint64, uint32> Word;
+            std::memcpy(&Word, static_cast<const uint8*>(static_cast<const void*>(Characters)) + ByteOffset, NumBytes);
+            return Word;
+        }
+        uint64 Word = 0;
+        for (size64 Index = 0; Index < NumBytes; ++Index)
+        {
+            Word |= GetByte(Characters, ByteOffset + Index) << (Index * 8);
+        }
+        return Word;
+    }
+};
+
+// Immutable map over a key set known at compile time, for tables like enum names or command registries. The
+// consteval constructor computes a perfect hash: keys are split into buckets by their hash and every bucket gets
+// a seed that sends all of its keys to free slots. A lookup hashes the key, reads the seed of its bucket and
+// compares with the one key in the resulting slot, without probing or allocating. Free slots hold a copy of a
+// key that lives in another slot, so the comparison can never match them
+template <typename TKey, typename TValue, size64 NumElements, typename THasher = TStaticHash<TKey>, typename TComparer = std::equal_to<TKey>>
+    requires std::is_default_constructible_v<TKey> && std::is_default_constructible_v<TValue> && (NumElements > 0)
+class TStaticMap
+{
+public:
+    using KeyType = TKey;
+    using MappedType = TValue;
+    using ValueType = std::pair<TKey, TValue>;
+    using SizeType = size64;
+    using HasherType = THasher;
+    using ComparerType = TComparer;
+
+    // At most 80% of the slots are used, two keys per bucket on average. Up to eight keys share a single seed,
+    // which takes the bucket step out of their lookups
+    static constexpr size64 SlotCount = std::bit_ceil(NumElements + NumElements / 4 > 2 ? NumElements + NumElements / 4 : 2);
+    static constexpr size64 BucketCount = NumElements <= 8 ? 1 : (NumElements + 1) / 2;
+
+private:
+    static constexpr uint32 SlotShift = 64 - std::countr_zero(SlotCount);
+    static constexpr uint64 SlotMultiplier = 0x9E3779B97F4A7C15ull;
+    static constexpr uint64 MaxSeedAttempts = 1 << 16;
+
+public:
+    consteval explicit TStaticMap(const ValueType (&InEntries)[NumElements])
+        : Slots(), Seeds(), Hasher(), Comparer()
+    {
+        uint64 Hashes[NumElements] = {};
+        size64 BucketStarts[BucketCount + 1] = {};
+        for (size64 Index = 0; Index < NumElements; ++Index)
+        {
+            Hashes[Index] = Hasher(InEntries[Index].first);
+            ++BucketStarts[GetBucket(Hashes[Index]) + 1];
+        }
+
+        // Entries sorted by bucket, through a counting sort
+        size64 MaxBucketSize = 0;
+        for (size64 Bucket = 0; Bucket < BucketCount; ++Bucket)
+        {
+            MaxBucketSize = BucketStarts[Bucket + 1] > MaxBucketSize ? BucketStarts[Bucket + 1] : MaxBucketSize;
+            BucketStarts[Bucket + 1] += BucketStarts[Bucket];
+        }
+        size64 SortedEntries[NumElements] = {};
+        size64 BucketFill[BucketCount] = {};
+        for (size64 Index = 0; Index < NumElements; ++Index)
+        {
+            const size64 Bucket = GetBucket(Hashes[Index]);
+            SortedEntries[BucketStarts[Bucket] + BucketFill[Bucket]++] = Index;
+        }
+
+        // Largest buckets first, while most slots are still free
+        bool8 bSlotTaken[SlotCount] = {};
+        for (size64 BucketSize = MaxBucketSize; BucketSize > 0; --BucketSize)
+        {
+            for (size64 Bucket = 0; Bucket < BucketCount; ++Bucket)
+            {
+                if (BucketStarts[Bucket + 1] - BucketStarts[Bucket] == BucketSize)
+                {
+                    PlaceBucket(InEntries, Hashes, SortedEntries + BucketStarts[Bucket], BucketSize, Bucket, bSlotTaken);
+                }
+            }
+        }
+
+        for (size64 Slot = 0; Slot < SlotCount; ++Slot)
+        {
+            if (!bSlotTaken[Slot])
+            {
+                Slots[Slot].first = InEntries[0].first;
+            }
+        }
+    }
+
+public:
+    // Value of Key, or null if Key is not in the map
+    [[nodiscard]] constexpr const TValue* Find(const TKey& Key) const
+    {
+        const ValueType& Entry = Slots[GetSlot(Hasher(Key))];
+        return Comparer(Entry.first, Key) ? &Entry.second : nullptr;
+    }
+
+    [[nodiscard]] constexpr bool8 Contains(const TKey& Key) const
+    {
+        return Find(Key) != nullptr;
+    }
+
+    [[nodiscard]] constexpr const TValue& operator[](const TKey& Key) const
+    {
+        const TValue* Value = Find(Key);
+        assert(Value != nullptr && "Key is not in the map");
+        return *Value;
+    }
+
+public:
+    [[nodiscard]] static constexpr size64 Num() noexcept
+    {
+        return NumElements;
+    }
+
+    [[nodiscard]] static constexpr size64 GetSlotCount() noexcept
+    {
+        return SlotCount;
+    }
+
+private:
+    [[nodiscard]] static constexpr size64 GetBucket(const uint64 KeyHash) noexcept
+    {
+        if constexpr (BucketCount == 1)
+        {
+            return 0;
+        }
+        return static_cast<size64>(((KeyHash & 0xFFFFFFFFull) * BucketCount) >> 32);
+    }
+
+    // The multiply carries every bit of the seeded hash into the top bits, which pick the slot
+    [[nodiscard]] static constexpr size64 GetSlot(const uint64 KeyHash, const uint64 Seed) noexcept
+    {
+        return static_cast<size64>(((KeyHash ^ Seed) * SlotMultiplier) >> SlotShift);
+    }
+
+    [[nodiscard]] constexpr size64 GetSlot(const uint64 KeyHash) const noexcept
+    {
+        return GetSlot(KeyHash, Seeds[GetBucket(KeyHash)]);
+    }
+
+    // Tries seeds until every entry of the bucket lands on a free slot of its own
+    constexpr void PlaceBucket(const ValueType (&InEntries)[NumElements], const uint64 (&Hashes)[NumElements], const size64* BucketEntries,
+        const size64 BucketSize, const size64 Bucket, bool8 (&bSlotTaken)[SlotCount])
+    {
+        for (size64 First = 0; First < BucketSize; ++First)
+        {
+            for (size64 Second = First + 1; Second < BucketSize; ++Second)
+            {
+                const size64 FirstEntry = BucketEntries[First];
+                const size64 SecondEntry = BucketEntries[Second];
+                if (Hashes[FirstEntry] == Hashes[SecondEntry])
+                {
+                    // Both land on the same slot whatever the seed
+                    Comparer(InEntries[FirstEntry].first, InEntries[SecondEntry].first) ? ErrorDuplicateKey() : ErrorHashCollision();
+                }
+            }
+        }
+
+        for (uint64 Attempt = 0; Attempt < MaxSeedAttempts; ++Attempt)
+        {
+            const uint64 Seed = Hash::MixInteger(Attempt);
+            size64 NumPlaced = 0;
+            while (NumPlaced < BucketSize && !bSlotTaken[GetSlot(Hashes[BucketEntries[NumPlaced]], Seed)])
+            {
+                bSlotTaken[GetSlot(Hashes[BucketEntries[NumPlaced]], Seed)] = true;
+                ++NumPlaced;
+            }
+            if (NumPlaced == BucketSize)
+            {
+                Seeds[Bucket] = Seed;
+                for (size64 Index = 0; Index < BucketSize; ++Index)
+                {
+                    const size64 Entry = BucketEntries[Index];
+                    Slots[GetSlot(Hashes[Entry], Seed)] = InEntries[Entry];
+                }
+                return;
+            }
+            while (NumPlaced > 0)
+            {
+                --NumPlaced;
+                bSlotTaken[GetSlot(Hashes[BucketEntries[NumPlaced]], Seed)] = false;
+            }
+        }
+        ErrorNoSeedFound();
+    }
+
+    // Not constexpr, calling one fails the compile time construction with the function name in the error
+    static void ErrorDuplicateKey()
+    {
+    }
+
+    static void ErrorHashCollision()
+    {
+    }
+
+    static void ErrorNoSeedFound()
+    {
+    }
+
+private:
+    TStaticArray<ValueType, SlotCount> Slots;
+    TStaticArray<uint64, BucketCount> Seeds;
+    THasher Hasher;
+    TComparer Comparer;
+};
+
+// Deduces the size from the entries, the key and value types have to be given:
+// constexpr auto Names = MakeStaticMap<EColor, std::string_view>({{EColor::Red, "Red"}, {EColor::Green, "Green"}});
+template <typename TKey, typename TValue, typename THasher = TStaticHash<TKey>, typename TComparer = std::equal_to<TKey>, size64 NumElements>
+consteval TStaticMap<TKey, TValue, NumElements, THasher, TComparer> MakeStaticMap(const std::pair<TKey, TValue> (&InEntries)[NumElements])
+{
+    return TStaticMap<TKey, TValue, NumElements, THasher, TComparer>(InEntries);
+}
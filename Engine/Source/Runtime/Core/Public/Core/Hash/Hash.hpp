@@ -0,0 +1,131 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Non cryptographic hashing for hash tables. Every bit of the result depends on every bit of the input, so
+// tables can pick buckets from the low bits of the hash without suffering from keys that only differ in
+// their high bits, like pointers or strided integers
+namespace Hash
+{
+    // 64 bit hash of a byte range in the style of wyhash, a few cycles for short keys and several GB/s on
+    // long ones
+    [[nodiscard]] CORE_API uint64 HashBytes(const void* Data, size64 Size, uint64 Seed = 0);
+
+    // Bijective finalizer of splitmix64, spreads sequential or strided integers over all 64 bits
+    [[nodiscard]] constexpr uint64 MixInteger(uint64 Value)
+    {
+        Value ^= Value >> 30;
+        Value *= 0xBF58476D1CE4E5B9ull;
+        Value ^= Value >> 27;
+        Value *= 0x94D049BB133111EBull;
+        Value ^= Value >> 31;
+        return Value;
+    }
+
+    // Folds the hash of one more member of a composite key into Seed. The order of the members matters
+    [[nodiscard]] constexpr uint64 Combine(const uint64 Seed, const uint64 Value)
+    {
+        return MixInteger(Seed ^ (Value + 0x9E3779B97F4A7C15ull + (Seed << 6) + (Seed >> 2)));
+    }
+}
+
+// Types hash themselves by providing GetHash, which should return a well mixed value
+template <typename T>
+concept CSelfHashable = requires(const T& Value)
+{
+    { Value.GetHash() } -> std::convertible_to<size64>;
+};
+
+template <typename T>
+concept CStdHashable = requires(const T& Value)
+{
+    { std::hash<T>{}(Value) } -> std::convertible_to<size64>;
+};
+
+// Customization point for the hash containers. Specialize it, or give the type a GetHash member. Anything
+// else std::hash accepts gets its std::hash value mixed, since that is the identity for integers on common
+// standard libraries
+template <typename T>
+struct THash
+{
+    [[nodiscard]] size64 operator()(const T& Value) const noexcept requires CSelfHashable<T> || CStdHashable<T>
+    {
+        if constexpr (CSelfHashable<T>)
+        {
+            return static_cast<size64>(Value.GetHash());
+        }
+        else
+        {
+            return static_cast<size64>(Hash::MixInteger(std::hash<T>{}(Value)));
+        }
+    }
+};
+
+template <typename T> requires std::is_integral_v<T> || std::is_enum_v<T>
+struct THash<T>
+{
+    [[nodiscard]] constexpr size64 operator()(const T Value) const noexcept
+    {
+        return static_cast<size64>(Hash::MixInteger(static_cast<uint64>(Value)));
+    }
+};
+
+template <typename T>
+struct THash<T*>
+{
+    [[nodiscard]] size64 operator()(const T* Value) const noexcept
+    {
+        return static_cast<size64>(Hash::MixInteger(reinterpret_cast<uintptr_t>(Value)));
+    }
+};
+
+template <std::floating_point T>
+struct THash<T>
+{
+    [[nodiscard]] size64 operator()(const T Value) const noexcept
+    {
+        // -0 equals +0 and has to land in the same bucket
+        using FBits = std::conditional_t<sizeof(T) == 4, uint32, uint64>;
+        return static_cast<size64>(Hash::MixInteger(std::bit_cast<FBits>(Value == T(0) ? T(0) : Value)));
+    }
+};
+
+template <typename TChar, typename TTraits>
+struct THash<std::basic_string_view<TChar, TTraits>>
+{
+    [[nodiscard]] size64 operator()(const std::basic_string_view<TChar, TTraits> Value) const noexcept
+    {
+        return static_cast<size64>(Hash::HashBytes(Value.data(), Value.size() * sizeof(TChar)));
+    }
+};
+
+template <typename TChar, typename TTraits, typename TAllocator>
+struct THash<std::basic_string<TChar, TTraits, TAllocator>>
+{
+    [[nodiscard]] size64 operator()(const std::basic_string<TChar, TTraits, TAllocator>& Value) const noexcept
+    {
+        return static_cast<size64>(Hash::HashBytes(Value.data(), Value.size() * sizeof(TChar)));
+    }
+};
+
+template <typename TFirst, typename TSecond>
+struct THash<std::pair<TFirst, TSecond>>
+{
+    [[nodiscard]] size64 operator()(const std::pair<TFirst, TSecond>& Value) const noexcept
+    {
+        return static_cast<size64>(Hash::Combine(THash<TFirst>{}(Value.first), THash<TSecond>{}(Value.second)));
+    }
+};
+
+template <typename T>
+concept CHashable = requires(const T& Value)
+{
+    { THash<T>{}(Value) } -> std::convertible_to<size64>;
+};
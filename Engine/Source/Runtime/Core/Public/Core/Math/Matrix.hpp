@@ -0,0 +1,142 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "Core/Math/Quat.hpp"
+
+// Row major 4x4 matrix acting on column vectors, so a transform applies right to left and the translation
+// is the last column. Every row is 16 byte aligned for the SSE paths
+struct alignas(16) FMatrix44
+{
+    float32 M[4][4];
+
+    [[nodiscard]] static constexpr FMatrix44 Identity()
+    {
+        return MakeScale(FVector3::One());
+    }
+
+    [[nodiscard]] static constexpr FMatrix44 MakeTranslation(const FVector3& Translation)
+    {
+        return FMatrix44{{{1.0f, 0.0f, 0.0f, Translation.X}, {0.0f, 1.0f, 0.0f, Translation.Y}, {0.0f, 0.0f, 1.0f, Translation.Z},
+            {0.0f, 0.0f, 0.0f, 1.0f}}};
+    }
+
+    [[nodiscard]] static constexpr FMatrix44 MakeScale(const FVector3& Scale)
+    {
+        return FMatrix44{{{Scale.X, 0.0f, 0.0f, 0.0f}, {0.0f, Scale.Y, 0.0f, 0.0f}, {0.0f, 0.0f, Scale.Z, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}}};
+    }
+
+    [[nodiscard]] static constexpr FMatrix44 MakeRotation(const FQuat& Rotation)
+    {
+        return MakeTransform(FVector3::Zero(), Rotation, FVector3::One());
+    }
+
+    // Scales first, then rotates, then translates
+    [[nodiscard]] static constexpr FMatrix44 MakeTransform(const FVector3& Translation, const FQuat& Rotation, const FVector3& Scale)
+    {
+        const float32 XX = Rotation.X * Rotation.X, YY = Rotation.Y * Rotation.Y, ZZ = Rotation.Z * Rotation.Z;
+        const float32 XY = Rotation.X * Rotation.Y, XZ = Rotation.X * Rotation.Z, YZ = Rotation.Y * Rotation.Z;
+        const float32 WX = Rotation.W * Rotation.X, WY = Rotation.W * Rotation.Y, WZ = Rotation.W * Rotation.Z;
+        return FMatrix44{{
+            {(1.0f - 2.0f * (YY + ZZ)) * Scale.X, 2.0f * (XY - WZ) * Scale.Y, 2.0f * (XZ + WY) * Scale.Z, Translation.X},
+            {2.0f * (XY + WZ) * Scale.X, (1.0f - 2.0f * (XX + ZZ)) * Scale.Y, 2.0f * (YZ - WX) * Scale.Z, Translation.Y},
+            {2.0f * (XZ - WY) * Scale.X, 2.0f * (YZ + WX) * Scale.Y, (1.0f - 2.0f * (XX + YY)) * Scale.Z, Translation.Z},
+            {0.0f, 0.0f, 0.0f, 1.0f}}};
+    }
+
+    // A * B, applying B first
+    [[nodiscard]] static constexpr FMatrix44 Multiply(const FMatrix44& A, const FMatrix44& B)
+    {
+        FMatrix44 Result;
+#if CORVUS_ARCH_X64
+        if (!std::is_constant_evaluated())
+        {
+            // Row I of the result is the rows of B weighted by row I of A
+            const __m128 B0 = _mm_load_ps(B.M[0]);
+            const __m128 B1 = _mm_load_ps(B.M[1]);
+            const __m128 B2 = _mm_load_ps(B.M[2]);
+            const __m128 B3 = _mm_load_ps(B.M[3]);
+            for (uint32 Row = 0; Row < 4; ++Row)
+            {
+                __m128 Sum = _mm_mul_ps(_mm_set1_ps(A.M[Row][0]), B0);
+                Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(A.M[Row][1]), B1));
+                Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(A.M[Row][2]), B2));
+                Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(A.M[Row][3]), B3));
+                _mm_store_ps(Result.M[Row], Sum);
+            }
+            return Result;
+        }
+#endif
+        for (uint32 Row = 0; Row < 4; ++Row)
+        {
+            for (uint32 Column = 0; Column < 4; ++Column)
+            {
+                Result.M[Row][Column] = A.M[Row][0] * B.M[0][Column] + A.M[Row][1] * B.M[1][Column] + A.M[Row][2] * B.M[2][Column] +
+                    A.M[Row][3] * B.M[3][Column];
+            }
+        }
+        return Result;
+    }
+
+    [[nodiscard]] constexpr FMatrix44 operator*(const FMatrix44& Other) const
+    {
+        return Multiply(*this, Other);
+    }
+
+    [[nodiscard]] constexpr bool8 operator==(const FMatrix44& Other) const
+    {
+        for (uint32 Row = 0; Row < 4; ++Row)
+        {
+            for (uint32 Column = 0; Column < 4; ++Column)
+            {
+                if (M[Row][Column] != Other.M[Row][Column])
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] constexpr FMatrix44 GetTransposed() const
+    {
+        FMatrix44 Result;
+        for (uint32 Row = 0; Row < 4; ++Row)
+        {
+            for (uint32 Column = 0; Column < 4; ++Column)
+            {
+                Result.M[Row][Column] = M[Column][Row];
+            }
+        }
+        return Result;
+    }
+
+    [[nodiscard]] constexpr FVector3 GetTranslation() const
+    {
+        return {M[0][3], M[1][3], M[2][3]};
+    }
+
+    [[nodiscard]] constexpr FVector4 Transform(const FVector4& Vector) const
+    {
+        return {M[0][0] * Vector.X + M[0][1] * Vector.Y + M[0][2] * Vector.Z + M[0][3] * Vector.W,
+            M[1][0] * Vector.X + M[1][1] * Vector.Y + M[1][2] * Vector.Z + M[1][3] * Vector.W,
+            M[2][0] * Vector.X + M[2][1] * Vector.Y + M[2][2] * Vector.Z + M[2][3] * Vector.W,
+            M[3][0] * Vector.X + M[3][1] * Vector.Y + M[3][2] * Vector.Z + M[3][3] * Vector.W};
+    }
+
+    // Affine transforms only, the projective row is ignored
+    [[nodiscard]] constexpr FVector3 TransformPoint(const FVector3& Point) const
+    {
+        return {M[0][0] * Point.X + M[0][1] * Point.Y + M[0][2] * Point.Z + M[0][3],
+            M[1][0] * Point.X + M[1][1] * Point.Y + M[1][2] * Point.Z + M[1][3],
+            M[2][0] * Point.X + M[2][1] * Point.Y + M[2][2] * Point.Z + M[2][3]};
+    }
+
+    // Ignores the translation
+    [[nodiscard]] constexpr FVector3 TransformVector(const FVector3& Vector) const
+    {
+        return {M[0][0] * Vector.X + M[0][1] * Vector.Y + M[0][2] * Vector.Z,
+            M[1][0] * Vector.X + M[1][1] * Vector.Y + M[1][2] * Vector.Z,
+            M[2][0] * Vector.X + M[2][1] * Vector.Y + M[2][2] * Vector.Z};
+    }
+};
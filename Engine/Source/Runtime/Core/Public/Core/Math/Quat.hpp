@@ -0,0 +1,122 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "Core/Math/Vector.hpp"
+
+// Rotation as a unit quaternion, X Y Z is the vector part and W the scalar part. Same layout as FVector4 so
+// the SSE paths share its loads and stores
+struct alignas(16) FQuat
+{
+    float32 X;
+    float32 Y;
+    float32 Z;
+    float32 W;
+
+    FQuat() = default;
+
+    constexpr FQuat(const float32 InX, const float32 InY, const float32 InZ, const float32 InW)
+        : X(InX), Y(InY), Z(InZ), W(InW)
+    {
+    }
+
+    [[nodiscard]] static constexpr FQuat Identity()
+    {
+        return {0.0f, 0.0f, 0.0f, 1.0f};
+    }
+
+    // Axis has to be normalized, the angle is in radians
+    [[nodiscard]] static FQuat MakeFromAxisAngle(const FVector3& Axis, const float32 Angle)
+    {
+        const float32 Sine = std::sin(Angle * 0.5f);
+        return {Axis.X * Sine, Axis.Y * Sine, Axis.Z * Sine, std::cos(Angle * 0.5f)};
+    }
+
+    [[nodiscard]] constexpr FVector4 ToVector() const
+    {
+        return {X, Y, Z, W};
+    }
+
+    [[nodiscard]] static constexpr FQuat FromVector(const FVector4& Vector)
+    {
+        return {Vector.X, Vector.Y, Vector.Z, Vector.W};
+    }
+
+    // A * B, rotating by B first
+    [[nodiscard]] static constexpr FQuat Multiply(const FQuat& A, const FQuat& B)
+    {
+#if CORVUS_ARCH_X64
+        if (!std::is_constant_evaluated())
+        {
+            // Each component of A scales a permutation of B with the signs of the Hamilton product
+            const __m128 Right = _mm_load_ps(&B.X);
+            __m128 Result = _mm_mul_ps(_mm_set1_ps(A.W), Right);
+            Result = _mm_add_ps(Result, _mm_xor_ps(_mm_mul_ps(_mm_set1_ps(A.X), _mm_shuffle_ps(Right, Right, _MM_SHUFFLE(0, 1, 2, 3))),
+                _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)));
+            Result = _mm_add_ps(Result, _mm_xor_ps(_mm_mul_ps(_mm_set1_ps(A.Y), _mm_shuffle_ps(Right, Right, _MM_SHUFFLE(1, 0, 3, 2))),
+                _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f)));
+            Result = _mm_add_ps(Result, _mm_xor_ps(_mm_mul_ps(_mm_set1_ps(A.Z), _mm_shuffle_ps(Right, Right, _MM_SHUFFLE(2, 3, 0, 1))),
+                _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)));
+            FQuat Quat;
+            _mm_store_ps(&Quat.X, Result);
+            return Quat;
+        }
+#endif
+        return {A.W * B.X + A.X * B.W + A.Y * B.Z - A.Z * B.Y,
+            A.W * B.Y - A.X * B.Z + A.Y * B.W + A.Z * B.X,
+            A.W * B.Z + A.X * B.Y - A.Y * B.X + A.Z * B.W,
+            A.W * B.W - A.X * B.X - A.Y * B.Y - A.Z * B.Z};
+    }
+
+    [[nodiscard]] constexpr FQuat operator*(const FQuat& Other) const
+    {
+        return Multiply(*this, Other);
+    }
+
+    [[nodiscard]] constexpr bool8 operator==(const FQuat& Other) const = default;
+
+    // The inverse rotation of a unit quaternion
+    [[nodiscard]] constexpr FQuat GetConjugate() const
+    {
+        return {-X, -Y, -Z, W};
+    }
+
+    [[nodiscard]] static constexpr float32 Dot(const FQuat& A, const FQuat& B)
+    {
+        return FVector4::Dot(A.ToVector(), B.ToVector());
+    }
+
+    [[nodiscard]] FQuat GetNormalized() const
+    {
+        return FromVector(ToVector() * (1.0f / std::sqrt(Dot(*this, *this))));
+    }
+
+    [[nodiscard]] constexpr FVector3 RotateVector(const FVector3& Vector) const
+    {
+        // v + 2w (q x v) + 2 q x (q x v), cheaper than going through the rotation matrix for a single vector
+        const FVector3 Axis(X, Y, Z);
+        const FVector3 Twice = FVector3::Cross(Axis, Vector) * 2.0f;
+        return Vector + Twice * W + FVector3::Cross(Axis, Twice);
+    }
+
+    // Spherical interpolation along the shorter arc with constant angular speed. Nearly parallel inputs fall
+    // back to a normalized linear interpolation where the sine of the angle would lose precision
+    [[nodiscard]] static FQuat Slerp(const FQuat& A, const FQuat& B, const float32 Alpha)
+    {
+        float32 Cosine = Dot(A, B);
+        const float32 Sign = Cosine < 0.0f ? -1.0f : 1.0f;
+        Cosine *= Sign;
+
+        float32 WeightA = 1.0f - Alpha;
+        float32 WeightB = Alpha;
+        if (Cosine < 0.9995f)
+        {
+            const float32 Angle = std::acos(Cosine);
+            const float32 InverseSine = 1.0f / std::sin(Angle);
+            WeightA = std::sin(WeightA * Angle) * InverseSine;
+            WeightB = std::sin(WeightB * Angle) * InverseSine;
+        }
+        const FQuat Result = FromVector(A.ToVector() * WeightA + B.ToVector() * (WeightB * Sign));
+        return Cosine < 0.9995f ? Result : Result.GetNormalized();
+    }
+};
@@ -0,0 +1,269 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "Core/Platform/CPUFeatures.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+#if CORVUS_ARCH_X64
+#   include <immintrin.h>
+#endif
+
+// Math types are plain aggregates of float32. The default constructors leave the components uninitialized
+// so arrays of them can grow without touching memory. Every operation has a constexpr scalar body, x64 builds
+// switch to SSE outside of constant evaluation where a single vector op does the work of four scalar ones
+struct FVector3
+{
+    float32 X;
+    float32 Y;
+    float32 Z;
+
+    FVector3() = default;
+
+    constexpr FVector3(const float32 InX, const float32 InY, const float32 InZ)
+        : X(InX), Y(InY), Z(InZ)
+    {
+    }
+
+    constexpr explicit FVector3(const float32 Value)
+        : X(Value), Y(Value), Z(Value)
+    {
+    }
+
+    [[nodiscard]] static constexpr FVector3 Zero()
+    {
+        return FVector3(0.0f);
+    }
+
+    [[nodiscard]] static constexpr FVector3 One()
+    {
+        return FVector3(1.0f);
+    }
+
+    [[nodiscard]] constexpr FVector3 operator+(const FVector3& Other) const
+    {
+        return {X + Other.X, Y + Other.Y, Z + Other.Z};
+    }
+
+    [[nodiscard]] constexpr FVector3 operator-(const FVector3& Other) const
+    {
+        return {X - Other.X, Y - Other.Y, Z - Other.Z};
+    }
+
+    // Component wise
+    [[nodiscard]] constexpr FVector3 operator*(const FVector3& Other) const
+    {
+        return {X * Other.X, Y * Other.Y, Z * Other.Z};
+    }
+
+    [[nodiscard]] constexpr FVector3 operator*(const float32 Scale) const
+    {
+        return {X * Scale, Y * Scale, Z * Scale};
+    }
+
+    [[nodiscard]] constexpr FVector3 operator/(const float32 Divisor) const
+    {
+        return *this * (1.0f / Divisor);
+    }
+
+    [[nodiscard]] constexpr FVector3 operator-() const
+    {
+        return {-X, -Y, -Z};
+    }
+
+    constexpr FVector3& operator+=(const FVector3& Other)
+    {
+        return *this = *this + Other;
+    }
+
+    constexpr FVector3& operator-=(const FVector3& Other)
+    {
+        return *this = *this - Other;
+    }
+
+    constexpr FVector3& operator*=(const float32 Scale)
+    {
+        return *this = *this * Scale;
+    }
+
+    [[nodiscard]] constexpr bool8 operator==(const FVector3& Other) const = default;
+
+    [[nodiscard]] static constexpr float32 Dot(const FVector3& A, const FVector3& B)
+    {
+        return A.X * B.X + A.Y * B.Y + A.Z * B.Z;
+    }
+
+    [[nodiscard]] static constexpr FVector3 Cross(const FVector3& A, const FVector3& B)
+    {
+        return {A.Y * B.Z - A.Z * B.Y, A.Z * B.X - A.X * B.Z, A.X * B.Y - A.Y * B.X};
+    }
+
+    [[nodiscard]] static constexpr FVector3 Lerp(const FVector3& A, const FVector3& B, const float32 Alpha)
+    {
+        return A + (B - A) * Alpha;
+    }
+
+    [[nodiscard]] constexpr float32 LengthSquared() const
+    {
+        return Dot(*this, *this);
+    }
+
+    [[nodiscard]] float32 Length() const
+    {
+        return std::sqrt(LengthSquared());
+    }
+
+    // Zero stays zero
+    [[nodiscard]] FVector3 GetNormalized() const
+    {
+        const float32 Squared = LengthSquared();
+        return Squared > 0.0f ? *this * (1.0f / std::sqrt(Squared)) : Zero();
+    }
+};
+
+[[nodiscard]] constexpr FVector3 operator*(const float32 Scale, const FVector3& Vector)
+{
+    return Vector * Scale;
+}
+
+struct alignas(16) FVector4
+{
+    float32 X;
+    float32 Y;
+    float32 Z;
+    float32 W;
+
+    FVector4() = default;
+
+    constexpr FVector4(const float32 InX, const float32 InY, const float32 InZ, const float32 InW)
+        : X(InX), Y(InY), Z(InZ), W(InW)
+    {
+    }
+
+    constexpr FVector4(const FVector3& Vector, const float32 InW)
+        : X(Vector.X), Y(Vector.Y), Z(Vector.Z), W(InW)
+    {
+    }
+
+    constexpr explicit FVector4(const float32 Value)
+        : X(Value), Y(Value), Z(Value), W(Value)
+    {
+    }
+
+    [[nodiscard]] static constexpr FVector4 Zero()
+    {
+        return FVector4(0.0f);
+    }
+
+    [[nodiscard]] constexpr FVector3 GetXYZ() const
+    {
+        return {X, Y, Z};
+    }
+
+#if CORVUS_ARCH_X64
+    [[nodiscard]] __m128 Load() const
+    {
+        return _mm_load_ps(&X);
+    }
+
+    [[nodiscard]] static FVector4 Store(const __m128 Value)
+    {
+        FVector4 Result;
+        _mm_store_ps(&Result.X, Value);
+        return Result;
+    }
+#endif
+
+    [[nodiscard]] constexpr FVector4 operator+(const FVector4& Other) const
+    {
+#if CORVUS_ARCH_X64
+        if (!std::is_constant_evaluated())
+        {
+            return Store(_mm_add_ps(Load(), Other.Load()));
+        }
+#endif
+        return {X + Other.X, Y + Other.Y, Z + Other.Z, W + Other.W};
+    }
+
+    [[nodiscard]] constexpr FVector4 operator-(const FVector4& Other) const
+    {
+#if CORVUS_ARCH_X64
+        if (!std::is_constant_evaluated())
+        {
+            return Store(_mm_sub_ps(Load(), Other.Load()));
+        }
+#endif
+        return {X - Other.X, Y - Other.Y, Z - Other.Z, W - Other.W};
+    }
+
+    // Component wise
+    [[nodiscard]] constexpr FVector4 operator*(const FVector4& Other) const
+    {
+#if CORVUS_ARCH_X64
+        if (!std::is_constant_evaluated())
+        {
+            return Store(_mm_mul_ps(Load(), Other.Load()));
+        }
+#endif
+        return {X * Other.X, Y * Other.Y, Z * Other.Z, W * Other.W};
+    }
+
+    [[nodiscard]] constexpr FVector4 operator*(const float32 Scale) const
+    {
+#if CORVUS_ARCH_X64
+        if (!std::is_constant_evaluated())
+        {
+            return Store(_mm_mul_ps(Load(), _mm_set1_ps(Scale)));
+        }
+#endif
+        return {X * Scale, Y * Scale, Z * Scale, W * Scale};
+    }
+
+    [[nodiscard]] constexpr FVector4 operator-() const
+    {
+        return {-X, -Y, -Z, -W};
+    }
+
+    constexpr FVector4& operator+=(const FVector4& Other)
+    {
+        return *this = *this + Other;
+    }
+
+    constexpr FVector4& operator*=(const float32 Scale)
+    {
+        return *this = *this * Scale;
+    }
+
+    [[nodiscard]] constexpr bool8 operator==(const FVector4& Other) const = default;
+
+    [[nodiscard]] static constexpr float32 Dot(const FVector4& A, const FVector4& B)
+    {
+#if CORVUS_ARCH_X64
+        if (!std::is_constant_evaluated())
+        {
+            // Two horizontal steps with SSE2 shuffles, the dot product instruction needs SSE4.1
+            const __m128 Products = _mm_mul_ps(A.Load(), B.Load());
+            const __m128 Pairs = _mm_add_ps(Products, _mm_shuffle_ps(Products, Products, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_cvtss_f32(_mm_add_ss(Pairs, _mm_movehl_ps(Pairs, Pairs)));
+        }
+#endif
+        return A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W;
+    }
+
+    [[nodiscard]] static constexpr FVector4 Lerp(const FVector4& A, const FVector4& B, const float32 Alpha)
+    {
+        return A + (B - A) * Alpha;
+    }
+
+    [[nodiscard]] constexpr float32 LengthSquared() const
+    {
+        return Dot(*this, *this);
+    }
+
+    [[nodiscard]] float32 Length() const
+    {
+        return std::sqrt(LengthSquared());
+    }
+};
@@ -0,0 +1,105 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "Core/Math/Matrix.hpp"
+
+// Eight 3D vectors as structure of arrays, one 32 byte row per component. Lane I of every operation only
+// touches lane I of its inputs, so the loops below map onto one AVX or two SSE instructions per row and
+// compilers vectorize them without help. Large arrays go through the Math functions, which pick the widest
+// instruction set the CPU has
+struct alignas(32) FVector3x8
+{
+    static constexpr uint32 NumLanes = 8;
+
+    float32 X[NumLanes];
+    float32 Y[NumLanes];
+    float32 Z[NumLanes];
+
+    [[nodiscard]] static constexpr FVector3x8 Splat(const FVector3& Vector)
+    {
+        FVector3x8 Result;
+        for (uint32 Lane = 0; Lane < NumLanes; ++Lane)
+        {
+            Result.Set(Lane, Vector);
+        }
+        return Result;
+    }
+
+    [[nodiscard]] constexpr FVector3 Get(const uint32 Lane) const
+    {
+        return {X[Lane], Y[Lane], Z[Lane]};
+    }
+
+    constexpr void Set(const uint32 Lane, const FVector3& Vector)
+    {
+        X[Lane] = Vector.X;
+        Y[Lane] = Vector.Y;
+        Z[Lane] = Vector.Z;
+    }
+
+    [[nodiscard]] constexpr FVector3x8 operator+(const FVector3x8& Other) const
+    {
+        FVector3x8 Result;
+        for (uint32 Lane = 0; Lane < NumLanes; ++Lane)
+        {
+            Result.X[Lane] = X[Lane] + Other.X[Lane];
+            Result.Y[Lane] = Y[Lane] + Other.Y[Lane];
+            Result.Z[Lane] = Z[Lane] + Other.Z[Lane];
+        }
+        return Result;
+    }
+
+    [[nodiscard]] constexpr FVector3x8 operator-(const FVector3x8& Other) const
+    {
+        FVector3x8 Result;
+        for (uint32 Lane = 0; Lane < NumLanes; ++Lane)
+        {
+            Result.X[Lane] = X[Lane] - Other.X[Lane];
+            Result.Y[Lane] = Y[Lane] - Other.Y[Lane];
+            Result.Z[Lane] = Z[Lane] - Other.Z[Lane];
+        }
+        return Result;
+    }
+
+    [[nodiscard]] constexpr FVector3x8 operator*(const float32 Scale) const
+    {
+        FVector3x8 Result;
+        for (uint32 Lane = 0; Lane < NumLanes; ++Lane)
+        {
+            Result.X[Lane] = X[Lane] * Scale;
+            Result.Y[Lane] = Y[Lane] * Scale;
+            Result.Z[Lane] = Z[Lane] * Scale;
+        }
+        return Result;
+    }
+
+    // Dot product of every lane
+    static constexpr void Dot(const FVector3x8& A, const FVector3x8& B, float32 (&OutDots)[NumLanes])
+    {
+        for (uint32 Lane = 0; Lane < NumLanes; ++Lane)
+        {
+            OutDots[Lane] = A.X[Lane] * B.X[Lane] + A.Y[Lane] * B.Y[Lane] + A.Z[Lane] * B.Z[Lane];
+        }
+    }
+
+    // Affine transforms only, the projective row is ignored
+    [[nodiscard]] constexpr FVector3x8 TransformPoints(const FMatrix44& Matrix) const
+    {
+        FVector3x8 Result;
+        for (uint32 Lane = 0; Lane < NumLanes; ++Lane)
+        {
+            Result.X[Lane] = Matrix.M[0][0] * X[Lane] + Matrix.M[0][1] * Y[Lane] + Matrix.M[0][2] * Z[Lane] + Matrix.M[0][3];
+            Result.Y[Lane] = Matrix.M[1][0] * X[Lane] + Matrix.M[1][1] * Y[Lane] + Matrix.M[1][2] * Z[Lane] + Matrix.M[1][3];
+            Result.Z[Lane] = Matrix.M[2][0] * X[Lane] + Matrix.M[2][1] * Y[Lane] + Matrix.M[2][2] * Z[Lane] + Matrix.M[2][3];
+        }
+        return Result;
+    }
+};
+
+// Batch kernels over arrays of FVector3x8, selected at runtime between AVX2 with FMA, SSE2 and scalar code
+namespace Math
+{
+    // Points and OutPoints may be the same array
+    CORE_API void TransformPoints(const FMatrix44& Matrix, const FVector3x8* Points, FVector3x8* OutPoints, size64 Count);
+}
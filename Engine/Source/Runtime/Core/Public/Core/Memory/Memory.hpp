@@ -13,6 +13,8 @@ public:
     static void Free(void* OldPointer, uint8 Alignment = 8);
 
     static void Copy(const void* SourcePointer, void* TargetPointer, size64 Size);
+    static void Move(const void* SourcePointer, void* TargetPointer, size64 Size);
+    static void Set(void* TargetPointer, uint8 Value, size64 Size);
 
     [[nodiscard]] static size64 GetAllocationSize(const void* Pointer);
 
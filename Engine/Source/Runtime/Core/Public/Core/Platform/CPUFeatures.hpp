@@ -0,0 +1,31 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#if defined(_M_X64) || defined(__x86_64__)
+#   define CORVUS_ARCH_X64 1
+#else
+#   define CORVUS_ARCH_X64 0
+#endif
+
+// Marks a function as compiled for an instruction set beyond the baseline. MSVC emits any intrinsic
+// without this, GCC and Clang need the target attribute on every function that inlines the intrinsics
+#if defined(_MSC_VER) && !defined(__clang__)
+#   define CORVUS_TARGET_AVX2
+#   define CORVUS_TARGET_POPCNT
+#else
+#   define CORVUS_TARGET_AVX2 __attribute__((target("avx2,fma,bmi,bmi2,popcnt,lzcnt")))
+#   define CORVUS_TARGET_POPCNT __attribute__((target("popcnt")))
+#endif
+
+class CORE_API FCPUFeatures
+{
+public:
+    [[nodiscard]] static bool8 HasSSE42();
+    [[nodiscard]] static bool8 HasPOPCNT();
+    [[nodiscard]] static bool8 HasAVX();
+    [[nodiscard]] static bool8 HasAVX2();
+    [[nodiscard]] static bool8 HasFMA();
+    [[nodiscard]] static bool8 HasBMI1();
+    [[nodiscard]] static bool8 HasBMI2();
+};
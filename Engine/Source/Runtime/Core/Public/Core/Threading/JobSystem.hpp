@@ -0,0 +1,38 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <type_traits>
+
+using FJobTaskFunction = void (*)(void* Context, size64 TaskIndex);
+
+// Fork-join worker pool. ParallelFor blocks until every task ran, the calling thread executes tasks
+// itself while it waits, so nested ParallelFor calls from inside a task cannot deadlock the pool.
+// Without Initialize (or with zero workers) all tasks run inline on the calling thread
+class CORE_API FJobSystem
+{
+public:
+    static void Initialize(uint32 NumWorkers = 0);
+    static void Shutdown();
+
+    [[nodiscard]] static bool8 IsInitialized();
+
+    [[nodiscard]] static uint32 GetNumWorkers();
+
+    // Worker threads plus the calling thread
+    [[nodiscard]] static uint32 GetNumThreads();
+
+    // 0 for any thread that is not owned by the job system, 1..GetNumWorkers() for workers
+    [[nodiscard]] static uint32 GetCurrentThreadIndex();
+
+    template <typename TFunction> requires std::is_invocable_v<const TFunction&, size64>
+    static void ParallelFor(const size64 NumTasks, const TFunction& Function)
+    {
+        Dispatch(NumTasks, [](void* Context, const size64 TaskIndex)
+        {
+            (*static_cast<const TFunction*>(Context))(TaskIndex);
+        }, const_cast<void*>(static_cast<const void*>(&Function)));
+    }
+
+    static void Dispatch(size64 NumTasks, FJobTaskFunction Function, void* Context);
+};
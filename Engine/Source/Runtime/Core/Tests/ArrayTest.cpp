@@ -4,6 +4,8 @@
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include "Core/Containers/Array.hpp"
 
+#include <string>
+
 struct FTestStruct
 {
     int32 Value;
@@ -26,6 +28,25 @@ struct FTestStruct
     }
 };
 
+// Trivial to construct but not to destroy
+struct FTrivialConstructor
+{
+    int32 Value;
+
+    ~FTrivialConstructor()
+    {
+    }
+};
+
+template <typename TElement>
+concept CanGrowUninitialized = requires(TArray<TElement> Array)
+{
+    Array.AddUninitialized(1);
+} || requires(TArray<TElement> Array)
+{
+    Array.ResizeUninitialized(1);
+};
+
 struct FSmallArrayFixture
 {
     TArray<int32> SmallArray;
@@ -680,6 +701,227 @@ TEST_CASE("TArray::ClearAndReuse", "[Array]")
     REQUIRE(Array[1] == 20);
 }
 
+TEST_CASE("TArray::ResizeUninitialized", "[Array]")
+{
+    TArray<int32> Array{1, 2, 3};
+
+    Array.ResizeUninitialized(6);
+    REQUIRE(Array.Num() == 6);
+    REQUIRE(Array.GetCapacity() >= 6);
+    REQUIRE(Array[0] == 1);
+    REQUIRE(Array[2] == 3);
+
+    Array.ResizeUninitialized(2);
+    REQUIRE(Array.Num() == 2);
+    REQUIRE(Array[1] == 2);
+}
+
+TEST_CASE("TArray::AddUninitialized", "[Array]")
+{
+    TArray<int32> Array{1, 2};
+
+    const size64 FirstIndex = Array.AddUninitialized(3);
+    REQUIRE(FirstIndex == 2);
+    REQUIRE(Array.Num() == 5);
+
+    for (size64 Index = FirstIndex; Index < Array.Num(); ++Index)
+    {
+        Array[Index] = static_cast<int32>(Index * 10);
+    }
+    REQUIRE(Array[0] == 1);
+    REQUIRE(Array[2] == 20);
+    REQUIRE(Array[4] == 40);
+
+    // Elements that need destroying must never hold garbage, so neither uninitialized growth is offered for them
+    STATIC_REQUIRE_FALSE(CanGrowUninitialized<FTrivialConstructor>);
+    STATIC_REQUIRE(CanGrowUninitialized<int32>);
+}
+
+TEST_CASE("TArray::Append", "[Array]")
+{
+    SECTION("AppendSpan")
+    {
+        TArray<int32> Array{1, 2};
+        const int32 Values[] = {3, 4, 5};
+
+        Array.Append(Values);
+
+        REQUIRE(Array == TArray<int32>{1, 2, 3, 4, 5});
+    }
+
+    SECTION("AppendMovedArray")
+    {
+        TArray<int32> Array{1, 2};
+        TArray<int32> Other{3, 4};
+
+        Array.Append(std::move(Other));
+
+        REQUIRE(Array == TArray<int32>{1, 2, 3, 4});
+        REQUIRE(Other.IsEmpty());
+    }
+
+    SECTION("AppendMovedArrayIntoEmpty")
+    {
+        TArray<int32> Array;
+        TArray<int32> Other{3, 4};
+        const int32* OtherData = Other.GetData();
+
+        Array.Append(std::move(Other));
+
+        REQUIRE(Array.Num() == 2);
+        REQUIRE(Array.GetData() == OtherData);
+    }
+
+    SECTION("AppendNonTrivialType")
+    {
+        TArray<std::string> Array{"A"};
+        TArray<std::string> Other{"B", "C"};
+
+        Array.Append(std::move(Other));
+
+        REQUIRE(Array.Num() == 3);
+        REQUIRE(Array[0] == "A");
+        REQUIRE(Array[2] == "C");
+    }
+}
+
+TEST_CASE("TArray::Insert", "[Array]")
+{
+    SECTION("InsertSingle")
+    {
+        TArray<int32> Array{1, 3};
+
+        Array.Insert(1, 2);
+        Array.Insert(0, 0);
+        Array.Insert(Array.Num(), 4);
+
+        REQUIRE(Array == TArray<int32>{0, 1, 2, 3, 4});
+    }
+
+    SECTION("InsertOwnElement")
+    {
+        TArray<std::string> Array{"A", "B"};
+
+        Array.Insert(0, Array[1]);
+
+        REQUIRE(Array.Num() == 3);
+        REQUIRE(Array[0] == "B");
+        REQUIRE(Array[1] == "A");
+        REQUIRE(Array[2] == "B");
+    }
+
+    SECTION("InsertOwnElementWhileGrowing")
+    {
+        // Long enough to live on the heap, a dangling reference reads freed memory
+        TArray<std::string> Array{std::string(64, 'A'), std::string(64, 'B')};
+        Array.ShrinkToFit();
+        REQUIRE(Array.GetCapacity() == Array.Num());
+
+        Array.Insert(Array.Num(), Array[0]);
+        REQUIRE(Array.GetCapacity() > Array.Num());
+        Array.ShrinkToFit();
+        Array.EmplaceBack(Array[1]);
+
+        REQUIRE(Array.Num() == 4);
+        REQUIRE(Array[2] == std::string(64, 'A'));
+        REQUIRE(Array[3] == std::string(64, 'B'));
+    }
+
+    SECTION("InsertSpan")
+    {
+        TArray<int32> Array{1, 5};
+        const int32 Values[] = {2, 3, 4};
+
+        Array.Insert(1, Values);
+
+        REQUIRE(Array == TArray<int32>{1, 2, 3, 4, 5});
+    }
+
+    SECTION("InsertSpanNonTrivialType")
+    {
+        TArray<std::string> Array{"A", "D"};
+        const std::string Values[] = {"B", "C"};
+
+        Array.Insert(1, Values);
+
+        REQUIRE(Array.Num() == 4);
+        REQUIRE(Array[1] == "B");
+        REQUIRE(Array[3] == "D");
+    }
+}
+
+TEST_CASE("TArray::RemoveAt", "[Array]")
+{
+    SECTION("RemoveSingle")
+    {
+        TArray<int32> Array{1, 2, 3, 4};
+
+        Array.RemoveAt(1);
+
+        REQUIRE(Array == TArray<int32>{1, 3, 4});
+    }
+
+    SECTION("RemoveRange")
+    {
+        TArray<int32> Array{1, 2, 3, 4, 5, 6};
+
+        Array.RemoveAt(1, 3);
+
+        REQUIRE(Array == TArray<int32>{1, 5, 6});
+    }
+
+    SECTION("RemoveRangeNonTrivialType")
+    {
+        TArray<std::string> Array{"A", "B", "C", "D"};
+
+        Array.RemoveAt(0, 2);
+
+        REQUIRE(Array.Num() == 2);
+        REQUIRE(Array[0] == "C");
+        REQUIRE(Array[1] == "D");
+    }
+}
+
+TEST_CASE("TArray::RemoveAtSwap", "[Array]")
+{
+    SECTION("RemoveSingle")
+    {
+        TArray<int32> Array{1, 2, 3, 4};
+
+        Array.RemoveAtSwap(0);
+
+        REQUIRE(Array == TArray<int32>{4, 2, 3});
+    }
+
+    SECTION("RemoveRange")
+    {
+        TArray<int32> Array{1, 2, 3, 4, 5, 6};
+
+        Array.RemoveAtSwap(1, 2);
+
+        REQUIRE(Array == TArray<int32>{1, 5, 6, 4});
+    }
+
+    SECTION("RemoveRangeOverlappingTail")
+    {
+        TArray<int32> Array{1, 2, 3, 4, 5};
+
+        Array.RemoveAtSwap(2, 2);
+
+        REQUIRE(Array == TArray<int32>{1, 2, 5});
+    }
+
+    SECTION("RemoveLast")
+    {
+        TArray<std::string> Array{"A", "B"};
+
+        Array.RemoveAtSwap(1);
+
+        REQUIRE(Array.Num() == 1);
+        REQUIRE(Array[0] == "A");
+    }
+}
+
 TEST_CASE("TArray::BenchmarkConstruction", "[Array][.benchmark]")
 {
     BENCHMARK("DefaultConstruction")
@@ -926,3 +1168,75 @@ TEST_CASE("TArray::BenchmarkComplexType", "[Array][.benchmark]")
         return Copy.Num();
     };
 }
+
+TEST_CASE("TArray::BenchmarkBulkOperations", "[Array][.benchmark]")
+{
+    TArray<int32> Source;
+    Source.Resize(100000);
+    for (size64 Index = 0; Index < Source.Num(); ++Index)
+    {
+        Source[Index] = static_cast<int32>(Index);
+    }
+
+    BENCHMARK("Resize")
+    {
+        TArray<int32> Array;
+        Array.Resize(Source.Num());
+        FMemory::Copy(Source.GetData(), Array.GetData(), Source.GetSizeInBytes());
+        return Array.Num();
+    };
+
+    BENCHMARK("ResizeUninitialized")
+    {
+        TArray<int32> Array;
+        Array.ResizeUninitialized(Source.Num());
+        FMemory::Copy(Source.GetData(), Array.GetData(), Source.GetSizeInBytes());
+        return Array.Num();
+    };
+
+    BENCHMARK("PushBackLoop")
+    {
+        TArray<int32> Array;
+        Array.Reserve(Source.Num());
+        for (const int32 Value : Source)
+        {
+            Array.PushBack(Value);
+        }
+        return Array.Num();
+    };
+
+    BENCHMARK("AppendSpan")
+    {
+        TArray<int32> Array;
+        Array.Append(std::span<const int32>(Source.GetData(), Source.Num()));
+        return Array.Num();
+    };
+
+    BENCHMARK("InsertFront")
+    {
+        TArray<int32> Array = Source;
+        const int32 Values[] = {1, 2, 3, 4};
+        Array.Insert(0, Values);
+        return Array.Num();
+    };
+
+    BENCHMARK("RemoveAt")
+    {
+        TArray<int32> Array = Source;
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            Array.RemoveAt(0);
+        }
+        return Array.Num();
+    };
+
+    BENCHMARK("RemoveAtSwap")
+    {
+        TArray<int32> Array = Source;
+        for (int32 Index = 0; Index < 16; ++Index)
+        {
+            Array.RemoveAtSwap(0);
+        }
+        return Array.Num();
+    };
+}
@@ -0,0 +1,354 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <bit>
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/BitArray.hpp"
+
+namespace
+{
+    // Random bits where roughly one in Density is set, along with the same bits as a std::vector<bool> to check against
+    TBitArray MakeRandomBits(const size64 NumBits, const uint32 Density, const uint32 Seed, std::vector<bool>* OutReference = nullptr)
+    {
+        std::mt19937 Random(Seed);
+        TBitArray Bits(NumBits);
+        for (size64 Index = 0; Index < NumBits; ++Index)
+        {
+            const bool8 bValue = Random() % Density == 0;
+            Bits.Set(Index, bValue);
+            if (OutReference != nullptr)
+            {
+                OutReference->push_back(bValue);
+            }
+        }
+        return Bits;
+    }
+
+    TArray<size64> CollectSetBits(const TBitArray& Bits)
+    {
+        TArray<size64> Indices;
+        Bits.ForEachSetBit([&Indices](const size64 Index) { Indices.PushBack(Index); });
+        return Indices;
+    }
+
+    constexpr TStaticBitArray<200> MakeStaticBits()
+    {
+        TStaticBitArray<200> Bits{3, 64, 130, 199};
+        Bits.Flip(130);
+        Bits.Set(131);
+        return Bits;
+    }
+}
+
+TEST_CASE("TStaticBitArray::Constexpr", "[BitArray]")
+{
+    constexpr TStaticBitArray<200> Bits = MakeStaticBits();
+    static_assert(Bits.CountSetBits() == 4);
+    static_assert(Bits.Test(64) && !Bits.Test(130) && Bits[131]);
+    static_assert(Bits.FindSetBit(4) == 64);
+    static_assert(Bits.FindSetBit(200) == BitArray::NotFound);
+    static_assert(TStaticBitArray<200>(true).AllSet());
+    static_assert((~TStaticBitArray<200>()).CountSetBits() == 200);
+    static_assert((Bits & ~Bits).CountSetBits() == 0);
+    static_assert(TStaticBitArray<200>::GetNumWords() == 4);
+
+    REQUIRE(Bits.CountSetBits() == 4);
+    REQUIRE(Bits.GetHash() == MakeStaticBits().GetHash());
+    TArray<size64> Indices;
+    for (const size64 Index : Bits.GetSetBits())
+    {
+        Indices.PushBack(Index);
+    }
+    REQUIRE(Indices == TArray<size64>{3, 64, 131, 199});
+}
+
+TEST_CASE("TStaticBitArray::SetOperations", "[BitArray]")
+{
+    TStaticBitArray<1024> Even;
+    TStaticBitArray<1024> Low;
+    for (size64 Index = 0; Index < 1024; ++Index)
+    {
+        Even.Set(Index, Index % 2 == 0);
+        Low.Set(Index, Index < 300);
+    }
+
+    REQUIRE((Even & Low).CountSetBits() == 150);
+    REQUIRE((Even | Low).CountSetBits() == 512 + 150);
+    REQUIRE((Even ^ Low).CountSetBits() == 512);
+    TStaticBitArray<1024> EvenHigh = Even;
+    EvenHigh.AndNot(Low);
+    REQUIRE(EvenHigh.CountSetBits() == 362);
+    REQUIRE(EvenHigh.FindSetBit() == 300);
+    REQUIRE(Even.ContainsAll(EvenHigh));
+    REQUIRE_FALSE(EvenHigh.ContainsAny(Low));
+    REQUIRE(Low.FindUnsetBit() == 300);
+    REQUIRE(Even.FindUnsetBit(10) == 11);
+
+    // Flipping keeps the bits past Num clear, so the counts and searches never see them
+    TStaticBitArray<70> Tail;
+    Tail.FlipAll();
+    REQUIRE(Tail.CountSetBits() == 70);
+    REQUIRE(Tail.AllSet());
+    REQUIRE(Tail.GetWords()[1] == (uint64(1) << 6) - 1);
+    Tail.Reset(69);
+    REQUIRE(Tail.FindUnsetBit() == 69);
+    REQUIRE_FALSE(Tail.AllSet());
+}
+
+TEST_CASE("TBitArray::MatchesReference", "[BitArray]")
+{
+    // Sizes around the word and vectorization boundaries, with sparse and dense fills
+    for (const size64 NumBits : {size64(0), size64(1), size64(63), size64(64), size64(65), size64(511), size64(512), size64(1000),
+             size64(4097), size64(20000)})
+    {
+        for (const uint32 Density : {1u, 2u, 100u, 5000u})
+        {
+            std::vector<bool> Reference;
+            std::vector<bool> OtherReference;
+            const TBitArray Bits = MakeRandomBits(NumBits, Density, static_cast<uint32>(NumBits) + Density, &Reference);
+            const TBitArray Other = MakeRandomBits(NumBits, 3, 7, &OtherReference);
+
+            size64 ExpectedCount = 0;
+            TArray<size64> ExpectedIndices;
+            for (size64 Index = 0; Index < NumBits; ++Index)
+            {
+                if (Reference[Index])
+                {
+                    ++ExpectedCount;
+                    ExpectedIndices.PushBack(Index);
+                }
+            }
+            REQUIRE(Bits.CountSetBits() == ExpectedCount);
+            REQUIRE(Bits.AnySet() == (ExpectedCount > 0));
+            REQUIRE(Bits.AllSet() == (ExpectedCount == NumBits));
+            REQUIRE(CollectSetBits(Bits) == ExpectedIndices);
+
+            TArray<size64> IteratedIndices;
+            for (const size64 Index : Bits.GetSetBits())
+            {
+                IteratedIndices.PushBack(Index);
+            }
+            REQUIRE(IteratedIndices == ExpectedIndices);
+
+            TArray<size64> FoundIndices;
+            for (size64 Index = Bits.FindSetBit(); Index != BitArray::NotFound; Index = Bits.FindSetBit(Index + 1))
+            {
+                FoundIndices.PushBack(Index);
+            }
+            REQUIRE(FoundIndices == ExpectedIndices);
+
+            TBitArray And = Bits & Other;
+            TBitArray Or = Bits | Other;
+            TBitArray Xor = Bits ^ Other;
+            TBitArray AndNot = Bits;
+            AndNot.AndNot(Other);
+            const TBitArray Not = ~Bits;
+            for (size64 Index = 0; Index < NumBits; ++Index)
+            {
+                REQUIRE(And[Index] == (Reference[Index] && OtherReference[Index]));
+                REQUIRE(Or[Index] == (Reference[Index] || OtherReference[Index]));
+                REQUIRE(Xor[Index] == (Reference[Index] != OtherReference[Index]));
+                REQUIRE(AndNot[Index] == (Reference[Index] && !OtherReference[Index]));
+                REQUIRE(Not[Index] == !Reference[Index]);
+            }
+            REQUIRE(Not.CountSetBits() == NumBits - ExpectedCount);
+            REQUIRE(Or.ContainsAll(Bits));
+            REQUIRE(Bits.ContainsAll(And));
+            REQUIRE_FALSE(AndNot.ContainsAny(Other));
+        }
+    }
+}
+
+TEST_CASE("TBitArray::Resize", "[BitArray]")
+{
+    TBitArray Bits;
+    REQUIRE(Bits.IsEmpty());
+    REQUIRE(Bits.FindSetBit() == BitArray::NotFound);
+    REQUIRE(Bits.FindUnsetBit() == BitArray::NotFound);
+    for (size64 Index = 0; Index < 130; ++Index)
+    {
+        Bits.PushBack(Index % 3 == 0);
+    }
+    REQUIRE(Bits.Num() == 130);
+    REQUIRE(Bits.GetNumWords() == 3);
+    REQUIRE(Bits.CountSetBits() == 44);
+
+    // Growing with set bits fills the rest of the last word and the new words, but nothing past Num
+    Bits.Resize(300, true);
+    REQUIRE(Bits.CountSetBits() == 44 + 170);
+    REQUIRE(Bits.FindUnsetBit(130) == BitArray::NotFound);
+    REQUIRE(Bits.GetWords()[4] == (uint64(1) << 44) - 1);
+
+    // Shrinking clears the bits past the new size, so growing again brings back zeros
+    Bits.Resize(65);
+    REQUIRE(Bits.CountSetBits() == 22);
+    Bits.Resize(200);
+    REQUIRE(Bits.CountSetBits() == 22);
+    REQUIRE(Bits.FindSetBit(64) == BitArray::NotFound);
+
+    TBitArray Full(77, true);
+    REQUIRE(Full.AllSet());
+    REQUIRE(Full.CountSetBits() == 77);
+    Full.ResetAll();
+    REQUIRE_FALSE(Full.AnySet());
+    Full.SetAll();
+    REQUIRE(Full == TBitArray(77, true));
+    REQUIRE(Full.GetHash() == TBitArray(77, true).GetHash());
+    REQUIRE_FALSE(Full == TBitArray(78, true));
+
+    Full.Clear();
+    REQUIRE(Full.IsEmpty());
+    REQUIRE(Full.GetNumWords() == 0);
+}
+
+TEST_CASE("TBitArray::Benchmark", "[BitArray][.benchmark]")
+{
+    static constexpr size64 NumBits = 1 << 20;
+
+    const TBitArray Dense = MakeRandomBits(NumBits, 2, 1);
+    const TBitArray Sparse = MakeRandomBits(NumBits, 100, 2);
+    TBitArray Target = MakeRandomBits(NumBits, 2, 3);
+    const uint64* DenseWords = Dense.GetWords();
+    const size64 NumWords = Dense.GetNumWords();
+
+    BENCHMARK("Count_TBitArray")
+    {
+        return Dense.CountSetBits();
+    };
+
+    BENCHMARK("Count_PopcountLoop")
+    {
+        size64 Count = 0;
+        for (size64 Index = 0; Index < NumWords; ++Index)
+        {
+            Count += static_cast<size64>(std::popcount(DenseWords[Index]));
+        }
+        return Count;
+    };
+
+    BENCHMARK("And_TBitArray")
+    {
+        Target &= Dense;
+        return Target.GetWords()[0];
+    };
+
+    BENCHMARK("Or_TBitArray")
+    {
+        Target |= Sparse;
+        return Target.GetWords()[0];
+    };
+
+    BENCHMARK("Xor_TBitArray")
+    {
+        Target ^= Dense;
+        return Target.GetWords()[0];
+    };
+
+    BENCHMARK("AndNot_TBitArray")
+    {
+        Target.AndNot(Sparse);
+        return Target.GetWords()[0];
+    };
+
+    BENCHMARK("Xor_WordLoop")
+    {
+        uint64* TargetWords = const_cast<uint64*>(Target.GetWords());
+        for (size64 Index = 0; Index < NumWords; ++Index)
+        {
+            TargetWords[Index] ^= DenseWords[Index];
+        }
+        return TargetWords[0];
+    };
+
+    // Set bit iteration at 1% and 50% fill, against testing every bit
+    BENCHMARK("Sparse_ForEachSetBit")
+    {
+        size64 Sum = 0;
+        Sparse.ForEachSetBit([&Sum](const size64 Index) { Sum += Index; });
+        return Sum;
+    };
+
+    BENCHMARK("Sparse_GetSetBits")
+    {
+        size64 Sum = 0;
+        for (const size64 Index : Sparse.GetSetBits())
+        {
+            Sum += Index;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Sparse_TestLoop")
+    {
+        size64 Sum = 0;
+        for (size64 Index = 0; Index < NumBits; ++Index)
+        {
+            if (Sparse.Test(Index))
+            {
+                Sum += Index;
+            }
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Dense_ForEachSetBit")
+    {
+        size64 Sum = 0;
+        Dense.ForEachSetBit([&Sum](const size64 Index) { Sum += Index; });
+        return Sum;
+    };
+
+    BENCHMARK("Dense_GetSetBits")
+    {
+        size64 Sum = 0;
+        for (const size64 Index : Dense.GetSetBits())
+        {
+            Sum += Index;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Dense_TestLoop")
+    {
+        size64 Sum = 0;
+        for (size64 Index = 0; Index < NumBits; ++Index)
+        {
+            if (Dense.Test(Index))
+            {
+                Sum += Index;
+            }
+        }
+        return Sum;
+    };
+
+    // Occupancy style scan where only a few words near the end are used, so zero word skipping dominates
+    TBitArray Occupancy(NumBits);
+    for (size64 Index = NumBits - 512; Index < NumBits; Index += 7)
+    {
+        Occupancy.Set(Index);
+    }
+
+    BENCHMARK("Empty_ForEachSetBit")
+    {
+        size64 Sum = 0;
+        Occupancy.ForEachSetBit([&Sum](const size64 Index) { Sum += Index; });
+        return Sum;
+    };
+
+    BENCHMARK("Empty_WordLoop")
+    {
+        size64 Sum = 0;
+        const uint64* Words = Occupancy.GetWords();
+        for (size64 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+        {
+            for (uint64 Word = Words[WordIndex]; Word != 0; Word &= Word - 1)
+            {
+                Sum += WordIndex * 64 + static_cast<size64>(std::countr_zero(Word));
+            }
+        }
+        return Sum;
+    };
+}
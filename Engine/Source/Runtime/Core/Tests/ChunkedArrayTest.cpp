@@ -0,0 +1,310 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <deque>
+#include <list>
+#include <string>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/ChunkedArray.hpp"
+#include "Core/Memory/SmartPointers.hpp"
+
+namespace
+{
+    // Tracks live instances, so leaked or doubly destroyed elements show up as a non zero count
+    struct FChunkedTracked
+    {
+        static inline int32 NumAlive = 0;
+
+        int32 Value = 0;
+
+        FChunkedTracked(const int32 InValue = 0)
+            : Value(InValue)
+        {
+            ++NumAlive;
+        }
+
+        FChunkedTracked(const FChunkedTracked& Other)
+            : Value(Other.Value)
+        {
+            ++NumAlive;
+        }
+
+        ~FChunkedTracked()
+        {
+            --NumAlive;
+        }
+    };
+
+    // A particle sized element for the benchmarks
+    struct FChunkedParticle
+    {
+        float Position[3];
+        float Velocity[3];
+        float Age;
+        float Lifetime;
+    };
+}
+
+TEST_CASE("TChunkedArray::StableAddresses", "[ChunkedArray]")
+{
+    TChunkedArray<int32, 16> Array;
+    REQUIRE(Array.IsEmpty());
+    REQUIRE(Array.begin() == Array.end());
+
+    TArray<int32*> Addresses;
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        Addresses.PushBack(&Array.EmplaceBack(Index));
+    }
+    REQUIRE(Array.Num() == 1000);
+    REQUIRE(Array.GetNumChunks() == 63);
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        // Growing never moved an element
+        REQUIRE(Addresses[Index] == &Array[Index]);
+        REQUIRE(*Addresses[Index] == Index);
+    }
+    REQUIRE(Array.GetFirst() == 0);
+    REQUIRE(Array.GetLast() == 999);
+
+    // Chunks start on a cache line
+    for (size64 ChunkIndex = 0; ChunkIndex < Array.GetNumChunks(); ++ChunkIndex)
+    {
+        REQUIRE(reinterpret_cast<uintptr_t>(Array.GetChunk(ChunkIndex).data()) % 64 == 0);
+    }
+    REQUIRE(Array.GetChunk(62).size() == 1000 - 62 * 16);
+}
+
+TEST_CASE("TChunkedArray::Iteration", "[ChunkedArray]")
+{
+    // Sizes that end inside a chunk, exactly on a chunk boundary and just past one
+    for (const size64 Count : {size64(1), size64(7), size64(8), size64(9), size64(16), size64(17), size64(100)})
+    {
+        TChunkedArray<size64, 8> Array;
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            Array.PushBack(Index);
+        }
+
+        size64 Expected = 0;
+        for (const size64 Value : Array)
+        {
+            REQUIRE(Value == Expected++);
+        }
+        REQUIRE(Expected == Count);
+
+        Expected = 0;
+        const TChunkedArray<size64, 8>& ConstArray = Array;
+        ConstArray.ForEachChunk([&Expected](const std::span<const size64> Elements)
+        {
+            for (const size64 Value : Elements)
+            {
+                REQUIRE(Value == Expected++);
+            }
+        });
+        REQUIRE(Expected == Count);
+
+        for (size64& Value : Array)
+        {
+            Value *= 2;
+        }
+        TChunkedArray<size64, 8>::ConstIterator Iterator = Array.begin();
+        std::advance(Iterator, Count - 1);
+        REQUIRE(*Iterator == (Count - 1) * 2);
+        REQUIRE(++Iterator == Array.cend());
+    }
+}
+
+TEST_CASE("TChunkedArray::Lifetime", "[ChunkedArray]")
+{
+    {
+        TChunkedArray<FChunkedTracked, 4> Array;
+        for (int32 Index = 0; Index < 10; ++Index)
+        {
+            Array.EmplaceBack(Index);
+        }
+        REQUIRE(FChunkedTracked::NumAlive == 10);
+
+        TChunkedArray<FChunkedTracked, 4> Copy(Array);
+        REQUIRE(FChunkedTracked::NumAlive == 20);
+        REQUIRE(Copy[9].Value == 9);
+
+        Array.PopBack();
+        Array.PopBack();
+        REQUIRE(FChunkedTracked::NumAlive == 18);
+
+        Array.ShrinkToFit();
+        REQUIRE(Array.GetCapacity() == 8);
+
+        // The chunks are reused, the first element lands where it was before
+        const FChunkedTracked* First = &Array[0];
+        Array.Clear();
+        REQUIRE(FChunkedTracked::NumAlive == 10);
+        Array.EmplaceBack(42);
+        REQUIRE(&Array[0] == First);
+
+        TChunkedArray<FChunkedTracked, 4> Moved(std::move(Copy));
+        REQUIRE(Copy.IsEmpty());
+        REQUIRE(Moved.Num() == 10);
+        Array = Moved;
+        REQUIRE(FChunkedTracked::NumAlive == 20);
+        Array.Resize(3);
+        Array.Resize(6);
+        REQUIRE(Array[2].Value == 2);
+        REQUIRE(Array[5].Value == 0);
+        REQUIRE(FChunkedTracked::NumAlive == 16);
+    }
+    REQUIRE(FChunkedTracked::NumAlive == 0);
+
+    TChunkedArray<std::string> Strings{"one", "two", "three"};
+    REQUIRE(Strings == TChunkedArray<std::string>{"one", "two", "three"});
+    REQUIRE_FALSE(Strings == TChunkedArray<std::string>{"one", "two"});
+    REQUIRE(TChunkedArray<std::string>::ElementsPerChunk == 512);
+}
+
+TEST_CASE("TChunkedArray::Benchmark", "[ChunkedArray][.benchmark]")
+{
+    static constexpr size64 NumElements = 1 << 20;
+
+    BENCHMARK("Append_TChunkedArray")
+    {
+        TChunkedArray<FChunkedParticle> Particles;
+        for (size64 Index = 0; Index < NumElements; ++Index)
+        {
+            Particles.PushBack(FChunkedParticle{{float(Index), 0, 0}, {1, 0, 0}, 0, 1});
+        }
+        return Particles.Num();
+    };
+
+    BENCHMARK("Append_TArray")
+    {
+        TArray<FChunkedParticle> Particles;
+        for (size64 Index = 0; Index < NumElements; ++Index)
+        {
+            Particles.PushBack(FChunkedParticle{{float(Index), 0, 0}, {1, 0, 0}, 0, 1});
+        }
+        return Particles.Num();
+    };
+
+    BENCHMARK("Append_StdDeque")
+    {
+        std::deque<FChunkedParticle> Particles;
+        for (size64 Index = 0; Index < NumElements; ++Index)
+        {
+            Particles.push_back(FChunkedParticle{{float(Index), 0, 0}, {1, 0, 0}, 0, 1});
+        }
+        return Particles.size();
+    };
+
+    BENCHMARK("Append_TUniquePtr")
+    {
+        TArray<TUniquePtr<FChunkedParticle>> Particles;
+        for (size64 Index = 0; Index < NumElements; ++Index)
+        {
+            Particles.PushBack(MakeUnique<FChunkedParticle>(FChunkedParticle{{float(Index), 0, 0}, {1, 0, 0}, 0, 1}));
+        }
+        return Particles.Num();
+    };
+
+    BENCHMARK("Append_StdList")
+    {
+        std::list<FChunkedParticle> Particles;
+        for (size64 Index = 0; Index < NumElements; ++Index)
+        {
+            Particles.push_back(FChunkedParticle{{float(Index), 0, 0}, {1, 0, 0}, 0, 1});
+        }
+        return Particles.size();
+    };
+
+    // Integer sums, which the compiler vectorizes over a contiguous run
+    TChunkedArray<int32> Chunked;
+    TArray<int32> Contiguous;
+    std::deque<int32> Deque;
+    TArray<TUniquePtr<int32>> Nodes;
+    std::list<int32> List;
+    for (size64 Index = 0; Index < NumElements; ++Index)
+    {
+        const int32 Value = static_cast<int32>(Index % 1000);
+        Chunked.PushBack(Value);
+        Contiguous.PushBack(Value);
+        Deque.push_back(Value);
+        Nodes.PushBack(MakeUnique<int32>(Value));
+        List.push_back(Value);
+    }
+
+    BENCHMARK("Sum_TChunkedArray_Chunks")
+    {
+        int32 Sum = 0;
+        Chunked.ForEachChunk([&Sum](const std::span<const int32> Values)
+        {
+            int32 ChunkSum = 0;
+            for (const int32 Value : Values)
+            {
+                ChunkSum += Value;
+            }
+            Sum += ChunkSum;
+        });
+        return Sum;
+    };
+
+    BENCHMARK("Sum_TChunkedArray_Iterator")
+    {
+        int32 Sum = 0;
+        for (const int32 Value : Chunked)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Sum_TChunkedArray_Index")
+    {
+        int32 Sum = 0;
+        for (size64 Index = 0; Index < NumElements; ++Index)
+        {
+            Sum += Chunked[Index];
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Sum_TArray")
+    {
+        int32 Sum = 0;
+        for (const int32 Value : Contiguous)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Sum_StdDeque")
+    {
+        int32 Sum = 0;
+        for (const int32 Value : Deque)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Sum_TUniquePtr")
+    {
+        int32 Sum = 0;
+        for (const TUniquePtr<int32>& Value : Nodes)
+        {
+            Sum += *Value;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Sum_StdList")
+    {
+        int32 Sum = 0;
+        for (const int32 Value : List)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+}
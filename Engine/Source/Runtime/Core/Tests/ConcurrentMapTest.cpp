@@ -0,0 +1,233 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/ConcurrentMap.hpp"
+#include "Core/Containers/Map.hpp"
+
+namespace
+{
+    template <typename TFunction>
+    void RunOnThreads(const uint32 NumThreads, TFunction&& Function)
+    {
+        TArray<std::thread> Threads;
+        Threads.Reserve(NumThreads);
+        for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+        {
+            Threads.EmplaceBack(Function, ThreadIndex);
+        }
+        for (std::thread& Thread : Threads)
+        {
+            Thread.join();
+        }
+    }
+
+    // What the shared caches used before, one mutex around the whole map
+    struct FGlobalMutexMap
+    {
+        bool8 Find(const int64 Key, int64& OutValue)
+        {
+            std::lock_guard Lock(Mutex);
+            const auto Position = Map.Find(Key);
+            if (Position == Map.end())
+            {
+                return false;
+            }
+            OutValue = Position->second;
+            return true;
+        }
+
+        void InsertOrAssign(const int64 Key, const int64 Value)
+        {
+            std::lock_guard Lock(Mutex);
+            Map[Key] = Value;
+        }
+
+        std::mutex Mutex;
+        TMap<int64, int64> Map;
+    };
+
+    // Every thread runs its share of NumOperations on random keys, WritePercent of them are writes
+    template <typename TMapType>
+    int64 RunMixedWorkload(TMapType& Map, const uint32 NumThreads, const int64 NumKeys, const int64 NumOperations, const uint32 WritePercent)
+    {
+        std::atomic<int64> Sum = 0;
+        RunOnThreads(NumThreads, [&](const uint32 ThreadIndex)
+        {
+            uint64 State = 0x9E3779B97F4A7C15ull * (ThreadIndex + 1);
+            int64 LocalSum = 0;
+            for (int64 Operation = 0; Operation < NumOperations / NumThreads; ++Operation)
+            {
+                State ^= State << 13;
+                State ^= State >> 7;
+                State ^= State << 17;
+                const int64 Key = static_cast<int64>(State % static_cast<uint64>(NumKeys));
+                int64 Value = 0;
+                if ((State >> 32) % 100 < WritePercent)
+                {
+                    Map.InsertOrAssign(Key, Operation);
+                }
+                else if (Map.Find(Key, Value))
+                {
+                    LocalSum += Value;
+                }
+            }
+            Sum.fetch_add(LocalSum, std::memory_order_relaxed);
+        });
+        return Sum.load();
+    }
+}
+
+TEST_CASE("TConcurrentMap::SingleThreaded", "[ConcurrentMap]")
+{
+    TConcurrentMap<std::string, int32> Map;
+    REQUIRE(Map.IsEmpty());
+    REQUIRE(Map.Insert("a", 1));
+    REQUIRE_FALSE(Map.Insert("a", 2));
+    REQUIRE(Map.InsertOrAssign("b", 3));
+    REQUIRE_FALSE(Map.InsertOrAssign("b", 4));
+
+    int32 Value = 0;
+    REQUIRE(Map.Find("a", Value));
+    REQUIRE(Value == 1);
+    REQUIRE(Map.Find("b", Value));
+    REQUIRE(Value == 4);
+    REQUIRE_FALSE(Map.Find("c", Value));
+    REQUIRE(Map.Contains("b"));
+    REQUIRE(Map.Visit("a", [](const int32 Found) { REQUIRE(Found == 1); }));
+    REQUIRE_FALSE(Map.Visit("c", [](const int32) { FAIL("Visited a missing key"); }));
+
+    REQUIRE(Map.FindOrAdd("a", [] { return 10; }) == 1);
+    REQUIRE(Map.FindOrAdd("c", [] { return 10; }) == 10);
+    REQUIRE(Map.Num() == 3);
+
+    int32 Total = 0;
+    Map.ForEach([&](const std::string&, const int32 Found) { Total += Found; });
+    REQUIRE(Total == 15);
+
+    REQUIRE(Map.Remove("a") == 1);
+    REQUIRE(Map.Remove("a") == 0);
+    REQUIRE_FALSE(Map.Contains("a"));
+    Map.Clear();
+    REQUIRE(Map.IsEmpty());
+}
+
+TEST_CASE("TConcurrentMap::FindOrAddRunsFactoryOnce", "[ConcurrentMap]")
+{
+    static constexpr int32 NumKeys = 512;
+    static constexpr uint32 NumThreads = 8;
+
+    TConcurrentMap<int32, int32> Map;
+    std::atomic<int32> NumCalls[NumKeys] = {};
+    std::atomic<int32> NumMismatches = 0;
+    RunOnThreads(NumThreads, [&](const uint32 ThreadIndex)
+    {
+        // Every thread walks the keys from a different start, so threads collide on keys all the time
+        for (int32 Step = 0; Step < NumKeys; ++Step)
+        {
+            const int32 Key = (Step + static_cast<int32>(ThreadIndex) * 61) % NumKeys;
+            const int32 Value = Map.FindOrAdd(Key, [&]
+            {
+                NumCalls[Key].fetch_add(1);
+                // Gives the other threads a chance to ask for the key while it is pending
+                std::this_thread::yield();
+                return Key * 3;
+            });
+            if (Value != Key * 3)
+            {
+                NumMismatches.fetch_add(1);
+            }
+        }
+    });
+
+    REQUIRE(NumMismatches == 0);
+    REQUIRE(Map.Num() == NumKeys);
+    for (int32 Key = 0; Key < NumKeys; ++Key)
+    {
+        REQUIRE(NumCalls[Key] == 1);
+    }
+}
+
+TEST_CASE("TConcurrentMap::NestedFindOrAdd", "[ConcurrentMap]")
+{
+    // A single shard, so the nested call always lands on the shard of the pending key
+    TConcurrentMap<int32, int32, THash<int32>, std::equal_to<int32>, 1> Map;
+    const int32 Value = Map.FindOrAdd(1, [&]
+    {
+        return Map.FindOrAdd(2, [] { return 20; }) + 1;
+    });
+    REQUIRE(Value == 21);
+    REQUIRE(Map.Num() == 2);
+}
+
+TEST_CASE("TConcurrentMap::ConcurrentWriters", "[ConcurrentMap]")
+{
+    static constexpr int32 KeysPerThread = 4000;
+    static constexpr uint32 NumThreads = 6;
+
+    // Threads own disjoint keys, add them all and remove every odd one while the others read
+    TConcurrentMap<int32, int32> Map;
+    RunOnThreads(NumThreads, [&](const uint32 ThreadIndex)
+    {
+        const int32 FirstKey = static_cast<int32>(ThreadIndex) * KeysPerThread;
+        for (int32 Key = FirstKey; Key < FirstKey + KeysPerThread; ++Key)
+        {
+            Map.Insert(Key, Key * 2);
+        }
+        for (int32 Key = FirstKey + 1; Key < FirstKey + KeysPerThread; Key += 2)
+        {
+            Map.Remove(Key);
+        }
+    });
+
+    REQUIRE(Map.Num() == NumThreads * KeysPerThread / 2);
+    for (int32 Key = 0; Key < static_cast<int32>(NumThreads) * KeysPerThread; ++Key)
+    {
+        int32 Value = 0;
+        REQUIRE(Map.Find(Key, Value) == (Key % 2 == 0));
+        if (Key % 2 == 0)
+        {
+            REQUIRE(Value == Key * 2);
+        }
+    }
+}
+
+TEST_CASE("TConcurrentMap::BenchmarkScaling", "[ConcurrentMap][.benchmark]")
+{
+    static constexpr int64 NumKeys = 1 << 16;
+    static constexpr int64 NumOperations = 1 << 20;
+
+    TConcurrentMap<int64, int64> ConcurrentMap;
+    FGlobalMutexMap GlobalMutexMap;
+    ConcurrentMap.Reserve(NumKeys);
+    GlobalMutexMap.Map.Reserve(NumKeys);
+    for (int64 Key = 0; Key < NumKeys; ++Key)
+    {
+        ConcurrentMap.Insert(Key, Key);
+        GlobalMutexMap.Map[Key] = Key;
+    }
+
+    // Same total work at every thread count, perfect scaling halves the time per doubling
+    for (const uint32 WritePercent : {1u, 50u})
+    {
+        for (const uint32 NumThreads : {1u, 2u, 4u, 8u, 16u, 32u})
+        {
+            // R99_8T is 99% reads on 8 threads
+            const std::string Suffix = "_R" + std::to_string(100 - WritePercent) + "_" + std::to_string(NumThreads) + "T";
+            BENCHMARK("TConcurrentMap" + Suffix)
+            {
+                return RunMixedWorkload(ConcurrentMap, NumThreads, NumKeys, NumOperations, WritePercent);
+            };
+
+            BENCHMARK("GlobalMutexTMap" + Suffix)
+            {
+                return RunMixedWorkload(GlobalMutexMap, NumThreads, NumKeys, NumOperations, WritePercent);
+            };
+        }
+    }
+}
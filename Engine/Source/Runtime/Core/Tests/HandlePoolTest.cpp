@@ -0,0 +1,229 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/HandlePool.hpp"
+#include "Core/Containers/Map.hpp"
+
+#include <random>
+#include <string>
+
+TEST_CASE("THandle::Packing", "[HandlePool]")
+{
+    STATIC_REQUIRE(sizeof(FHandle32) == 4);
+    STATIC_REQUIRE(sizeof(FHandle64) == 8);
+
+    constexpr FHandle32 Handle = FHandle32::Make(FHandle32::MaxIndex, 4095);
+    STATIC_REQUIRE(Handle.GetIndex() == FHandle32::MaxIndex);
+    STATIC_REQUIRE(Handle.GetGeneration() == 4095);
+    STATIC_REQUIRE_FALSE(FHandle64().IsValid());
+}
+
+TEST_CASE("THandleSlots::AcquireRelease", "[HandlePool]")
+{
+    using FTinyHandle = THandle<uint16, 12>;
+    THandleSlots<FTinyHandle> Slots;
+
+    const FTinyHandle First = Slots.Acquire(7);
+    const FTinyHandle Second = Slots.Acquire(8);
+    REQUIRE(Slots.Contains(First));
+    REQUIRE(Slots.GetTarget(Second.GetIndex()) == 8);
+    Slots.SetTarget(First.GetIndex(), 3);
+    REQUIRE(Slots.GetTarget(First.GetIndex()) == 3);
+    REQUIRE_FALSE(Slots.Contains(FTinyHandle{}));
+
+    // Released slots are reused with the next generation
+    FTinyHandle Handle = First;
+    Slots.Release(Handle.GetIndex());
+    REQUIRE_FALSE(Slots.Contains(Handle));
+    Handle = Slots.Acquire(0);
+    REQUIRE(Handle.GetIndex() == First.GetIndex());
+    REQUIRE(Handle.GetGeneration() == First.GetGeneration() + 1);
+    REQUIRE(Slots.GetHandle(Handle.GetIndex()) == Handle);
+
+    while (Handle.GetGeneration() < FTinyHandle::MaxGeneration)
+    {
+        Slots.Release(Handle.GetIndex());
+        Handle = Slots.Acquire(0);
+    }
+    Slots.Release(Handle.GetIndex());
+    REQUIRE_FALSE(Slots.Contains(Handle));
+    REQUIRE(Slots.Acquire(0).GetIndex() != First.GetIndex());
+    REQUIRE(Slots.Contains(Second));
+}
+
+TEST_CASE("THandlePool::InsertFindRemove", "[HandlePool]")
+{
+    THandlePool<std::string> Pool;
+
+    const FHandle64 First = Pool.Insert("first");
+    const FHandle64 Second = Pool.Emplace(3, 'b');
+    REQUIRE(Pool.Num() == 2);
+    REQUIRE(Pool[First] == "first");
+    REQUIRE(*Pool.Find(Second) == "bbb");
+
+    REQUIRE(Pool.Remove(First));
+    REQUIRE_FALSE(Pool.Contains(First));
+    REQUIRE(Pool.Find(First) == nullptr);
+    REQUIRE_FALSE(Pool.Remove(First));
+
+    // The removed slot is recycled with a new generation, the stale handle keeps failing
+    const FHandle64 Third = Pool.Insert("third");
+    REQUIRE(Third.GetIndex() == First.GetIndex());
+    REQUIRE(Third.GetGeneration() == First.GetGeneration() + 1);
+    REQUIRE_FALSE(Pool.Contains(First));
+    REQUIRE(Pool[Third] == "third");
+    REQUIRE(Pool[Second] == "bbb");
+
+    REQUIRE(Pool.Find(FHandle64()) == nullptr);
+}
+
+TEST_CASE("THandlePool::DenseIteration", "[HandlePool]")
+{
+    THandlePool<int32> Pool;
+    TArray<FHandle64> Handles;
+    for (int32 Index = 0; Index < 100; ++Index)
+    {
+        Handles.PushBack(Pool.Insert(Index));
+    }
+    for (size64 Index = 0; Index < Handles.Num(); Index += 2)
+    {
+        Pool.Remove(Handles[Index]);
+    }
+
+    int32 Sum = 0;
+    for (const int32 Value : Pool)
+    {
+        Sum += Value;
+    }
+    REQUIRE(Pool.Num() == 50);
+    REQUIRE(Sum == 2500);
+
+    for (size64 DenseIndex = 0; DenseIndex < Pool.Num(); ++DenseIndex)
+    {
+        REQUIRE(Pool[Pool.GetHandleAt(DenseIndex)] == Pool.GetData()[DenseIndex]);
+    }
+    for (size64 Index = 1; Index < Handles.Num(); Index += 2)
+    {
+        REQUIRE(Pool[Handles[Index]] == static_cast<int32>(Index));
+    }
+}
+
+TEST_CASE("THandlePool::Clear", "[HandlePool]")
+{
+    THandlePool<int32, FHandle32> Pool;
+    const FHandle32 Handle = Pool.Insert(1);
+    Pool.Clear();
+    REQUIRE(Pool.IsEmpty());
+    REQUIRE_FALSE(Pool.Contains(Handle));
+
+    const FHandle32 Recycled = Pool.Insert(2);
+    REQUIRE(Recycled.GetIndex() == Handle.GetIndex());
+    REQUIRE(Pool[Recycled] == 2);
+}
+
+TEST_CASE("THandlePool::GenerationOverflowRetiresSlot", "[HandlePool]")
+{
+    using FTinyHandle = THandle<uint16, 12>;
+    THandlePool<int32, FTinyHandle> Pool;
+
+    FTinyHandle Handle = Pool.Insert(0);
+    const uint32 SlotIndex = Handle.GetIndex();
+    for (uint32 Iteration = 1; Iteration < FTinyHandle::MaxGeneration; ++Iteration)
+    {
+        Pool.Remove(Handle);
+        Handle = Pool.Insert(static_cast<int32>(Iteration));
+        REQUIRE(Handle.GetIndex() == SlotIndex);
+    }
+    REQUIRE(Handle.GetGeneration() == FTinyHandle::MaxGeneration);
+
+    Pool.Remove(Handle);
+    const FTinyHandle Fresh = Pool.Insert(42);
+    REQUIRE(Fresh.GetIndex() != SlotIndex);
+    REQUIRE_FALSE(Pool.Contains(Handle));
+}
+
+TEST_CASE("THandlePool::BenchmarkLookup", "[HandlePool][.benchmark]")
+{
+    constexpr size64 Count = 100000;
+
+    struct FResource
+    {
+        float32 Data[8];
+    };
+
+    // Populate through churn so both containers see the fragmentation of long lived resource tables
+    THandlePool<FResource> Pool;
+    TMap<uint64, FResource> Map;
+    TArray<FHandle64> Handles;
+    std::mt19937 Generator(7);
+    for (size64 Index = 0; Index < Count * 2; ++Index)
+    {
+        const FHandle64 Handle = Pool.Insert(FResource{{static_cast<float32>(Index)}});
+        Handles.PushBack(Handle);
+        Map.Insert({Handle.Value, FResource{{static_cast<float32>(Index)}}});
+    }
+    for (size64 Index = 0; Index < Count; ++Index)
+    {
+        const size64 Victim = Generator() % Handles.Num();
+        Pool.Remove(Handles[Victim]);
+        Map.Remove(Handles[Victim].Value);
+        Handles.RemoveAtSwap(Victim);
+    }
+
+    TArray<FHandle64> Queries;
+    for (size64 Index = 0; Index < Count; ++Index)
+    {
+        Queries.PushBack(Handles[Generator() % Handles.Num()]);
+    }
+
+    BENCHMARK("HandlePool_Find")
+    {
+        float32 Sum = 0.0f;
+        for (const FHandle64 Handle : Queries)
+        {
+            Sum += Pool.Find(Handle)->Data[0];
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Map_Find")
+    {
+        float32 Sum = 0.0f;
+        for (const FHandle64 Handle : Queries)
+        {
+            Sum += Map.Find(Handle.Value)->second.Data[0];
+        }
+        return Sum;
+    };
+
+    BENCHMARK("HandlePool_InsertRemove")
+    {
+        THandlePool<FResource> Churn;
+        TArray<FHandle64> Live;
+        Live.Reserve(Count);
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            Live.PushBack(Churn.Insert(FResource{}));
+        }
+        for (const FHandle64 Handle : Live)
+        {
+            Churn.Remove(Handle);
+        }
+        return Churn.Num();
+    };
+
+    BENCHMARK("Map_InsertRemove")
+    {
+        TMap<uint64, FResource> Churn;
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            Churn.Insert({Index, FResource{}});
+        }
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            Churn.Remove(Index);
+        }
+        return Churn.Num();
+    };
+}
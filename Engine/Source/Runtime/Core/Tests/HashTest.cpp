@@ -0,0 +1,217 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "Core/Hash/Hash.hpp"
+
+#include <bit>
+#include <random>
+#include <string>
+
+struct FHashTestKey
+{
+    uint32 A;
+    uint32 B;
+
+    [[nodiscard]] uint64 GetHash() const
+    {
+        return Hash::Combine(Hash::MixInteger(A), B);
+    }
+
+    bool8 operator==(const FHashTestKey& Other) const = default;
+};
+
+enum class EHashTestEnum : uint8
+{
+    First,
+    Second
+};
+
+// What std::hash does for integers on common standard libraries
+struct FIdentityHasher
+{
+    size64 operator()(const int64 Value) const noexcept
+    {
+        return static_cast<size64>(Value);
+    }
+};
+
+namespace
+{
+    // Longest collision chain of a map, walking it bucket by bucket
+    template <typename TMapType>
+    size64 GetLongestChain(const TMapType& Map)
+    {
+        size64 Longest = 0;
+        size64 Current = 0;
+        size64 CurrentBucket = static_cast<size64>(-1);
+        for (auto Iterator = Map.begin(); Iterator != Map.end(); ++Iterator)
+        {
+            Current = Iterator.CurrentBucket == CurrentBucket ? Current + 1 : 1;
+            CurrentBucket = Iterator.CurrentBucket;
+            Longest = Current > Longest ? Current : Longest;
+        }
+        return Longest;
+    }
+}
+
+TEST_CASE("Hash::HashBytes", "[Core][Hash]")
+{
+    const std::string Text = "The quick brown fox jumps over the lazy dog, then keeps running for a while";
+    REQUIRE(Hash::HashBytes(Text.data(), Text.size()) == Hash::HashBytes(Text.data(), Text.size()));
+    REQUIRE(Hash::HashBytes(Text.data(), Text.size()) != Hash::HashBytes(Text.data(), Text.size(), 1));
+
+    // The length takes part, so prefixes of zeros differ from each other
+    const uint8 Zeros[128] = {};
+    TArray<uint64> Hashes;
+    for (size64 Size = 0; Size <= 128; ++Size)
+    {
+        const uint64 Value = Hash::HashBytes(Zeros, Size);
+        for (const uint64 Other : Hashes)
+        {
+            REQUIRE(Value != Other);
+        }
+        Hashes.PushBack(Value);
+    }
+
+    // Flipping any input bit flips about half of the output bits, for every size class
+    std::mt19937_64 Random(17);
+    for (const size64 Size : {3, 8, 13, 16, 31, 48, 100})
+    {
+        uint8 Bytes[100];
+        for (uint8& Byte : Bytes)
+        {
+            Byte = static_cast<uint8>(Random());
+        }
+        const uint64 Original = Hash::HashBytes(Bytes, Size);
+        uint64 FlippedBits = 0;
+        for (size64 Bit = 0; Bit < Size * 8; ++Bit)
+        {
+            Bytes[Bit / 8] ^= static_cast<uint8>(1 << (Bit % 8));
+            FlippedBits += static_cast<uint64>(std::popcount(Original ^ Hash::HashBytes(Bytes, Size)));
+            Bytes[Bit / 8] ^= static_cast<uint8>(1 << (Bit % 8));
+        }
+        const float64 AverageFlipped = static_cast<float64>(FlippedBits) / static_cast<float64>(Size * 8);
+        REQUIRE(AverageFlipped > 28.0);
+        REQUIRE(AverageFlipped < 36.0);
+    }
+}
+
+TEST_CASE("Hash::THash", "[Core][Hash]")
+{
+    static_assert(CHashable<int32> && CHashable<float32> && CHashable<std::string> && CHashable<FHashTestKey> && CHashable<EHashTestEnum>);
+    static_assert(THash<uint64>{}(42) == Hash::MixInteger(42));
+
+    REQUIRE(THash<int32>{}(1) != THash<int32>{}(2));
+    REQUIRE(THash<EHashTestEnum>{}(EHashTestEnum::First) != THash<EHashTestEnum>{}(EHashTestEnum::Second));
+    REQUIRE(THash<float32>{}(0.0f) == THash<float32>{}(-0.0f));
+    REQUIRE(THash<float64>{}(1.5) != THash<float64>{}(-1.5));
+
+    // Strings and their views agree, so lookups could take either
+    const std::string Text = "Corvus";
+    REQUIRE(THash<std::string>{}(Text) == THash<std::string_view>{}(std::string_view(Text)));
+    REQUIRE(THash<std::string>{}(Text) != THash<std::string>{}("corvus"));
+    REQUIRE(THash<std::wstring>{}(L"Corvus") == THash<std::wstring_view>{}(L"Corvus"));
+
+    const int32 Values[2] = {};
+    REQUIRE(THash<const int32*>{}(&Values[0]) != THash<const int32*>{}(&Values[1]));
+    REQUIRE(THash<std::pair<int32, int32>>{}({1, 2}) != THash<std::pair<int32, int32>>{}({2, 1}));
+    REQUIRE(THash<FHashTestKey>{}({1, 2}) == FHashTestKey{1, 2}.GetHash());
+
+    TMap<FHashTestKey, int32> Map;
+    Map[{1, 2}] = 3;
+    REQUIRE(Map.Find({1, 2})->second == 3);
+    REQUIRE_FALSE(Map.Contains({2, 1}));
+}
+
+TEST_CASE("Hash::ChainLengths", "[Core][Hash]")
+{
+    static constexpr int64 NumKeys = 1 << 16;
+
+    // Sequential, strided and pointer like keys all spread evenly
+    for (const int64 Stride : {int64(1), int64(16), int64(4096), int64(1) << 32})
+    {
+        TMap<int64, int32> Map;
+        for (int64 Index = 0; Index < NumKeys; ++Index)
+        {
+            Map[Index * Stride] = 0;
+        }
+        REQUIRE(GetLongestChain(Map) <= 12);
+    }
+
+    // Without mixing, strided keys pile up in a fraction of the power of two buckets
+    TMap<int64, int32, FIdentityHasher> Identity;
+    for (int64 Index = 0; Index < NumKeys; ++Index)
+    {
+        Identity[Index * 4096] = 0;
+    }
+    REQUIRE(GetLongestChain(Identity) >= 1000);
+}
+
+TEST_CASE("Hash::Benchmark", "[Core][Hash][.benchmark]")
+{
+    std::mt19937_64 Random(23);
+    TArray<uint8> Bytes;
+    Bytes.ResizeUninitialized(64 * 1024);
+    for (uint8& Byte : Bytes)
+    {
+        Byte = static_cast<uint8>(Random());
+    }
+
+    for (const size64 Size : {8, 16, 64, 1024, 64 * 1024})
+    {
+        const std::string_view Key(reinterpret_cast<const char*>(Bytes.GetData()), Size);
+        const std::string Suffix = std::to_string(Size);
+        BENCHMARK("HashBytes_" + Suffix)
+        {
+            return Hash::HashBytes(Key.data(), Key.size());
+        };
+
+        BENCHMARK("StdHash_" + Suffix)
+        {
+            return std::hash<std::string_view>{}(Key);
+        };
+    }
+
+    BENCHMARK("MixInteger_1024")
+    {
+        uint64 Sum = 0;
+        for (uint64 Index = 0; Index < 1024; ++Index)
+        {
+            Sum += Hash::MixInteger(Index);
+        }
+        return Sum;
+    };
+
+    // Lookups of strided integer keys, where the unmixed hash degrades to long chains
+    static constexpr int64 NumKeys = 1 << 14;
+    TMap<int64, int64> Mixed;
+    TMap<int64, int64, FIdentityHasher> Identity;
+    for (int64 Index = 0; Index < NumKeys; ++Index)
+    {
+        Mixed[Index * 4096] = Index;
+        Identity[Index * 4096] = Index;
+    }
+
+    BENCHMARK("FindStrided_THash")
+    {
+        int64 Sum = 0;
+        for (int64 Index = 0; Index < NumKeys; Index += 16)
+        {
+            Sum += Mixed.Find(Index * 4096)->second;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("FindStrided_Identity")
+    {
+        int64 Sum = 0;
+        for (int64 Index = 0; Index < NumKeys; Index += 16)
+        {
+            Sum += Identity.Find(Index * 4096)->second;
+        }
+        return Sum;
+    };
+}
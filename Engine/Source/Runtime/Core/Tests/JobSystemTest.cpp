@@ -0,0 +1,108 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Ranges.hpp"
+#include "Core/Threading/JobSystem.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST_CASE("FJobSystem::ParallelForRunsEveryTaskOnce", "[JobSystem]")
+{
+    TArray<uint32> Counters(1000);
+
+    FJobSystem::ParallelFor(Counters.Num(), [&Counters](const size64 TaskIndex)
+    {
+        std::atomic_ref(Counters[TaskIndex]).fetch_add(1, std::memory_order_relaxed);
+    });
+
+    REQUIRE(Ranges::Count(Counters, 1u) == Counters.Num());
+}
+
+TEST_CASE("FJobSystem::NestedParallelFor", "[JobSystem]")
+{
+    std::atomic<size64> Total = 0;
+
+    FJobSystem::ParallelFor(16, [&Total](const size64 OuterIndex)
+    {
+        FJobSystem::ParallelFor(64, [&Total, OuterIndex](const size64 InnerIndex)
+        {
+            Total.fetch_add(OuterIndex * 64 + InnerIndex, std::memory_order_relaxed);
+        });
+    });
+
+    const size64 NumTasks = 16 * 64;
+    REQUIRE(Total.load() == NumTasks * (NumTasks - 1) / 2);
+}
+
+TEST_CASE("FJobSystem::ThreadIndices", "[JobSystem]")
+{
+    REQUIRE(FJobSystem::GetCurrentThreadIndex() == 0);
+    REQUIRE(FJobSystem::GetNumThreads() == FJobSystem::GetNumWorkers() + 1);
+
+    std::atomic<bool8> bIndexInRange = true;
+    FJobSystem::ParallelFor(256, [&bIndexInRange](size64)
+    {
+        if (FJobSystem::GetCurrentThreadIndex() >= FJobSystem::GetNumThreads())
+        {
+            bIndexInRange = false;
+        }
+    });
+    REQUIRE(bIndexInRange.load());
+}
+
+TEST_CASE("FJobSystem::EmptyAndSingleTask", "[JobSystem]")
+{
+    size64 Calls = 0;
+    FJobSystem::ParallelFor(0, [&Calls](size64) { ++Calls; });
+    REQUIRE(Calls == 0);
+
+    FJobSystem::ParallelFor(1, [&Calls](size64) { ++Calls; });
+    REQUIRE(Calls == 1);
+}
+
+TEST_CASE("FJobSystem::WaitsForLongTasks", "[JobSystem]")
+{
+    // Whichever thread ends up with the slow task, the dispatching thread runs out of work long before it finishes
+    // and has to block until the last task completes, then until every helper let go of the batch
+    for (uint32 Round = 0; Round < 20; ++Round)
+    {
+        std::atomic<size64> NumCompleted = 0;
+        FJobSystem::ParallelFor(8, [&NumCompleted, Round](const size64 TaskIndex)
+        {
+            if (TaskIndex == Round % 8)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            NumCompleted.fetch_add(1, std::memory_order_relaxed);
+        });
+        REQUIRE(NumCompleted.load() == 8);
+    }
+
+    // Many short batches, so completions and helper releases keep racing with the dispatcher going to sleep
+    std::atomic<size64> Total = 0;
+    for (uint32 Round = 0; Round < 2000; ++Round)
+    {
+        FJobSystem::ParallelFor(4, [&Total](const size64 TaskIndex)
+        {
+            Total.fetch_add(TaskIndex, std::memory_order_relaxed);
+        });
+    }
+    REQUIRE(Total.load() == 2000 * 6);
+}
+
+TEST_CASE("FJobSystem::BenchmarkDispatch", "[JobSystem][.benchmark]")
+{
+    BENCHMARK("EmptyTasks_64")
+    {
+        FJobSystem::ParallelFor(64, [](size64) {});
+    };
+
+    BENCHMARK("EmptyTasks_4096")
+    {
+        FJobSystem::ParallelFor(4096, [](size64) {});
+    };
+}
@@ -2,6 +2,8 @@
 
 #include <catch2/catch_session.hpp>
 
+#include "Core/Threading/JobSystem.hpp"
+
 int main(const int ArgumentCount, char* Arguments[])
 {
     Catch::Session Session = Catch::Session();
@@ -10,6 +12,8 @@ int main(const int ArgumentCount, char* Arguments[])
     {
         return Result;
     }
+    FJobSystem::Initialize();
     Result = Session.run(ArgumentCount, Arguments);
+    FJobSystem::Shutdown();
     return Result;
 }
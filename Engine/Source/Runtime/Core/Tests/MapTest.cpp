@@ -1,17 +1,140 @@
 // RavenStorm Copyright @ 2025-2025
 
 #include <string>
+#include <unordered_map>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
 #include "Core/Containers/Map.hpp"
 
+// Counts how values get into the map
+struct FMapTestCounted
+{
+    static inline int32 NumConstructions = 0;
+    static inline int32 NumCopiesAndMoves = 0;
+
+    FMapTestCounted()
+    {
+        ++NumConstructions;
+    }
+
+    FMapTestCounted(const int32 InA, std::string InB)
+        : A(InA), B(std::move(InB))
+    {
+        ++NumConstructions;
+    }
+
+    FMapTestCounted(const FMapTestCounted& Other)
+        : A(Other.A), B(Other.B)
+    {
+        ++NumCopiesAndMoves;
+    }
+
+    FMapTestCounted(FMapTestCounted&& Other) noexcept
+        : A(Other.A), B(std::move(Other.B))
+    {
+        ++NumCopiesAndMoves;
+    }
+
+    static void ResetCounters()
+    {
+        NumConstructions = 0;
+        NumCopiesAndMoves = 0;
+    }
+
+    int32 A = 0;
+    std::string B;
+};
+
+// Value type that owns heap memory, as found in components
+struct FMapTestPayload
+{
+    std::string Name;
+    TArray<int32> Items;
+};
+
 TEST_CASE("TMap::DefaultConstruction", "[Map]")
 {
     const TMap<int32, int32> Map;
 
     REQUIRE(Map.Num() == 0);
     REQUIRE(Map.IsEmpty());
-    REQUIRE(Map.GetBucketCount() >= 16);
+    REQUIRE(Map.GetBucketCount() == 0);
+    REQUIRE(Map.begin() == Map.end());
+    REQUIRE_FALSE(Map.Contains(1));
+    REQUIRE(Map.Find(1) == Map.end());
+}
+
+TEST_CASE("TMap::LazyAllocation", "[Map]")
+{
+    TMap<int32, int32> Map;
+    REQUIRE(Map.Remove(1) == 0);
+    Map.Clear();
+    REQUIRE(Map.GetBucketCount() == 0);
+
+    // Copies of empty maps stay unallocated, whatever the source once held
+    TMap<int32, int32> Emptied{{1, 10}};
+    Emptied.Remove(1);
+    const TMap<int32, int32> Copy(Emptied);
+    REQUIRE(Copy.GetBucketCount() == 0);
+    const TMap<int32, int32> EmptyList{};
+    REQUIRE(EmptyList.GetBucketCount() == 0);
+
+    TMap<int32, int32> Assigned;
+    Assigned = Emptied;
+    REQUIRE(Assigned.GetBucketCount() == 0);
+
+    Map[1] = 10;
+    REQUIRE(Map.GetBucketCount() > 0);
+    REQUIRE(Map[1] == 10);
+}
+
+TEST_CASE("TMap::BeginAfterRemoval", "[Map]")
+{
+    TMap<int32, int32> Map;
+    Map.Reserve(1024);
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        Map[Index] = Index;
+    }
+
+    // Removing in iteration order keeps emptying the first occupied bucket
+    while (!Map.IsEmpty())
+    {
+        const int32 FirstKey = Map.begin()->first;
+        int32 Visited = 0;
+        for (const auto& Pair : Map)
+        {
+            REQUIRE(Map.Contains(Pair.first));
+            ++Visited;
+        }
+        REQUIRE(Visited == static_cast<int32>(Map.Num()));
+        Map.Remove(FirstKey);
+        REQUIRE_FALSE(Map.Contains(FirstKey));
+    }
+    REQUIRE(Map.begin() == Map.end());
+
+    // Removing through iterators, then inserting into buckets before the cached one
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        Map[Index] = Index;
+    }
+    for (auto Iterator = Map.begin(); Iterator != Map.end();)
+    {
+        Iterator = Iterator->first % 2 == 0 ? Map.Remove(Iterator) : std::next(Iterator);
+    }
+    REQUIRE(Map.Num() == 32);
+    for (int32 Index = 0; Index < 64; Index += 2)
+    {
+        Map[Index] = Index;
+    }
+    int32 Sum = 0;
+    for (const auto& [Key, Value] : Map)
+    {
+        Sum += Value;
+    }
+    REQUIRE(Sum == 63 * 64 / 2);
+    REQUIRE(Map.GetBucketCount() == 2048);
 }
 
 TEST_CASE("TMap::ConstructionWithBucketCount", "[Map]")
@@ -169,6 +292,64 @@ TEST_CASE("TMap::Emplace", "[Map]")
     REQUIRE(Iterator->second == 10);
 }
 
+TEST_CASE("TMap::TryEmplace", "[Map]")
+{
+    TMap<int32, FMapTestCounted> Map;
+    FMapTestCounted::ResetCounters();
+
+    // Values are constructed in place, never copied or moved
+    auto [Iterator, bInserted] = Map.TryEmplace(1, 10, "Ten");
+    REQUIRE(bInserted);
+    REQUIRE(Iterator->second.B == "Ten");
+    REQUIRE(Map[2].A == 0);
+    REQUIRE(FMapTestCounted::NumConstructions == 2);
+    REQUIRE(FMapTestCounted::NumCopiesAndMoves == 0);
+
+    // A present key leaves the arguments alone
+    std::string Name = "Eleven";
+    auto [Existing, bInsertedAgain] = Map.TryEmplace(1, 11, std::move(Name));
+    REQUIRE_FALSE(bInsertedAgain);
+    REQUIRE(Existing->second.A == 10);
+    REQUIRE(FMapTestCounted::NumConstructions == 2);
+
+    TMap<std::string, std::string> Strings;
+    std::string Key = "Key";
+    Strings.TryEmplace(std::move(Key), 3, 'x');
+    REQUIRE(Strings["Key"] == "xxx");
+}
+
+TEST_CASE("TMap::NodeReuse", "[Map]")
+{
+    TMap<int32, std::string> Map;
+    Map.Reserve(64);
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        Map[Index] = std::to_string(Index);
+    }
+    const std::string* Address = &Map[63];
+
+    // Removed nodes are handed out again, addresses of the other elements are stable
+    for (int32 Round = 0; Round < 10; ++Round)
+    {
+        for (int32 Index = 0; Index < 32; ++Index)
+        {
+            Map.Remove(Index);
+        }
+        for (int32 Index = 0; Index < 32; ++Index)
+        {
+            Map.Emplace(Index, std::to_string(Index + Round));
+        }
+    }
+    REQUIRE(Map.Num() == 64);
+    REQUIRE(&Map[63] == Address);
+    REQUIRE(Map[5] == "14");
+
+    // Emplacing a present key gives its node back
+    auto [Iterator, bInserted] = Map.Emplace(5, "Duplicate");
+    REQUIRE_FALSE(bInserted);
+    REQUIRE(Iterator->second == "14");
+}
+
 TEST_CASE("TMap::OperatorBrackets", "[Map]")
 {
     TMap<int32, int32> Map;
@@ -523,6 +704,14 @@ TEST_CASE("TMap::BenchmarkConstruction", "[Map][.benchmark]")
         return Map.Num();
     };
 
+    // Components that embed a map and never fill it
+    BENCHMARK("EmptyConstruction_1024")
+    {
+        TArray<TMap<int32, int32>> Maps;
+        Maps.Resize(1024);
+        return Maps.Num();
+    };
+
     BENCHMARK("ReserveConstruction")
     {
         TMap<int32, int32> Map;
@@ -596,6 +785,96 @@ TEST_CASE("TMap::BenchmarkInsertion", "[Map][.benchmark]")
     };
 }
 
+TEST_CASE("TMap::BenchmarkInsertionNonTrivial", "[Map][.benchmark]")
+{
+    static constexpr int32 NumElements = 10000;
+    TArray<std::string> Names;
+    for (int32 Index = 0; Index < NumElements; ++Index)
+    {
+        Names.PushBack("Entity_" + std::to_string(Index) + "_WithALongEnoughName");
+    }
+
+    BENCHMARK("OperatorBrackets")
+    {
+        TMap<int32, FMapTestPayload> Map;
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            Map[Index].Name = Names[Index];
+        }
+        return Map.Num();
+    };
+
+    BENCHMARK("Emplace")
+    {
+        TMap<int32, FMapTestPayload> Map;
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            Map.Emplace(Index, FMapTestPayload{.Name = Names[Index], .Items = {}});
+        }
+        return Map.Num();
+    };
+
+    BENCHMARK("TryEmplace")
+    {
+        TMap<int32, FMapTestPayload> Map;
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            Map.TryEmplace(Index, Names[Index], TArray<int32>());
+        }
+        return Map.Num();
+    };
+
+    BENCHMARK("TryEmplace_WithReserve")
+    {
+        TMap<int32, FMapTestPayload> Map;
+        Map.Reserve(NumElements);
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            Map.TryEmplace(Index, Names[Index], TArray<int32>());
+        }
+        return Map.Num();
+    };
+
+    BENCHMARK("StringKeys_OperatorBrackets")
+    {
+        TMap<std::string, std::string> Map;
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            Map[Names[Index]] = Names[Index];
+        }
+        return Map.Num();
+    };
+
+    BENCHMARK("StdUnorderedMap_OperatorBrackets")
+    {
+        std::unordered_map<int32, FMapTestPayload> Map;
+        for (int32 Index = 0; Index < NumElements; ++Index)
+        {
+            Map[Index].Name = Names[Index];
+        }
+        return Map.size();
+    };
+
+    // Steady state churn, removed nodes are recycled by the following inserts
+    TMap<int32, FMapTestPayload> Churned;
+    for (int32 Index = 0; Index < NumElements; ++Index)
+    {
+        Churned[Index].Name = Names[Index];
+    }
+    BENCHMARK("RemoveAndInsert")
+    {
+        for (int32 Index = 0; Index < NumElements; Index += 2)
+        {
+            Churned.Remove(Index);
+        }
+        for (int32 Index = 0; Index < NumElements; Index += 2)
+        {
+            Churned[Index].Name = Names[Index];
+        }
+        return Churned.Num();
+    };
+}
+
 TEST_CASE("TMap::BenchmarkLookup", "[Map][.benchmark]")
 {
     TMap<int32, int32> Map;
@@ -678,6 +957,22 @@ TEST_CASE("TMap::BenchmarkIteration", "[Map][.benchmark]")
         }
         return Sum;
     };
+
+    // A map that grew large and was drained down to a few elements
+    TMap<int32, int32> Drained;
+    for (int32 Index = 0; Index < 100000; ++Index)
+    {
+        Drained[Index] = Index;
+    }
+    for (int32 Index = 0; Index < 99990; ++Index)
+    {
+        Drained.Remove(Index);
+    }
+
+    BENCHMARK("BeginDrained")
+    {
+        return Drained.begin()->second;
+    };
 }
 
 TEST_CASE("TMap::BenchmarkRemoval", "[Map][.benchmark]")
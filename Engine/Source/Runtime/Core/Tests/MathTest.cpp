@@ -0,0 +1,254 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Math/VectorBatch.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <random>
+
+// The scalar bodies are usable in constant expressions
+static_assert(FVector3::Cross(FVector3(1.0f, 0.0f, 0.0f), FVector3(0.0f, 1.0f, 0.0f)) == FVector3(0.0f, 0.0f, 1.0f));
+static_assert(FVector4::Dot(FVector4(1.0f, 2.0f, 3.0f, 4.0f), FVector4(1.0f)) == 10.0f);
+static_assert((FQuat::Identity() * FQuat(0.0f, 1.0f, 0.0f, 0.0f)) == FQuat(0.0f, 1.0f, 0.0f, 0.0f));
+static_assert(FMatrix44::Multiply(FMatrix44::MakeTranslation({1.0f, 2.0f, 3.0f}), FMatrix44::MakeScale(FVector3(2.0f))).GetTranslation() ==
+    FVector3(1.0f, 2.0f, 3.0f));
+static_assert(FVector3x8::Splat({1.0f, 2.0f, 3.0f}).TransformPoints(FMatrix44::MakeTranslation({1.0f, 1.0f, 1.0f})).Get(7) == FVector3(2.0f, 3.0f, 4.0f));
+
+namespace
+{
+    bool8 IsNearlyEqual(const float32 A, const float32 B)
+    {
+        return std::abs(A - B) <= 1e-4f * (1.0f + std::abs(B));
+    }
+
+    bool8 IsNearlyEqual(const FVector3& A, const FVector3& B)
+    {
+        return IsNearlyEqual(A.X, B.X) && IsNearlyEqual(A.Y, B.Y) && IsNearlyEqual(A.Z, B.Z);
+    }
+
+    bool8 IsNearlyEqual(const FQuat& A, const FQuat& B)
+    {
+        return IsNearlyEqual(A.X, B.X) && IsNearlyEqual(A.Y, B.Y) && IsNearlyEqual(A.Z, B.Z) && IsNearlyEqual(A.W, B.W);
+    }
+
+    FQuat MakeRandomRotation(std::mt19937& Random)
+    {
+        std::uniform_real_distribution<float32> Distribution(-1.0f, 1.0f);
+        const FVector3 Axis = FVector3(Distribution(Random), Distribution(Random), Distribution(Random) + 2.0f).GetNormalized();
+        return FQuat::MakeFromAxisAngle(Axis, Distribution(Random) * std::numbers::pi_v<float32>);
+    }
+}
+
+TEST_CASE("Math::Vector", "[Core][Math]")
+{
+    const FVector3 A(1.0f, 2.0f, 3.0f);
+    const FVector3 B(-2.0f, 0.5f, 4.0f);
+    REQUIRE(A + B == FVector3(-1.0f, 2.5f, 7.0f));
+    REQUIRE(A - B == FVector3(3.0f, 1.5f, -1.0f));
+    REQUIRE(2.0f * A == FVector3(2.0f, 4.0f, 6.0f));
+    REQUIRE(FVector3::Dot(A, B) == 11.0f);
+    REQUIRE(FVector3::Dot(FVector3::Cross(A, B), A) == 0.0f);
+    REQUIRE(IsNearlyEqual(FVector3(3.0f, 0.0f, 4.0f).GetNormalized(), FVector3(0.6f, 0.0f, 0.8f)));
+    REQUIRE(FVector3::Zero().GetNormalized() == FVector3::Zero());
+
+    const FVector4 C(1.0f, 2.0f, 3.0f, 4.0f);
+    const FVector4 D(0.5f, -1.0f, 2.0f, 0.25f);
+    REQUIRE(C + D == FVector4(1.5f, 1.0f, 5.0f, 4.25f));
+    REQUIRE(C - D == FVector4(0.5f, 3.0f, 1.0f, 3.75f));
+    REQUIRE(C * D == FVector4(0.5f, -2.0f, 6.0f, 1.0f));
+    REQUIRE(C * 2.0f == FVector4(2.0f, 4.0f, 6.0f, 8.0f));
+    REQUIRE(FVector4::Dot(C, D) == 5.5f);
+    REQUIRE(C.Length() == std::sqrt(30.0f));
+}
+
+TEST_CASE("Math::Quat", "[Core][Math]")
+{
+    const FQuat QuarterTurn = FQuat::MakeFromAxisAngle({0.0f, 0.0f, 1.0f}, std::numbers::pi_v<float32> * 0.5f);
+    REQUIRE(IsNearlyEqual(QuarterTurn.RotateVector({1.0f, 0.0f, 0.0f}), FVector3(0.0f, 1.0f, 0.0f)));
+    REQUIRE(IsNearlyEqual((QuarterTurn * QuarterTurn).RotateVector({1.0f, 0.0f, 0.0f}), FVector3(-1.0f, 0.0f, 0.0f)));
+    REQUIRE(IsNearlyEqual(QuarterTurn * QuarterTurn.GetConjugate(), FQuat::Identity()));
+
+    // The SSE product matches the scalar one and composes like the rotation matrices
+    std::mt19937 Random(3);
+    for (int32 Iteration = 0; Iteration < 100; ++Iteration)
+    {
+        const FQuat A = MakeRandomRotation(Random);
+        const FQuat B = MakeRandomRotation(Random);
+        const FQuat Product = A * B;
+        const FQuat Expected(A.W * B.X + A.X * B.W + A.Y * B.Z - A.Z * B.Y, A.W * B.Y - A.X * B.Z + A.Y * B.W + A.Z * B.X,
+            A.W * B.Z + A.X * B.Y - A.Y * B.X + A.Z * B.W, A.W * B.W - A.X * B.X - A.Y * B.Y - A.Z * B.Z);
+        REQUIRE(IsNearlyEqual(Product, Expected));
+
+        const FVector3 Point(1.0f, -2.0f, 0.5f);
+        REQUIRE(IsNearlyEqual(Product.RotateVector(Point), A.RotateVector(B.RotateVector(Point))));
+        REQUIRE(IsNearlyEqual(FMatrix44::MakeRotation(Product).TransformPoint(Point),
+            (FMatrix44::MakeRotation(A) * FMatrix44::MakeRotation(B)).TransformPoint(Point)));
+    }
+}
+
+TEST_CASE("Math::Slerp", "[Core][Math]")
+{
+    const FVector3 Axis(0.0f, 1.0f, 0.0f);
+    const FQuat Start = FQuat::Identity();
+    const FQuat End = FQuat::MakeFromAxisAngle(Axis, 2.0f);
+    REQUIRE(IsNearlyEqual(FQuat::Slerp(Start, End, 0.0f), Start));
+    REQUIRE(IsNearlyEqual(FQuat::Slerp(Start, End, 1.0f), End));
+    REQUIRE(IsNearlyEqual(FQuat::Slerp(Start, End, 0.25f), FQuat::MakeFromAxisAngle(Axis, 0.5f)));
+
+    // Takes the shorter arc when the inputs lie in opposite hemispheres
+    const FQuat Negated = FQuat::FromVector(-End.ToVector());
+    REQUIRE(IsNearlyEqual(FQuat::Slerp(Start, Negated, 0.5f).RotateVector({1.0f, 0.0f, 0.0f}),
+        FQuat::MakeFromAxisAngle(Axis, 1.0f).RotateVector({1.0f, 0.0f, 0.0f})));
+
+    // Nearly identical inputs stay normalized
+    const FQuat Close = FQuat::MakeFromAxisAngle(Axis, 1e-3f);
+    REQUIRE(IsNearlyEqual(FQuat::Dot(FQuat::Slerp(Start, Close, 0.5f), FQuat::Slerp(Start, Close, 0.5f)), 1.0f));
+}
+
+TEST_CASE("Math::Matrix", "[Core][Math]")
+{
+    const FMatrix44 Transform = FMatrix44::MakeTransform({1.0f, 2.0f, 3.0f},
+        FQuat::MakeFromAxisAngle({1.0f, 0.0f, 0.0f}, std::numbers::pi_v<float32> * 0.5f), FVector3(2.0f));
+    const FMatrix44 Composed = FMatrix44::MakeTranslation({1.0f, 2.0f, 3.0f}) *
+        FMatrix44::MakeRotation(FQuat::MakeFromAxisAngle({1.0f, 0.0f, 0.0f}, std::numbers::pi_v<float32> * 0.5f)) * FMatrix44::MakeScale(FVector3(2.0f));
+    REQUIRE(IsNearlyEqual(Transform.TransformPoint({0.0f, 1.0f, 0.0f}), FVector3(1.0f, 2.0f, 5.0f)));
+    REQUIRE(IsNearlyEqual(Composed.TransformPoint({0.0f, 1.0f, 0.0f}), FVector3(1.0f, 2.0f, 5.0f)));
+    REQUIRE(IsNearlyEqual(Transform.TransformVector({0.0f, 1.0f, 0.0f}), FVector3(0.0f, 0.0f, 2.0f)));
+    REQUIRE(Transform.Transform(FVector4(0.0f, 0.0f, 0.0f, 1.0f)) == FVector4(1.0f, 2.0f, 3.0f, 1.0f));
+    REQUIRE(Transform.GetTransposed().GetTransposed() == Transform);
+
+    // The SSE product matches the scalar one, including the projective row
+    std::mt19937 Random(5);
+    std::uniform_real_distribution<float32> Distribution(-2.0f, 2.0f);
+    FMatrix44 A;
+    FMatrix44 B;
+    for (uint32 Row = 0; Row < 4; ++Row)
+    {
+        for (uint32 Column = 0; Column < 4; ++Column)
+        {
+            A.M[Row][Column] = Distribution(Random);
+            B.M[Row][Column] = Distribution(Random);
+        }
+    }
+    const FMatrix44 Product = A * B;
+    for (uint32 Row = 0; Row < 4; ++Row)
+    {
+        for (uint32 Column = 0; Column < 4; ++Column)
+        {
+            const float32 Expected = A.M[Row][0] * B.M[0][Column] + A.M[Row][1] * B.M[1][Column] + A.M[Row][2] * B.M[2][Column] +
+                A.M[Row][3] * B.M[3][Column];
+            REQUIRE(IsNearlyEqual(Product.M[Row][Column], Expected));
+        }
+    }
+}
+
+TEST_CASE("Math::TransformPoints", "[Core][Math]")
+{
+    std::mt19937 Random(9);
+    std::uniform_real_distribution<float32> Distribution(-100.0f, 100.0f);
+    const FMatrix44 Matrix = FMatrix44::MakeTransform({1.0f, -2.0f, 3.0f}, MakeRandomRotation(Random), {0.5f, 2.0f, 1.5f});
+
+    TArray<FVector3x8> Points;
+    Points.ResizeUninitialized(37);
+    for (FVector3x8& Batch : Points)
+    {
+        for (uint32 Lane = 0; Lane < FVector3x8::NumLanes; ++Lane)
+        {
+            Batch.Set(Lane, {Distribution(Random), Distribution(Random), Distribution(Random)});
+        }
+    }
+
+    TArray<FVector3x8> Transformed;
+    Transformed.ResizeUninitialized(Points.Num());
+    Math::TransformPoints(Matrix, Points.GetData(), Transformed.GetData(), Points.Num());
+    size64 NumMismatches = 0;
+    for (size64 Index = 0; Index < Points.Num(); ++Index)
+    {
+        for (uint32 Lane = 0; Lane < FVector3x8::NumLanes; ++Lane)
+        {
+            NumMismatches += IsNearlyEqual(Transformed[Index].Get(Lane), Matrix.TransformPoint(Points[Index].Get(Lane))) ? 0 : 1;
+            NumMismatches += IsNearlyEqual(Points[Index].TransformPoints(Matrix).Get(Lane), Transformed[Index].Get(Lane)) ? 0 : 1;
+        }
+    }
+    REQUIRE(NumMismatches == 0);
+
+    // In place
+    Math::TransformPoints(Matrix, Points.GetData(), Points.GetData(), Points.Num());
+    REQUIRE(IsNearlyEqual(Points[36].Get(5), Transformed[36].Get(5)));
+}
+
+TEST_CASE("Math::Benchmark", "[Core][Math][.benchmark]")
+{
+    std::mt19937 Random(13);
+    static constexpr size64 NumPoints = 1000000;
+    const FMatrix44 Matrix = FMatrix44::MakeTransform({1.0f, -2.0f, 3.0f}, MakeRandomRotation(Random), {0.5f, 2.0f, 1.5f});
+
+    TArray<FMatrix44> Matrices;
+    TArray<FQuat> Rotations;
+    for (int32 Index = 0; Index < 1024; ++Index)
+    {
+        Matrices.PushBack(FMatrix44::MakeTransform({1.0f, 2.0f, 3.0f}, MakeRandomRotation(Random), FVector3(1.1f)));
+        Rotations.PushBack(MakeRandomRotation(Random));
+    }
+
+    BENCHMARK("Matrix44Multiply_1024")
+    {
+        FMatrix44 Result = FMatrix44::Identity();
+        for (const FMatrix44& Other : Matrices)
+        {
+            Result = Result * Other;
+        }
+        return Result.M[0][0];
+    };
+
+    BENCHMARK("QuatSlerp_1024")
+    {
+        float32 Sum = 0.0f;
+        for (size64 Index = 1; Index < Rotations.Num(); ++Index)
+        {
+            Sum += FQuat::Slerp(Rotations[Index - 1], Rotations[Index], 0.3f).W;
+        }
+        return Sum;
+    };
+
+    TArray<FVector3> PointsAoS;
+    PointsAoS.ResizeUninitialized(NumPoints);
+    TArray<FVector3x8> PointsSoA;
+    PointsSoA.ResizeUninitialized(NumPoints / FVector3x8::NumLanes);
+    for (size64 Index = 0; Index < NumPoints; ++Index)
+    {
+        PointsAoS[Index] = FVector3(static_cast<float32>(Index), 1.0f, -static_cast<float32>(Index));
+        PointsSoA[Index / FVector3x8::NumLanes].Set(Index % FVector3x8::NumLanes, PointsAoS[Index]);
+    }
+    TArray<FVector3> TransformedAoS;
+    TransformedAoS.ResizeUninitialized(NumPoints);
+    TArray<FVector3x8> TransformedSoA;
+    TransformedSoA.ResizeUninitialized(PointsSoA.Num());
+
+    BENCHMARK("TransformPoints_1M_AoS")
+    {
+        for (size64 Index = 0; Index < NumPoints; ++Index)
+        {
+            TransformedAoS[Index] = Matrix.TransformPoint(PointsAoS[Index]);
+        }
+        return TransformedAoS[NumPoints - 1].X;
+    };
+
+    BENCHMARK("TransformPoints_1M_SoAInline")
+    {
+        for (size64 Index = 0; Index < PointsSoA.Num(); ++Index)
+        {
+            TransformedSoA[Index] = PointsSoA[Index].TransformPoints(Matrix);
+        }
+        return TransformedSoA[0].X[0];
+    };
+
+    BENCHMARK("TransformPoints_1M_SoADispatched")
+    {
+        Math::TransformPoints(Matrix, PointsSoA.GetData(), TransformedSoA.GetData(), PointsSoA.Num());
+        return TransformedSoA[0].X[0];
+    };
+}
@@ -0,0 +1,175 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "Core/Containers/MultiMap.hpp"
+
+namespace
+{
+    template <typename TMultiMapType, typename TKey>
+    TArray<int32> GetSortedValues(const TMultiMapType& Map, const TKey& Key)
+    {
+        TArray<int32> Values;
+        for (const auto& [PairKey, Value] : Map.FindAll(Key))
+        {
+            REQUIRE(PairKey == Key);
+            Values.PushBack(Value);
+        }
+        std::sort(Values.begin(), Values.end());
+        return Values;
+    }
+}
+
+TEST_CASE("TMultiMap::InsertAndFind", "[MultiMap]")
+{
+    TMultiMap<std::string, int32> Map{{"a", 1}, {"b", 2}, {"a", 3}};
+    Map.Emplace("a", 5);
+    Map.Insert({"c", 4});
+
+    REQUIRE(Map.Num() == 5);
+    REQUIRE(Map.Count("a") == 3);
+    REQUIRE(Map.Count("b") == 1);
+    REQUIRE(Map.Count("z") == 0);
+    REQUIRE(Map.Contains("c"));
+    REQUIRE(Map.Find("b")->second == 2);
+    REQUIRE(GetSortedValues(Map, std::string("a")) == TArray<int32>{1, 3, 5});
+    REQUIRE(Map.FindAll("z").begin() == Map.FindAll("z").end());
+
+    // Values are mutable through the range
+    for (auto& [Key, Value] : Map.FindAll("a"))
+    {
+        Value *= 10;
+    }
+    REQUIRE(GetSortedValues(Map, std::string("a")) == TArray<int32>{10, 30, 50});
+}
+
+TEST_CASE("TMultiMap::Remove", "[MultiMap]")
+{
+    TMultiMap<int32, int32> Map;
+    for (int32 Index = 0; Index < 30; ++Index)
+    {
+        Map.Emplace(Index % 3, Index);
+    }
+
+    REQUIRE(Map.Remove(1, 4) == 1);
+    REQUIRE(Map.Remove(1, 4) == 0);
+    REQUIRE(Map.Count(1) == 9);
+
+    REQUIRE(Map.Remove(2) == 10);
+    REQUIRE_FALSE(Map.Contains(2));
+    REQUIRE(Map.Num() == 19);
+
+    for (auto Iterator = Map.begin(); Iterator != Map.end();)
+    {
+        Iterator = Iterator->second % 2 == 0 ? Map.Remove(Iterator) : std::next(Iterator);
+    }
+    REQUIRE(GetSortedValues(Map, 0) == TArray<int32>{3, 9, 15, 21, 27});
+    REQUIRE(GetSortedValues(Map, 1) == TArray<int32>{1, 7, 13, 19, 25});
+
+    TMultiMap<int32, int32> Copy(Map);
+    Map.Clear();
+    REQUIRE(Map.IsEmpty());
+    REQUIRE(Copy.Num() == 10);
+    REQUIRE(GetSortedValues(Copy, 1) == TArray<int32>{1, 7, 13, 19, 25});
+}
+
+TEST_CASE("TMultiMap::ValuesStayAdjacent", "[MultiMap]")
+{
+    // Interleaved inserts across many rehashes, every key's values must form one run in iteration order
+    TMultiMap<int32, int32> Map;
+    std::unordered_map<int32, int32> Counts;
+    std::mt19937 Random(3);
+    for (int32 Index = 0; Index < 20000; ++Index)
+    {
+        const int32 Key = static_cast<int32>(Random() % 700);
+        Map.Emplace(Key, Index);
+        ++Counts[Key];
+    }
+
+    std::unordered_map<int32, int32> Runs;
+    int32 PreviousKey = -1;
+    for (const auto& [Key, Value] : Map)
+    {
+        if (Key != PreviousKey)
+        {
+            ++Runs[Key];
+            PreviousKey = Key;
+        }
+    }
+    REQUIRE(Runs.size() == Counts.size());
+    for (const auto& [Key, NumRuns] : Runs)
+    {
+        REQUIRE(NumRuns == 1);
+        REQUIRE(Map.Count(Key) == static_cast<size64>(Counts[Key]));
+    }
+}
+
+TEST_CASE("TMultiMap::Benchmark", "[MultiMap][.benchmark]")
+{
+    static constexpr int32 NumKeys = 10000;
+
+    // Few values per key is the common case, where a per key array costs the most
+    for (const int32 ValuesPerKey : {2, 8})
+    {
+        const std::string Suffix = "_" + std::to_string(ValuesPerKey) + "PerKey";
+        BENCHMARK("Build_TMultiMap" + Suffix)
+        {
+            TMultiMap<int32, int32> Map;
+            for (int32 Index = 0; Index < NumKeys * ValuesPerKey; ++Index)
+            {
+                Map.Emplace(Index % NumKeys, Index);
+            }
+            return Map.Num();
+        };
+
+        BENCHMARK("Build_TMapOfTArray" + Suffix)
+        {
+            TMap<int32, TArray<int32>> Map;
+            for (int32 Index = 0; Index < NumKeys * ValuesPerKey; ++Index)
+            {
+                Map[Index % NumKeys].PushBack(Index);
+            }
+            return Map.Num();
+        };
+
+        TMultiMap<int32, int32> MultiMap;
+        TMap<int32, TArray<int32>> ArrayMap;
+        for (int32 Index = 0; Index < NumKeys * ValuesPerKey; ++Index)
+        {
+            MultiMap.Emplace(Index % NumKeys, Index);
+            ArrayMap[Index % NumKeys].PushBack(Index);
+        }
+
+        BENCHMARK("FindAll_TMultiMap" + Suffix)
+        {
+            int64 Sum = 0;
+            for (int32 Key = 0; Key < NumKeys; ++Key)
+            {
+                for (const auto& [PairKey, Value] : MultiMap.FindAll(Key))
+                {
+                    Sum += Value;
+                }
+            }
+            return Sum;
+        };
+
+        BENCHMARK("FindAll_TMapOfTArray" + Suffix)
+        {
+            int64 Sum = 0;
+            for (int32 Key = 0; Key < NumKeys; ++Key)
+            {
+                for (const int32 Value : ArrayMap.Find(Key)->second)
+                {
+                    Sum += Value;
+                }
+            }
+            return Sum;
+        };
+    }
+}
@@ -0,0 +1,304 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "Core/Containers/OrderedMap.hpp"
+
+namespace
+{
+    // What a TMap holds on the heap: the bucket array plus one pooled node per element
+    template <typename TKey, typename TValue>
+    size64 GetMapFootprint(const TMap<TKey, TValue>& Map)
+    {
+        return Map.GetBucketCount() * sizeof(void*) + Map.Num() * (sizeof(std::pair<const TKey, TValue>) + sizeof(void*));
+    }
+
+    template <typename TKey, typename TValue>
+    TArray<TKey> GetKeys(const TOrderedMap<TKey, TValue>& Map)
+    {
+        TArray<TKey> Keys;
+        for (const auto& [Key, Value] : Map)
+        {
+            Keys.PushBack(Key);
+        }
+        return Keys;
+    }
+}
+
+TEST_CASE("TOrderedMap::DefaultConstruction", "[OrderedMap]")
+{
+    const TOrderedMap<int32, int32> Map;
+
+    REQUIRE(Map.IsEmpty());
+    REQUIRE(Map.GetSlotCount() == 0);
+    REQUIRE(Map.GetAllocatedSize() == 0);
+    REQUIRE(Map.begin() == Map.end());
+    REQUIRE_FALSE(Map.Contains(1));
+
+    const TOrderedMap<int32, int32> EmptyList{};
+    REQUIRE(EmptyList.GetAllocatedSize() == 0);
+}
+
+TEST_CASE("TOrderedMap::InsertionOrder", "[OrderedMap]")
+{
+    TOrderedMap<std::string, int32> Map{{"zulu", 1}, {"alpha", 2}, {"mike", 3}};
+    Map["bravo"] = 4;
+    Map.Insert({"alpha", 99});
+    Map.TryEmplace("yankee", 5);
+
+    REQUIRE(Map.Num() == 5);
+    REQUIRE(Map["alpha"] == 2);
+    REQUIRE(GetKeys(Map) == TArray<std::string>{"zulu", "alpha", "mike", "bravo", "yankee"});
+    REQUIRE(Map.At(3).first == "bravo");
+
+    const auto [Existing, bInserted] = Map.TryEmplace("mike", 42);
+    REQUIRE_FALSE(bInserted);
+    REQUIRE(Existing->second == 3);
+    REQUIRE(Map.Find("papa") == Map.end());
+    REQUIRE(Map.Find("yankee")->second == 5);
+}
+
+TEST_CASE("TOrderedMap::Remove", "[OrderedMap]")
+{
+    TOrderedMap<int32, int32> Map;
+    for (int32 Index = 0; Index < 10; ++Index)
+    {
+        Map[Index] = Index * 10;
+    }
+
+    REQUIRE(Map.Remove(3) == 1);
+    REQUIRE(Map.Remove(3) == 0);
+    REQUIRE(GetKeys(Map) == TArray<int32>{0, 1, 2, 4, 5, 6, 7, 8, 9});
+
+    // The last entry takes the place of the removed one
+    REQUIRE(Map.RemoveSwap(1) == 1);
+    REQUIRE(Map.RemoveSwap(1) == 0);
+    REQUIRE(GetKeys(Map) == TArray<int32>{0, 9, 2, 4, 5, 6, 7, 8});
+
+    for (const int32 Key : {0, 9, 2, 4, 5, 6, 7, 8})
+    {
+        REQUIRE(Map.Find(Key)->second == Key * 10);
+    }
+    REQUIRE_FALSE(Map.Contains(1));
+    REQUIRE_FALSE(Map.Contains(3));
+
+    Map.Clear();
+    REQUIRE(Map.IsEmpty());
+    REQUIRE_FALSE(Map.Contains(0));
+    Map[7] = 70;
+    REQUIRE(GetKeys(Map) == TArray<int32>{7});
+}
+
+TEST_CASE("TOrderedMap::SlotWidths", "[OrderedMap]")
+{
+    // Crosses the 8 to 16 and 16 to 32 bit slot boundaries and removes back down through them
+    TOrderedMap<int32, int32> Map;
+    static constexpr int32 NumKeys = 70000;
+    for (int32 Index = 0; Index < NumKeys; ++Index)
+    {
+        Map[Index * 7] = Index;
+        if (Index == 100)
+        {
+            REQUIRE(Map.GetSlotCount() == 256);
+        }
+        else if (Index == 20000)
+        {
+            REQUIRE(Map.GetSlotCount() == 65536);
+        }
+    }
+    REQUIRE(Map.Num() == NumKeys);
+    REQUIRE(Map.GetSlotCount() == 262144);
+
+    for (int32 Index = 0; Index < NumKeys; ++Index)
+    {
+        REQUIRE(Map.Find(Index * 7)->second == Index);
+        REQUIRE_FALSE(Map.Contains(Index * 7 + 1));
+    }
+    for (int32 Index = 0; Index < NumKeys; Index += 2)
+    {
+        Map.RemoveSwap(Index * 7);
+    }
+    for (int32 Index = 0; Index < NumKeys; ++Index)
+    {
+        REQUIRE(Map.Contains(Index * 7) == (Index % 2 == 1));
+    }
+}
+
+TEST_CASE("TOrderedMap::MatchesReference", "[OrderedMap]")
+{
+    TOrderedMap<int32, int32> Map;
+    TArray<int32> Order;
+    std::unordered_map<int32, int32> Reference;
+    std::mt19937 Random(11);
+
+    for (int32 Step = 0; Step < 20000; ++Step)
+    {
+        const int32 Key = static_cast<int32>(Random() % 512);
+        const uint32 Operation = Random() % 4;
+        if (Operation < 2)
+        {
+            if (Map.TryEmplace(Key, Step).second)
+            {
+                Order.PushBack(Key);
+                Reference.emplace(Key, Step);
+            }
+        }
+        else if (Operation == 2)
+        {
+            REQUIRE(Map.Remove(Key) == Reference.erase(Key));
+            for (size64 Index = 0; Index < Order.Num(); ++Index)
+            {
+                if (Order[Index] == Key)
+                {
+                    Order.RemoveAt(Index);
+                    break;
+                }
+            }
+        }
+        else
+        {
+            REQUIRE(Map.RemoveSwap(Key) == Reference.erase(Key));
+            for (size64 Index = 0; Index < Order.Num(); ++Index)
+            {
+                if (Order[Index] == Key)
+                {
+                    Order.RemoveAtSwap(Index);
+                    break;
+                }
+            }
+        }
+    }
+
+    REQUIRE(GetKeys(Map) == Order);
+    for (const auto& [Key, Value] : Reference)
+    {
+        REQUIRE(Map.Find(Key)->second == Value);
+    }
+}
+
+TEST_CASE("TOrderedMap::CopyAndMove", "[OrderedMap]")
+{
+    TOrderedMap<std::string, int32> Original{{"one", 1}, {"two", 2}, {"three", 3}};
+
+    TOrderedMap<std::string, int32> Copy(Original);
+    Copy["one"] = 100;
+    Copy["four"] = 4;
+    REQUIRE(Original["one"] == 1);
+    REQUIRE(Original.Num() == 3);
+    REQUIRE(GetKeys(Copy) == TArray<std::string>{"one", "two", "three", "four"});
+
+    TOrderedMap<std::string, int32> Assigned;
+    Assigned = Copy;
+    REQUIRE(Assigned.Find("four")->second == 4);
+
+    TOrderedMap<std::string, int32> Moved(std::move(Copy));
+    REQUIRE(Moved.Num() == 4);
+    REQUIRE(Copy.IsEmpty());
+    REQUIRE(Copy.GetAllocatedSize() == 0);
+
+    Assigned = std::move(Moved);
+    REQUIRE(Assigned.Find("one")->second == 100);
+
+    Assigned.Swap(Original);
+    REQUIRE(Assigned.Num() == 3);
+    REQUIRE(Original.Num() == 4);
+}
+
+TEST_CASE("TOrderedMap::Footprint", "[OrderedMap]")
+{
+    TMap<int32, int32> Map;
+    TOrderedMap<int32, int32> Ordered;
+    for (int32 Index = 0; Index < 100000; ++Index)
+    {
+        Map[Index] = Index;
+        Ordered[Index] = Index;
+    }
+    REQUIRE(Ordered.GetAllocatedSize() * 3 < GetMapFootprint(Map) * 2);
+}
+
+TEST_CASE("TOrderedMap::Benchmark", "[OrderedMap][.benchmark]")
+{
+    static constexpr int32 NumKeys = 100000;
+    TMap<int32, int32> Map;
+    TOrderedMap<int32, int32> Ordered;
+    for (int32 Index = 0; Index < NumKeys; ++Index)
+    {
+        Map[Index * 13] = Index;
+        Ordered[Index * 13] = Index;
+    }
+
+    BENCHMARK("Iterate_TMap")
+    {
+        int64 Sum = 0;
+        for (const auto& [Key, Value] : Map)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Iterate_TOrderedMap")
+    {
+        int64 Sum = 0;
+        for (const auto& [Key, Value] : Ordered)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Find_TMap")
+    {
+        int64 Sum = 0;
+        for (int32 Index = 0; Index < NumKeys; Index += 7)
+        {
+            Sum += Map.Find(Index * 13)->second;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Find_TOrderedMap")
+    {
+        int64 Sum = 0;
+        for (int32 Index = 0; Index < NumKeys; Index += 7)
+        {
+            Sum += Ordered.Find(Index * 13)->second;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Insert_TMap")
+    {
+        TMap<int32, int32> Inserted;
+        for (int32 Index = 0; Index < 10000; ++Index)
+        {
+            Inserted[Index] = Index;
+        }
+        return Inserted.Num();
+    };
+
+    BENCHMARK("Insert_TOrderedMap")
+    {
+        TOrderedMap<int32, int32> Inserted;
+        for (int32 Index = 0; Index < 10000; ++Index)
+        {
+            Inserted[Index] = Index;
+        }
+        return Inserted.Num();
+    };
+
+    BENCHMARK("RemoveSwapAndInsert_TOrderedMap")
+    {
+        for (int32 Index = 0; Index < 1000; ++Index)
+        {
+            Ordered.RemoveSwap(Index * 13);
+            Ordered[Index * 13] = Index;
+        }
+        return Ordered.Num();
+    };
+}
@@ -0,0 +1,424 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/PriorityQueue.hpp"
+#include "Core/Containers/Sorting.hpp"
+
+namespace
+{
+    // Queued node of a shortest path search, ordered by distance. Ties go to the lower node so every queue pops the
+    // same sequence, otherwise the order equal distances come out in changes how the search walks memory and the
+    // benchmarks would measure that instead of the heap
+    struct FPathNode
+    {
+        uint32 Distance;
+        uint32 Node;
+
+        bool8 operator<(const FPathNode& Other) const
+        {
+            return Distance != Other.Distance ? Distance < Other.Distance : Node < Other.Node;
+        }
+
+        bool8 operator>(const FPathNode& Other) const
+        {
+            return Other < *this;
+        }
+    };
+
+    // Four connected grid where entering a cell costs its weight, 1 to 9
+    struct FWeightedGrid
+    {
+        uint32 Width;
+        TArray<uint8> Weights;
+
+        FWeightedGrid(const uint32 InWidth, const uint32 Seed)
+            : Width(InWidth), Weights(size64(InWidth) * InWidth, 0)
+        {
+            std::mt19937 Random(Seed);
+            for (uint8& Weight : Weights)
+            {
+                Weight = static_cast<uint8>(1 + Random() % 9);
+            }
+        }
+
+        template <typename TFunction>
+        void ForEachNeighbor(const uint32 Node, const TFunction& Function) const
+        {
+            const uint32 X = Node % Width;
+            const uint32 Y = Node / Width;
+            if (X > 0)
+            {
+                Function(Node - 1);
+            }
+            if (X + 1 < Width)
+            {
+                Function(Node + 1);
+            }
+            if (Y > 0)
+            {
+                Function(Node - Width);
+            }
+            if (Y + 1 < Width)
+            {
+                Function(Node + Width);
+            }
+        }
+    };
+
+    constexpr uint32 Unreached = 0xFFFFFFFF;
+
+    // Dijkstra with one queue entry per node, lowered in place when a shorter path turns up
+    TArray<uint32> DijkstraDecreaseKey(const FWeightedGrid& Grid)
+    {
+        TArray<uint32> Distances(Grid.Weights.Num(), Unreached);
+        TArray<FHandle64> Handles(Grid.Weights.Num(), FHandle64());
+        TIndexedPriorityQueue<FPathNode> Queue;
+        Distances[0] = 0;
+        Handles[0] = Queue.Push(FPathNode{0, 0});
+        while (!Queue.IsEmpty())
+        {
+            const FPathNode Current = Queue.PopTop();
+            Grid.ForEachNeighbor(Current.Node, [&](const uint32 Neighbor)
+            {
+                const uint32 Distance = Current.Distance + Grid.Weights[Neighbor];
+                if (Distance < Distances[Neighbor])
+                {
+                    if (Distances[Neighbor] == Unreached)
+                    {
+                        Handles[Neighbor] = Queue.Push(FPathNode{Distance, Neighbor});
+                    }
+                    else
+                    {
+                        Queue.DecreaseKey(Handles[Neighbor], FPathNode{Distance, Neighbor});
+                    }
+                    Distances[Neighbor] = Distance;
+                }
+            });
+        }
+        return Distances;
+    }
+
+    // Dijkstra that pushes a node again instead of lowering it and skips the outdated entries when they come out
+    template <typename TQueue>
+    TArray<uint32> DijkstraLazy(const FWeightedGrid& Grid, TQueue& Queue)
+    {
+        TArray<uint32> Distances(Grid.Weights.Num(), Unreached);
+        Distances[0] = 0;
+        Queue.push(FPathNode{0, 0});
+        while (!Queue.empty())
+        {
+            const FPathNode Current = Queue.top();
+            Queue.pop();
+            if (Current.Distance != Distances[Current.Node])
+            {
+                continue;
+            }
+            Grid.ForEachNeighbor(Current.Node, [&](const uint32 Neighbor)
+            {
+                const uint32 Distance = Current.Distance + Grid.Weights[Neighbor];
+                if (Distance < Distances[Neighbor])
+                {
+                    Distances[Neighbor] = Distance;
+                    Queue.push(FPathNode{Distance, Neighbor});
+                }
+            });
+        }
+        return Distances;
+    }
+
+    // The std::priority_queue interface over TPriorityQueue, so both run the same search
+    template <size64 Arity>
+    struct TLazyQueueAdapter
+    {
+        TPriorityQueue<FPathNode, std::less<>, Arity> Queue;
+
+        void push(const FPathNode& Node) { Queue.Push(Node); }
+        void pop() { Queue.Pop(); }
+        const FPathNode& top() const { return Queue.Top(); }
+        bool8 empty() const { return Queue.IsEmpty(); }
+    };
+
+    using FStdPathQueue = std::priority_queue<FPathNode, std::vector<FPathNode>, std::greater<>>;
+}
+
+TEST_CASE("TPriorityQueue::Order", "[PriorityQueue]")
+{
+    std::mt19937 Random(5);
+    TArray<int32> Values;
+    for (int32 Index = 0; Index < 5000; ++Index)
+    {
+        Values.PushBack(static_cast<int32>(Random() % 1000));
+    }
+    TArray<int32> Sorted = Values;
+    Ranges::Sort(Sorted);
+
+    TPriorityQueue<int32> Queue;
+    TPriorityQueue<int32, std::less<>, 2> BinaryQueue;
+    TPriorityQueue<int32, std::less<>, 7> WideQueue;
+    for (const int32 Value : Values)
+    {
+        Queue.Push(Value);
+        BinaryQueue.Push(Value);
+        WideQueue.Emplace(Value);
+    }
+    REQUIRE(Queue.Num() == 5000);
+    for (const int32 Expected : Sorted)
+    {
+        REQUIRE(Queue.Top() == Expected);
+        REQUIRE(Queue.PopTop() == Expected);
+        REQUIRE(BinaryQueue.PopTop() == Expected);
+        REQUIRE(WideQueue.PopTop() == Expected);
+    }
+    REQUIRE(Queue.IsEmpty());
+
+    // Built in one go, every size up to a few levels
+    for (size64 Count = 0; Count < 40; ++Count)
+    {
+        TPriorityQueue<int32> Heapified(std::span<const int32>(Values.GetData(), Count));
+        TArray<int32> Expected;
+        Expected.Append(std::span<const int32>(Values.GetData(), Count));
+        Ranges::Sort(Expected);
+        for (const int32 Value : Expected)
+        {
+            REQUIRE(Heapified.PopTop() == Value);
+        }
+        REQUIRE(Heapified.IsEmpty());
+    }
+}
+
+TEST_CASE("TPriorityQueue::ComparerAndElements", "[PriorityQueue]")
+{
+    TPriorityQueue<std::string, std::greater<>> Names;
+    for (const char* Name : {"delta", "alpha", "echo", "charlie", "bravo"})
+    {
+        Names.Push(Name);
+    }
+    REQUIRE(Names.PopTop() == "echo");
+    REQUIRE(Names.PopTop() == "delta");
+    Names.Push("zulu");
+    REQUIRE(Names.Top() == "zulu");
+    size64 NumIterated = 0;
+    for (const std::string& Name : Names)
+    {
+        REQUIRE(!Name.empty());
+        ++NumIterated;
+    }
+    REQUIRE(NumIterated == 4);
+    Names.Clear();
+    REQUIRE(Names.IsEmpty());
+}
+
+TEST_CASE("TIndexedPriorityQueue::Handles", "[PriorityQueue]")
+{
+    TIndexedPriorityQueue<int32> Queue;
+    const FHandle64 Ten = Queue.Push(10);
+    const FHandle64 Twenty = Queue.Push(20);
+    const FHandle64 Thirty = Queue.Push(30);
+    REQUIRE(Queue.Top() == 10);
+    REQUIRE(Queue.GetTopHandle() == Ten);
+
+    Queue.DecreaseKey(Thirty, 5);
+    REQUIRE(Queue.GetTopHandle() == Thirty);
+    REQUIRE(Queue[Thirty] == 5);
+
+    Queue.Update(Thirty, 25);
+    REQUIRE(Queue.Top() == 10);
+    REQUIRE(*Queue.Find(Thirty) == 25);
+
+    REQUIRE(Queue.Remove(Ten));
+    REQUIRE_FALSE(Queue.Remove(Ten));
+    REQUIRE_FALSE(Queue.Contains(Ten));
+    REQUIRE(Queue.Find(Ten) == nullptr);
+    REQUIRE(Queue.Top() == 20);
+
+    // A reused slot does not bring the old handle back
+    const FHandle64 One = Queue.Push(1);
+    REQUIRE(One.GetIndex() == Ten.GetIndex());
+    REQUIRE_FALSE(Queue.Contains(Ten));
+    REQUIRE(Queue.PopTop() == 1);
+    REQUIRE(Queue.PopTop() == 20);
+    REQUIRE(Queue.Contains(Thirty));
+    REQUIRE_FALSE(Queue.Contains(Twenty));
+
+    Queue.Clear();
+    REQUIRE(Queue.IsEmpty());
+    REQUIRE_FALSE(Queue.Contains(Thirty));
+    REQUIRE_FALSE(Queue.Contains(FHandle64()));
+}
+
+TEST_CASE("TIndexedPriorityQueue::MatchesReference", "[PriorityQueue]")
+{
+    // Random pushes, pops, updates and removes against a plain array searched for its minimum
+    std::mt19937 Random(17);
+    TIndexedPriorityQueue<int32, std::less<>, 4, FHandle32> Queue;
+    TArray<std::pair<FHandle32, int32>> Reference;
+    for (int32 Step = 0; Step < 20000; ++Step)
+    {
+        const uint32 Operation = Random() % 10;
+        if (Operation < 4 || Reference.IsEmpty())
+        {
+            const int32 Value = static_cast<int32>(Random() % 10000);
+            Reference.PushBack({Queue.Push(Value), Value});
+        }
+        else if (Operation < 6)
+        {
+            size64 MinIndex = 0;
+            for (size64 Index = 1; Index < Reference.Num(); ++Index)
+            {
+                MinIndex = Reference[Index].second < Reference[MinIndex].second ? Index : MinIndex;
+            }
+            REQUIRE(Queue.Top() == Reference[MinIndex].second);
+            REQUIRE(Queue[Queue.GetTopHandle()] == Reference[MinIndex].second);
+            Queue.Remove(Queue.GetTopHandle());
+            // Ties may come out in any order, drop one with the same value
+            for (size64 Index = 0; Index < Reference.Num(); ++Index)
+            {
+                if (!Queue.Contains(Reference[Index].first))
+                {
+                    Reference.RemoveAtSwap(Index);
+                    break;
+                }
+            }
+        }
+        else if (Operation < 8)
+        {
+            auto& [Handle, Value] = Reference[Random() % Reference.Num()];
+            Value = static_cast<int32>(Random() % 10000);
+            Queue.Update(Handle, Value);
+        }
+        else if (Operation < 9)
+        {
+            auto& [Handle, Value] = Reference[Random() % Reference.Num()];
+            Value -= static_cast<int32>(Random() % 100);
+            Queue.DecreaseKey(Handle, Value);
+        }
+        else
+        {
+            const size64 Index = Random() % Reference.Num();
+            REQUIRE(Queue.Remove(Reference[Index].first));
+            Reference.RemoveAtSwap(Index);
+        }
+        REQUIRE(Queue.Num() == Reference.Num());
+    }
+    for (const auto& [Handle, Value] : Reference)
+    {
+        REQUIRE(Queue[Handle] == Value);
+    }
+}
+
+TEST_CASE("TIndexedPriorityQueue::Dijkstra", "[PriorityQueue]")
+{
+    const FWeightedGrid Grid(64, 3);
+    const TArray<uint32> Expected = DijkstraDecreaseKey(Grid);
+    TLazyQueueAdapter<4> LazyQueue;
+    FStdPathQueue StdQueue;
+    REQUIRE(DijkstraLazy(Grid, LazyQueue) == Expected);
+    REQUIRE(DijkstraLazy(Grid, StdQueue) == Expected);
+    REQUIRE(Expected[1] == Grid.Weights[1]);
+}
+
+TEST_CASE("TPriorityQueue::Benchmark", "[PriorityQueue][.benchmark]")
+{
+    static constexpr size64 NumElements = 1 << 20;
+
+    std::mt19937 Random(23);
+    TArray<uint32> Values;
+    for (size64 Index = 0; Index < NumElements; ++Index)
+    {
+        Values.PushBack(static_cast<uint32>(Random()));
+    }
+
+    // Every element pushed and then popped again
+    BENCHMARK("PushPop_4ary")
+    {
+        TPriorityQueue<uint32> Queue;
+        for (const uint32 Value : Values)
+        {
+            Queue.Push(Value);
+        }
+        uint64 Sum = 0;
+        while (!Queue.IsEmpty())
+        {
+            Sum += Queue.PopTop();
+        }
+        return Sum;
+    };
+
+    BENCHMARK("PushPop_2ary")
+    {
+        TPriorityQueue<uint32, std::less<>, 2> Queue;
+        for (const uint32 Value : Values)
+        {
+            Queue.Push(Value);
+        }
+        uint64 Sum = 0;
+        while (!Queue.IsEmpty())
+        {
+            Sum += Queue.PopTop();
+        }
+        return Sum;
+    };
+
+    BENCHMARK("PushPop_Indexed")
+    {
+        TIndexedPriorityQueue<uint32> Queue;
+        for (const uint32 Value : Values)
+        {
+            Queue.Push(Value);
+        }
+        uint64 Sum = 0;
+        while (!Queue.IsEmpty())
+        {
+            Sum += Queue.PopTop();
+        }
+        return Sum;
+    };
+
+    BENCHMARK("PushPop_StdPriorityQueue")
+    {
+        std::priority_queue<uint32, std::vector<uint32>, std::greater<>> Queue;
+        for (const uint32 Value : Values)
+        {
+            Queue.push(Value);
+        }
+        uint64 Sum = 0;
+        while (!Queue.empty())
+        {
+            Sum += Queue.top();
+            Queue.pop();
+        }
+        return Sum;
+    };
+
+    // Shortest paths over a 1024 x 1024 grid, one million nodes
+    const FWeightedGrid Grid(1024, 29);
+
+    BENCHMARK("Dijkstra_DecreaseKey")
+    {
+        return DijkstraDecreaseKey(Grid).GetLast();
+    };
+
+    BENCHMARK("Dijkstra_Lazy4ary")
+    {
+        TLazyQueueAdapter<4> Queue;
+        return DijkstraLazy(Grid, Queue).GetLast();
+    };
+
+    BENCHMARK("Dijkstra_Lazy2ary")
+    {
+        TLazyQueueAdapter<2> Queue;
+        return DijkstraLazy(Grid, Queue).GetLast();
+    };
+
+    BENCHMARK("Dijkstra_LazyStd")
+    {
+        FStdPathQueue Queue;
+        return DijkstraLazy(Grid, Queue).GetLast();
+    };
+}
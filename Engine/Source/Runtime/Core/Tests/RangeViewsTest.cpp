@@ -0,0 +1,231 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "Core/Containers/Queue.hpp"
+#include "Core/Containers/RangeViews.hpp"
+#include "Core/Containers/StaticArray.hpp"
+
+#include <string>
+
+static TArray<int32> MakeIota(const int32 Count)
+{
+    TArray<int32> Array;
+    Array.Reserve(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Array.PushBack(Index);
+    }
+    return Array;
+}
+
+TEST_CASE("Ranges::Views::Filter", "[RangeViews]")
+{
+    const TArray<int32> Array = MakeIota(10);
+
+    TArray<int32> Result;
+    for (const int32 Value : Array | Ranges::Views::Filter([](const int32 Value) { return Value % 3 == 0; }))
+    {
+        Result.PushBack(Value);
+    }
+    REQUIRE(Result == TArray<int32>{0, 3, 6, 9});
+
+    const auto NoneMatch = Ranges::Views::Filter(Array, [](const int32 Value) { return Value > 100; });
+    REQUIRE(NoneMatch.begin() == NoneMatch.end());
+}
+
+TEST_CASE("Ranges::Views::Map", "[RangeViews]")
+{
+    TArray<int32> Array = MakeIota(5);
+
+    TArray<int32> Result;
+    for (const int32 Value : Array | Ranges::Views::Map([](const int32 Value) { return Value * Value; }))
+    {
+        Result.PushBack(Value);
+    }
+    REQUIRE(Result == TArray<int32>{0, 1, 4, 9, 16});
+
+    SECTION("ReferencesWriteThrough")
+    {
+        for (int32& Value : Array | Ranges::Views::Filter([](const int32 Value) { return Value % 2 == 0; }))
+        {
+            Value = -1;
+        }
+        REQUIRE(Array == TArray<int32>{-1, 1, -1, 3, -1});
+    }
+}
+
+TEST_CASE("Ranges::Views::TakeAndDrop", "[RangeViews]")
+{
+    const TArray<int32> Array = MakeIota(10);
+
+    REQUIRE(Ranges::Sum(Array | Ranges::Views::Take(3)) == 0 + 1 + 2);
+    REQUIRE(Ranges::Sum(Array | Ranges::Views::Drop(7)) == 7 + 8 + 9);
+    REQUIRE(Ranges::Sum(Array | Ranges::Views::Take(100)) == 45);
+
+    const auto DropAll = Array | Ranges::Views::Drop(100);
+    REQUIRE(DropAll.begin() == DropAll.end());
+
+    const auto TakeNone = Array | Ranges::Views::Take(0);
+    REQUIRE(TakeNone.begin() == TakeNone.end());
+
+    // Take stops the filter from scanning past the last element it needs
+    int32 Visited = 0;
+    const auto FirstEven = Array | Ranges::Views::Filter([&Visited](const int32 Value) { ++Visited; return Value % 2 == 0; }) | Ranges::Views::Take(2);
+    REQUIRE(Ranges::Sum(FirstEven) == 0 + 2);
+    REQUIRE(Visited == 3);
+}
+
+TEST_CASE("Ranges::Views::Zip", "[RangeViews]")
+{
+    TArray<int32> Keys = MakeIota(4);
+    const TStaticArray<float32, 3> Weights{0.5f, 1.5f, 2.5f};
+
+    float32 Total = 0.0f;
+    size64 Count = 0;
+    for (const auto [Key, Weight] : Ranges::Views::Zip(Keys, Weights))
+    {
+        Total += static_cast<float32>(Key) * Weight;
+        ++Count;
+    }
+    REQUIRE(Count == 3);
+    REQUIRE(Total == 0.0f * 0.5f + 1.0f * 1.5f + 2.0f * 2.5f);
+
+    for (auto [Key, Weight] : Keys | Ranges::Views::Zip(Weights))
+    {
+        Key = static_cast<int32>(Weight * 2.0f);
+    }
+    REQUIRE(Keys == TArray<int32>{1, 3, 5, 3});
+}
+
+TEST_CASE("Ranges::Views::Enumerate", "[RangeViews]")
+{
+    TQueue<std::string> Queue;
+    Queue.Enqueue("a");
+    Queue.Enqueue("b");
+    Queue.Enqueue("c");
+
+    std::string Joined;
+    for (const auto [Index, Value] : Queue | Ranges::Views::Enumerate())
+    {
+        Joined += std::to_string(Index) + Value;
+    }
+    REQUIRE(Joined == "0a1b2c");
+}
+
+TEST_CASE("Ranges::Views::Chunk", "[RangeViews]")
+{
+    const TArray<int32> Array = MakeIota(10);
+
+    TArray<int32> ChunkSums;
+    for (const auto ChunkRange : Array | Ranges::Views::Chunk(4))
+    {
+        ChunkSums.PushBack(Ranges::Sum(ChunkRange));
+    }
+    REQUIRE(ChunkSums == TArray<int32>{0 + 1 + 2 + 3, 4 + 5 + 6 + 7, 8 + 9});
+
+    const TArray<int32> Empty;
+    const auto EmptyChunks = Empty | Ranges::Views::Chunk(4);
+    REQUIRE(EmptyChunks.begin() == EmptyChunks.end());
+}
+
+TEST_CASE("Ranges::Views::Map over TMap", "[RangeViews]")
+{
+    const TMap<int32, int32> Map{{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+
+    const auto EvenValues = Map
+        | Ranges::Views::Filter([](const auto& Pair) { return Pair.first % 2 == 0; })
+        | Ranges::Views::Map([](const auto& Pair) { return Pair.second; });
+
+    REQUIRE(Ranges::Sum(EvenValues) == 60);
+    REQUIRE(Ranges::CountIf(EvenValues, [](const int32 Value) { return Value > 20; }) == 1);
+    REQUIRE(Ranges::Sum(Map | Ranges::Views::Take(2) | Ranges::Views::Map([](const auto&) { return 1; })) == 2);
+}
+
+TEST_CASE("Ranges::Views::ConstexprEvaluation", "[RangeViews]")
+{
+    constexpr int32 Result = []()
+    {
+        TStaticArray<int32, 8> Array{1, 2, 3, 4, 5, 6, 7, 8};
+        int32 Sum = 0;
+        for (const int32 Value : Array | Ranges::Views::Drop(1) | Ranges::Views::Filter([](const int32 Value) { return Value % 2 == 1; }) | Ranges::Views::Map([](const int32 Value) { return Value * 10; }))
+        {
+            Sum += Value;
+        }
+        return Sum;
+    }();
+    STATIC_REQUIRE(Result == 30 + 50 + 70);
+}
+
+TEST_CASE("Ranges::Views::BenchmarkZeroOverhead", "[RangeViews][.benchmark]")
+{
+    const TArray<int32> Array = MakeIota(1000000);
+    const TArray<int32> Weights = MakeIota(1000000);
+
+    BENCHMARK("FilterMap_HandWritten")
+    {
+        int64 Sum = 0;
+        for (const int32 Value : Array)
+        {
+            if (Value % 3 == 0)
+            {
+                Sum += static_cast<int64>(Value) * Value;
+            }
+        }
+        return Sum;
+    };
+
+    BENCHMARK("FilterMap_Views")
+    {
+        int64 Sum = 0;
+        for (const int64 Value : Array
+            | Ranges::Views::Filter([](const int32 Value) { return Value % 3 == 0; })
+            | Ranges::Views::Map([](const int32 Value) { return static_cast<int64>(Value) * Value; }))
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Zip_HandWritten")
+    {
+        int64 Sum = 0;
+        for (size64 Index = 0; Index < Array.Num(); ++Index)
+        {
+            Sum += static_cast<int64>(Array[Index]) * Weights[Index];
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Zip_Views")
+    {
+        int64 Sum = 0;
+        for (const auto [Value, Weight] : Ranges::Views::Zip(Array, Weights))
+        {
+            Sum += static_cast<int64>(Value) * Weight;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("TakeDrop_HandWritten")
+    {
+        int64 Sum = 0;
+        for (size64 Index = 1000; Index < 501000; ++Index)
+        {
+            Sum += Array[Index];
+        }
+        return Sum;
+    };
+
+    BENCHMARK("TakeDrop_Views")
+    {
+        int64 Sum = 0;
+        for (const int32 Value : Array | Ranges::Views::Drop(1000) | Ranges::Views::Take(500000))
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+}
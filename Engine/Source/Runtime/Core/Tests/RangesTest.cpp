@@ -0,0 +1,317 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Ranges.hpp"
+#include "Core/Containers/RangesParallel.hpp"
+#include "Core/Containers/StaticArray.hpp"
+
+#include <limits>
+#include <string>
+
+template <typename TElement>
+static TArray<TElement> MakeSequence(const size64 Count)
+{
+    TArray<TElement> Array;
+    Array.Reserve(Count);
+    for (size64 Index = 0; Index < Count; ++Index)
+    {
+        Array.PushBack(static_cast<TElement>(Index % 100));
+    }
+    return Array;
+}
+
+TEST_CASE("Ranges::Find", "[Ranges]")
+{
+    SECTION("AllTailLengths")
+    {
+        // Cover the unrolled body, the single vector loop and the scalar tail for every lane width
+        for (size64 Count = 0; Count < 300; Count += 7)
+        {
+            TArray<uint8> Bytes(Count, 0);
+            TArray<int16> Shorts(Count, 0);
+            TArray<int32> Ints(Count, 0);
+            TArray<int64> Longs(Count, 0);
+            if (Count > 0)
+            {
+                Bytes.GetLast() = 1;
+                Shorts.GetLast() = -1;
+                Ints.GetLast() = -1;
+                Longs.GetLast() = std::numeric_limits<int64>::min();
+            }
+
+            const size64 Expected = Count > 0 ? Count - 1 : static_cast<size64>(-1);
+            REQUIRE(Ranges::Find(Bytes, uint8(1)) == Expected);
+            REQUIRE(Ranges::Find(Shorts, int16(-1)) == Expected);
+            REQUIRE(Ranges::Find(Ints, -1) == Expected);
+            REQUIRE(Ranges::Find(Longs, std::numeric_limits<int64>::min()) == Expected);
+        }
+    }
+
+    SECTION("ReturnsFirstMatch")
+    {
+        TArray<int32> Array = MakeSequence<int32>(1000);
+        REQUIRE(Ranges::Find(Array, 42) == 42);
+        REQUIRE(Ranges::Find(Array, 99) == 99);
+        REQUIRE(Ranges::Find(Array, 1000) == static_cast<size64>(-1));
+    }
+
+    SECTION("Int64UpperHalfOnlyIsNoMatch")
+    {
+        TArray<uint64> Array(64, 0x0000000100000000ull);
+        Array[40] = 0x0000000100000001ull;
+        REQUIRE(Ranges::Find(Array, 0x0000000000000001ull) == static_cast<size64>(-1));
+        REQUIRE(Ranges::Find(Array, 0x0000000100000001ull) == 40);
+    }
+
+    SECTION("FloatingPointEquality")
+    {
+        TArray<float32> Floats(100, 1.0f);
+        Floats[10] = std::numeric_limits<float32>::quiet_NaN();
+        Floats[20] = -0.0f;
+        REQUIRE(Ranges::Find(Floats, 0.0f) == 20);
+        REQUIRE(Ranges::Find(Floats, std::numeric_limits<float32>::quiet_NaN()) == static_cast<size64>(-1));
+
+        TArray<float64> Doubles(100, 1.0);
+        Doubles[77] = 2.5;
+        REQUIRE(Ranges::Find(Doubles, 2.5) == 77);
+    }
+
+    SECTION("StaticArray")
+    {
+        TStaticArray<float32, 64> Array(0.5f);
+        Array[63] = 3.0f;
+        REQUIRE(Ranges::Find(Array, 3.0f) == 63);
+        REQUIRE(Ranges::Contains(Array, 3.0f));
+        REQUIRE_FALSE(Ranges::Contains(Array, 4.0f));
+    }
+}
+
+TEST_CASE("Ranges::Count", "[Ranges]")
+{
+    for (size64 Count = 0; Count < 300; Count += 13)
+    {
+        const TArray<uint8> Bytes = MakeSequence<uint8>(Count);
+        const TArray<uint16> Shorts = MakeSequence<uint16>(Count);
+        const TArray<int32> Ints = MakeSequence<int32>(Count);
+        const TArray<uint64> Longs = MakeSequence<uint64>(Count);
+        const TArray<float32> Floats = MakeSequence<float32>(Count);
+        const TArray<float64> Doubles = MakeSequence<float64>(Count);
+
+        const size64 Expected = Ranges::CountIf(Ints, [](const int32 Value) { return Value == 7; });
+        REQUIRE(Ranges::Count(Bytes, uint8(7)) == Expected);
+        REQUIRE(Ranges::Count(Shorts, uint16(7)) == Expected);
+        REQUIRE(Ranges::Count(Ints, 7) == Expected);
+        REQUIRE(Ranges::Count(Longs, uint64(7)) == Expected);
+        REQUIRE(Ranges::Count(Floats, 7.0f) == Expected);
+        REQUIRE(Ranges::Count(Doubles, 7.0) == Expected);
+    }
+}
+
+TEST_CASE("Ranges::Fill", "[Ranges]")
+{
+    for (size64 Count = 0; Count < 300; Count += 11)
+    {
+        TArray<uint8> Bytes(Count, 0);
+        TArray<int32> Ints(Count, 0);
+        TArray<float64> Doubles(Count, 0.0);
+
+        Ranges::Fill(Bytes, uint8(0xAB));
+        Ranges::Fill(Ints, -5);
+        Ranges::Fill(Doubles, 1.25);
+
+        REQUIRE(Ranges::AllOf(Bytes, [](const uint8 Value) { return Value == 0xAB; }));
+        REQUIRE(Ranges::AllOf(Ints, [](const int32 Value) { return Value == -5; }));
+        REQUIRE(Ranges::AllOf(Doubles, [](const float64 Value) { return Value == 1.25; }));
+    }
+}
+
+TEST_CASE("Ranges::ConstexprEvaluation", "[Ranges]")
+{
+    constexpr size64 Index = []()
+    {
+        TStaticArray<int32, 64> Array(0);
+        Array[50] = 9;
+        return Ranges::Find(Array, 9);
+    }();
+    STATIC_REQUIRE(Index == 50);
+}
+
+TEST_CASE("Ranges::Parallel", "[Ranges]")
+{
+    const size64 Count = Ranges::Parallel::MinParallelElements * 8 + 123;
+
+    SECTION("ForEachAndTransform")
+    {
+        TArray<int32> Array = MakeSequence<int32>(Count);
+
+        Ranges::Parallel::ForEach(Array, [](int32& Element) { Element += 1; });
+        Ranges::Parallel::Transform(Array, [](const int32 Element) { return Element * 2; });
+
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            REQUIRE(Array[Index] == static_cast<int32>((Index % 100 + 1) * 2));
+        }
+    }
+
+    SECTION("Fill")
+    {
+        TArray<uint16> Array(Count, 0);
+        Ranges::Parallel::Fill(Array, uint16(7));
+        REQUIRE(Ranges::Count(Array, uint16(7)) == Count);
+    }
+
+    SECTION("CountMatchesSequential")
+    {
+        const TArray<int32> Array = MakeSequence<int32>(Count);
+        REQUIRE(Ranges::Parallel::Count(Array, 42) == Ranges::Count(Array, 42));
+        REQUIRE(Ranges::Parallel::CountIf(Array, [](const int32 Value) { return Value < 10; }) ==
+                Ranges::CountIf(Array, [](const int32 Value) { return Value < 10; }));
+    }
+
+    SECTION("SumIsDeterministic")
+    {
+        TArray<float32> Array;
+        Array.Reserve(Count);
+        for (size64 Index = 0; Index < Count; ++Index)
+        {
+            Array.PushBack(1.0f / static_cast<float32>(Index % 97 + 1));
+        }
+
+        const float32 First = Ranges::Parallel::Sum(Array);
+        for (int32 Iteration = 0; Iteration < 8; ++Iteration)
+        {
+            REQUIRE(Ranges::Parallel::Sum(Array) == First);
+        }
+
+        const TArray<int64> Integers = MakeSequence<int64>(Count);
+        REQUIRE(Ranges::Parallel::Sum(Integers) == Ranges::Sum(Integers));
+        REQUIRE(Ranges::Parallel::Sum(Integers, [](const int64 Value) { return Value * 2; }) == Ranges::Sum(Integers) * 2);
+    }
+
+    SECTION("SmallRangesRunSequential")
+    {
+        TArray<int32> Array = MakeSequence<int32>(100);
+        Ranges::Parallel::Fill(Array, 3);
+        REQUIRE(Ranges::Parallel::Count(Array, 3) == 100);
+        REQUIRE(Ranges::Parallel::Sum(Array) == 300);
+    }
+}
+
+static void BenchmarkFindAndCount(const size64 Count)
+{
+    TArray<int32> Array(Count, 0);
+    Array.GetLast() = 1;
+
+    BENCHMARK("FindIf_Generic_" + std::to_string(Count))
+    {
+        return Ranges::FindIf(Array, [](const int32 Value) { return Value == 1; });
+    };
+
+    BENCHMARK("Find_Vectorized_" + std::to_string(Count))
+    {
+        return Ranges::Find(Array, 1);
+    };
+
+    BENCHMARK("CountIf_Generic_" + std::to_string(Count))
+    {
+        return Ranges::CountIf(Array, [](const int32 Value) { return Value == 0; });
+    };
+
+    BENCHMARK("Count_Vectorized_" + std::to_string(Count))
+    {
+        return Ranges::Count(Array, 0);
+    };
+
+    BENCHMARK("Fill_Generic_" + std::to_string(Count))
+    {
+        for (int32& Element : Array)
+        {
+            Element = 0;
+        }
+        return Array.GetFirst();
+    };
+
+    BENCHMARK("Fill_Vectorized_" + std::to_string(Count))
+    {
+        Ranges::Fill(Array, 0);
+        return Array.GetFirst();
+    };
+}
+
+TEST_CASE("Ranges::BenchmarkVectorized", "[Ranges][.benchmark]")
+{
+    BenchmarkFindAndCount(1000);
+    BenchmarkFindAndCount(1000000);
+    BenchmarkFindAndCount(100000000);
+}
+
+TEST_CASE("Ranges::BenchmarkVectorizedFloat", "[Ranges][.benchmark]")
+{
+    TStaticArray<float32, 4096> Array(0.0f);
+    Array.GetLast() = 1.0f;
+
+    BENCHMARK("FindIf_Generic")
+    {
+        return Ranges::FindIf(Array, [](const float32 Value) { return Value == 1.0f; });
+    };
+
+    BENCHMARK("Find_Vectorized")
+    {
+        return Ranges::Find(Array, 1.0f);
+    };
+}
+
+TEST_CASE("Ranges::BenchmarkParallel", "[Ranges][.benchmark]")
+{
+    struct FEntity
+    {
+        float32 Position[3];
+        float32 Velocity[3];
+        float32 Padding[10];
+    };
+
+    TArray<FEntity> Entities(500000, FEntity{{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}, {}});
+    const auto Integrate = [](FEntity& Entity)
+    {
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            Entity.Position[Axis] += Entity.Velocity[Axis] * 0.016f;
+        }
+    };
+
+    BENCHMARK("ForEach_Sequential_500K")
+    {
+        Ranges::ForEach(Entities, Integrate);
+        return Entities.GetFirst().Position[0];
+    };
+
+    BENCHMARK("ForEach_Parallel_500K")
+    {
+        Ranges::Parallel::ForEach(Entities, Integrate);
+        return Entities.GetFirst().Position[0];
+    };
+
+    TArray<float32> Values(10000000, 0.5f);
+
+    BENCHMARK("Sum_Sequential_10M")
+    {
+        return Ranges::Sum(Values);
+    };
+
+    BENCHMARK("Sum_Parallel_10M")
+    {
+        return Ranges::Parallel::Sum(Values);
+    };
+
+    BENCHMARK("Count_Sequential_10M")
+    {
+        return Ranges::Count(Values, 0.5f);
+    };
+
+    BENCHMARK("Count_Parallel_10M")
+    {
+        return Ranges::Parallel::Count(Values, 0.5f);
+    };
+}
@@ -0,0 +1,245 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "Core/Containers/Set.hpp"
+
+namespace
+{
+    TSet<int32> MakeRangeSet(const int32 First, const int32 Last)
+    {
+        TSet<int32> Set;
+        for (int32 Value = First; Value < Last; ++Value)
+        {
+            Set.Insert(Value);
+        }
+        return Set;
+    }
+}
+
+TEST_CASE("TSet::Construction", "[Set]")
+{
+    const TSet<int32> Empty;
+    REQUIRE(Empty.IsEmpty());
+    REQUIRE(Empty.GetBucketCount() == 0);
+    REQUIRE(Empty.begin() == Empty.end());
+
+    const TSet<int32> Set{1, 2, 3, 2};
+    REQUIRE(Set.Num() == 3);
+    REQUIRE(Set.Contains(2));
+    REQUIRE_FALSE(Set.Contains(4));
+
+    TSet<int32> Copy(Set);
+    Copy.Insert(4);
+    REQUIRE(Set.Num() == 3);
+    REQUIRE(Copy.Num() == 4);
+
+    TSet<int32> Moved(std::move(Copy));
+    REQUIRE(Moved.Num() == 4);
+    REQUIRE(Copy.IsEmpty());
+
+    Moved = {7, 8};
+    REQUIRE(Moved == TSet<int32>{8, 7});
+}
+
+TEST_CASE("TSet::InsertAndRemove", "[Set]")
+{
+    TSet<std::string> Set;
+    REQUIRE(Set.Insert("alpha").second);
+    REQUIRE_FALSE(Set.Insert("alpha").second);
+    REQUIRE(Set.Emplace(3, 'b').second);
+    REQUIRE(*Set.Find("bbb") == "bbb");
+    REQUIRE(Set.Find("gamma") == Set.end());
+
+    std::string Moved = "gamma";
+    REQUIRE(Set.Insert(std::move(Moved)).second);
+    REQUIRE(Set.Num() == 3);
+
+    REQUIRE(Set.Remove("alpha") == 1);
+    REQUIRE(Set.Remove("alpha") == 0);
+
+    // Removing through a reference to the element itself
+    REQUIRE(Set.Remove(*Set.begin()) == 1);
+    REQUIRE(Set.Num() == 1);
+
+    Set.Clear();
+    REQUIRE(Set.IsEmpty());
+}
+
+TEST_CASE("TSet::SetOperations", "[Set]")
+{
+    const TSet<int32> A = MakeRangeSet(0, 100);
+    const TSet<int32> B = MakeRangeSet(50, 1000);
+
+    const TSet<int32> Union = A.Union(B);
+    REQUIRE(Union == MakeRangeSet(0, 1000));
+    REQUIRE(B.Union(A) == Union);
+
+    const TSet<int32> Intersection = A.Intersect(B);
+    REQUIRE(Intersection == MakeRangeSet(50, 100));
+    REQUIRE(B.Intersect(A) == Intersection);
+
+    REQUIRE(A.Difference(B) == MakeRangeSet(0, 50));
+    REQUIRE(B.Difference(A) == MakeRangeSet(100, 1000));
+
+    REQUIRE(Intersection.IsSubsetOf(A));
+    REQUIRE(Intersection.IsSubsetOf(B));
+    REQUIRE_FALSE(A.IsSubsetOf(B));
+
+    TSet<int32> InPlace = A;
+    InPlace.UnionWith(B);
+    REQUIRE(InPlace == Union);
+    InPlace.IntersectWith(A);
+    REQUIRE(InPlace == A);
+
+    // Both directions of the size based IntersectWith and DifferenceWith
+    TSet<int32> Small = A;
+    Small.IntersectWith(B);
+    REQUIRE(Small == Intersection);
+    TSet<int32> Larger = B;
+    Larger.IntersectWith(A);
+    REQUIRE(Larger == Intersection);
+    InPlace.DifferenceWith(B);
+    REQUIRE(InPlace == MakeRangeSet(0, 50));
+    TSet<int32> Large = B;
+    Large.DifferenceWith(A);
+    REQUIRE(Large == MakeRangeSet(100, 1000));
+
+    TSet<int32> Self = A;
+    Self.IntersectWith(Self);
+    REQUIRE(Self == A);
+    Self.DifferenceWith(Self);
+    REQUIRE(Self.IsEmpty());
+
+    const TSet<int32> Empty;
+    REQUIRE(A.Intersect(Empty).IsEmpty());
+    REQUIRE(A.Union(Empty) == A);
+    REQUIRE(A.Difference(Empty) == A);
+}
+
+TEST_CASE("TSet::MatchesReference", "[Set]")
+{
+    TSet<int64> Set;
+    std::unordered_set<int64> Reference;
+    std::mt19937_64 Random(5);
+    for (int32 Step = 0; Step < 50000; ++Step)
+    {
+        const int64 Value = static_cast<int64>(Random() % 4096);
+        if (Random() % 3 == 0)
+        {
+            REQUIRE(Set.Remove(Value) == Reference.erase(Value));
+        }
+        else
+        {
+            REQUIRE(Set.Insert(Value).second == Reference.insert(Value).second);
+        }
+    }
+    REQUIRE(Set.Num() == Reference.size());
+    for (const int64 Value : Set)
+    {
+        REQUIRE(Reference.contains(Value));
+    }
+}
+
+TEST_CASE("TSet::BenchmarkMembership", "[Set][.benchmark]")
+{
+    static constexpr int64 NumKeys = 10000000;
+    static constexpr int64 NumQueries = 1 << 16;
+
+    std::mt19937_64 Random(29);
+    TArray<int64> Queries;
+    for (int64 Index = 0; Index < NumQueries; ++Index)
+    {
+        // Half of the queries hit
+        Queries.PushBack(static_cast<int64>(Random() % (NumKeys * 2)) * 3);
+    }
+
+    TSet<int64> Set;
+    TMap<int64, bool8> BoolMap;
+    std::unordered_set<int64> StdSet;
+    Set.Reserve(NumKeys);
+    BoolMap.Reserve(NumKeys);
+    StdSet.reserve(NumKeys);
+    for (int64 Index = 0; Index < NumKeys; ++Index)
+    {
+        Set.Insert(Index * 3);
+        BoolMap[Index * 3] = true;
+        StdSet.insert(Index * 3);
+    }
+
+    BENCHMARK("Contains_TSet_10M")
+    {
+        int64 Hits = 0;
+        for (const int64 Query : Queries)
+        {
+            Hits += Set.Contains(Query) ? 1 : 0;
+        }
+        return Hits;
+    };
+
+    BENCHMARK("Contains_TMapBool_10M")
+    {
+        int64 Hits = 0;
+        for (const int64 Query : Queries)
+        {
+            Hits += BoolMap.Contains(Query) ? 1 : 0;
+        }
+        return Hits;
+    };
+
+    BENCHMARK("Contains_StdUnorderedSet_10M")
+    {
+        int64 Hits = 0;
+        for (const int64 Query : Queries)
+        {
+            Hits += StdSet.contains(Query) ? 1 : 0;
+        }
+        return Hits;
+    };
+}
+
+TEST_CASE("TSet::BenchmarkSetOperations", "[Set][.benchmark]")
+{
+    const TSet<int32> A = MakeRangeSet(0, 200000);
+    const TSet<int32> B = MakeRangeSet(100000, 300000);
+    const TSet<int32> Small = MakeRangeSet(150000, 151000);
+
+    BENCHMARK("Union_200K")
+    {
+        return A.Union(B).Num();
+    };
+
+    BENCHMARK("Intersect_200K")
+    {
+        return A.Intersect(B).Num();
+    };
+
+    BENCHMARK("Intersect_200KWith1K")
+    {
+        return A.Intersect(Small).Num();
+    };
+
+    BENCHMARK("Difference_200K")
+    {
+        return A.Difference(B).Num();
+    };
+
+    // What the same intersection costs with the per element inserts it replaces
+    BENCHMARK("Intersect_200K_NaiveInserts")
+    {
+        TSet<int32> Result;
+        for (const int32 Value : A)
+        {
+            if (B.Contains(Value))
+            {
+                Result.Insert(Value);
+            }
+        }
+        return Result.Num();
+    };
+}
@@ -0,0 +1,329 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <string>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/SoAArray.hpp"
+#include "Core/Math/Vector.hpp"
+
+namespace
+{
+    // Tracks live instances, so leaked or doubly destroyed elements show up as a non zero count
+    struct FSoATracked
+    {
+        static inline int32 NumAlive = 0;
+
+        int32 Value = 0;
+
+        FSoATracked(const int32 InValue = 0)
+            : Value(InValue)
+        {
+            ++NumAlive;
+        }
+
+        FSoATracked(const FSoATracked& Other)
+            : Value(Other.Value)
+        {
+            ++NumAlive;
+        }
+
+        FSoATracked(FSoATracked&& Other) noexcept
+            : Value(Other.Value)
+        {
+            Other.Value = -1;
+            ++NumAlive;
+        }
+
+        FSoATracked& operator=(const FSoATracked& Other) = default;
+
+        ~FSoATracked()
+        {
+            --NumAlive;
+        }
+    };
+
+    // A 64 byte particle, once as a struct and once as one float column per member
+    struct FSoAParticle
+    {
+        float32 PositionX, PositionY, PositionZ;
+        float32 VelocityX, VelocityY, VelocityZ;
+        float32 ColorR, ColorG, ColorB, ColorA;
+        float32 Age, Lifetime, Rotation, Spin, Size, Drag;
+    };
+
+    enum EParticleField : size64
+    {
+        PositionX, PositionY, PositionZ,
+        VelocityX, VelocityY, VelocityZ,
+        ColorR, ColorG, ColorB, ColorA,
+        Age, Lifetime, Rotation, Spin, Size, Drag
+    };
+
+    using FParticleColumns = TSoAArray<float32, float32, float32, float32, float32, float32, float32, float32, float32, float32,
+        float32, float32, float32, float32, float32, float32>;
+
+    constexpr float32 DeltaTime = 1.0f / 60.0f;
+
+    // Touches every member, the pass where the struct layout loses the least
+    void UpdateParticle(FSoAParticle& Particle)
+    {
+        const float32 Damping = 1.0f - Particle.Drag * DeltaTime;
+        Particle.VelocityX *= Damping;
+        Particle.VelocityY = Particle.VelocityY * Damping - 9.8f * DeltaTime;
+        Particle.VelocityZ *= Damping;
+        Particle.PositionX += Particle.VelocityX * DeltaTime;
+        Particle.PositionY += Particle.VelocityY * DeltaTime;
+        Particle.PositionZ += Particle.VelocityZ * DeltaTime;
+        Particle.Age += DeltaTime;
+        Particle.Rotation += Particle.Spin * DeltaTime;
+        const float32 Fade = 1.0f - Particle.Age / Particle.Lifetime;
+        Particle.ColorR *= Fade;
+        Particle.ColorG *= Fade;
+        Particle.ColorB *= Fade;
+        Particle.ColorA = Fade;
+        Particle.Size += DeltaTime;
+    }
+}
+
+TEST_CASE("TSoAArray::Rows", "[SoAArray]")
+{
+    TSoAArray<FVector3, int32, std::string> Array;
+    REQUIRE(Array.IsEmpty());
+    REQUIRE(Array.GetNumFields() == 3);
+
+    for (int32 Index = 0; Index < 100; ++Index)
+    {
+        auto [Position, Id, Name] = Array.EmplaceBack(FVector3(static_cast<float32>(Index)), Index, std::to_string(Index));
+        REQUIRE(Id == Index);
+        Name += "!";
+    }
+    REQUIRE(Array.Num() == 100);
+    REQUIRE(Array.GetCapacity() >= 100);
+
+    auto [Position, Id, Name] = Array[42];
+    REQUIRE(Position.X == 42.0f);
+    REQUIRE(Id == 42);
+    REQUIRE(Name == "42!");
+    Id = 1042;
+    REQUIRE(Array.Get<1>(42) == 1042);
+    REQUIRE(std::get<2>(Array[99]) == "99!");
+
+    // Every column is contiguous and starts on a cache line
+    REQUIRE(Array.GetColumn<0>().size() == 100);
+    REQUIRE(reinterpret_cast<uintptr_t>(Array.GetColumn<0>().data()) % 64 == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(Array.GetColumn<1>().data()) % 64 == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(Array.GetColumn<2>().data()) % 64 == 0);
+    REQUIRE(&Array.GetColumn<1>()[1] == &Array.Get<1>(0) + 1);
+
+    int32 Expected = 0;
+    for (const auto [RowPosition, RowId, RowName] : static_cast<const decltype(Array)&>(Array))
+    {
+        REQUIRE(RowPosition.Y == static_cast<float32>(Expected));
+        REQUIRE(RowName == std::to_string(Expected) + "!");
+        ++Expected;
+    }
+    REQUIRE(Expected == 100);
+
+    // The last row fills the hole in every column
+    Array.RemoveAtSwap(10);
+    REQUIRE(Array.Num() == 99);
+    REQUIRE(Array.Get<1>(10) == 99);
+    REQUIRE(Array.Get<2>(10) == "99!");
+    REQUIRE(Array.Get<0>(10).Z == 99.0f);
+    Array.RemoveAtSwap(98);
+    REQUIRE(Array.Num() == 98);
+    REQUIRE(Array.Get<1>(97) == 97);
+
+    Array.PopBack();
+    Array.Resize(200);
+    REQUIRE(Array.Get<1>(199) == 0);
+    REQUIRE(Array.Get<2>(199).empty());
+    Array.Resize(5);
+    REQUIRE(Array.Num() == 5);
+    Array.Clear();
+    REQUIRE(Array.IsEmpty());
+}
+
+TEST_CASE("TSoAArray::EmplaceOwnRow", "[SoAArray]")
+{
+    // Long enough to live on the heap, a dangling reference reads freed memory
+    TSoAArray<int32, std::string> Array;
+    Array.EmplaceBack(1, std::string(64, 'A'));
+    while (Array.Num() < Array.GetCapacity())
+    {
+        Array.EmplaceBack(2, std::string(64, 'B'));
+    }
+
+    // The row is copied from the block the array grows out of
+    Array.EmplaceBack(Array.Get<0>(0), Array.Get<1>(0));
+    REQUIRE(Array.GetCapacity() > Array.Num());
+    REQUIRE(Array.Get<0>(Array.Num() - 1) == 1);
+    REQUIRE(Array.Get<1>(Array.Num() - 1) == std::string(64, 'A'));
+    REQUIRE(Array.Get<1>(0) == std::string(64, 'A'));
+}
+
+TEST_CASE("TSoAArray::ColumnLayout", "[SoAArray]")
+{
+    // Columns a whole number of pages long still start at different offsets within a page
+    FParticleColumns Columns;
+    Columns.Resize(4096);
+    TArray<uintptr_t> PageOffsets;
+    const auto AddPageOffset = [&PageOffsets](const float32* Column)
+    {
+        const uintptr_t PageOffset = reinterpret_cast<uintptr_t>(Column) % 4096;
+        for (const uintptr_t Other : PageOffsets)
+        {
+            REQUIRE(Other != PageOffset);
+        }
+        PageOffsets.PushBack(PageOffset);
+    };
+    AddPageOffset(Columns.GetColumn<PositionX>().data());
+    AddPageOffset(Columns.GetColumn<PositionY>().data());
+    AddPageOffset(Columns.GetColumn<VelocityZ>().data());
+    AddPageOffset(Columns.GetColumn<Age>().data());
+    AddPageOffset(Columns.GetColumn<Drag>().data());
+    REQUIRE(Columns.GetColumn<Drag>().size() == 4096);
+}
+
+TEST_CASE("TSoAArray::Lifetime", "[SoAArray]")
+{
+    {
+        TSoAArray<FSoATracked, uint8, FSoATracked> Array;
+        for (int32 Index = 0; Index < 50; ++Index)
+        {
+            Array.EmplaceBack(Index, static_cast<uint8>(Index), -Index);
+        }
+        REQUIRE(FSoATracked::NumAlive == 100);
+
+        TSoAArray<FSoATracked, uint8, FSoATracked> Copy(Array);
+        REQUIRE(FSoATracked::NumAlive == 200);
+        REQUIRE(Copy.Get<2>(49).Value == -49);
+
+        Array.RemoveAtSwap(0);
+        REQUIRE(FSoATracked::NumAlive == 198);
+        REQUIRE(Array.Get<0>(0).Value == 49);
+
+        TSoAArray<FSoATracked, uint8, FSoATracked> Moved(std::move(Copy));
+        REQUIRE(Copy.IsEmpty());
+        REQUIRE(FSoATracked::NumAlive == 198);
+        Array = Moved;
+        REQUIRE(FSoATracked::NumAlive == 200);
+        REQUIRE(Array.Get<1>(7) == 7);
+        Moved = std::move(Array);
+        REQUIRE(FSoATracked::NumAlive == 100);
+
+        TSoAArray<FSoATracked, uint8, FSoATracked> Empty;
+        TSoAArray<FSoATracked, uint8, FSoATracked> EmptyCopy(Empty);
+        REQUIRE(EmptyCopy.IsEmpty());
+    }
+    REQUIRE(FSoATracked::NumAlive == 0);
+}
+
+TEST_CASE("TSoAArray::Benchmark", "[SoAArray][.benchmark]")
+{
+    static constexpr size64 NumParticles = 1 << 20;
+
+    TArray<FSoAParticle> Structs;
+    FParticleColumns Columns;
+    Structs.Reserve(NumParticles);
+    Columns.Reserve(NumParticles);
+    for (size64 Index = 0; Index < NumParticles; ++Index)
+    {
+        const float32 Value = static_cast<float32>(Index % 100);
+        const FSoAParticle Particle{Value, Value, Value, 1, 2, 3, 1, 1, 1, 1, 0, 5 + Value, 0, 0.5f, 1, 0.1f};
+        Structs.PushBack(Particle);
+        Columns.EmplaceBack(Particle.PositionX, Particle.PositionY, Particle.PositionZ, Particle.VelocityX, Particle.VelocityY, Particle.VelocityZ,
+            Particle.ColorR, Particle.ColorG, Particle.ColorB, Particle.ColorA, Particle.Age, Particle.Lifetime, Particle.Rotation, Particle.Spin,
+            Particle.Size, Particle.Drag);
+    }
+
+    // One field out of sixteen, the struct layout reads 64 bytes for every 4 it uses
+    BENCHMARK("Age_TArrayStruct")
+    {
+        for (FSoAParticle& Particle : Structs)
+        {
+            Particle.Age += DeltaTime;
+        }
+        return Structs[0].Age;
+    };
+
+    BENCHMARK("Age_TSoAArray")
+    {
+        for (float32& ParticleAge : Columns.GetColumn<Age>())
+        {
+            ParticleAge += DeltaTime;
+        }
+        return Columns.Get<Age>(0);
+    };
+
+    BENCHMARK("All_TArrayStruct")
+    {
+        for (FSoAParticle& Particle : Structs)
+        {
+            UpdateParticle(Particle);
+        }
+        return Structs[0].PositionY;
+    };
+
+    BENCHMARK("All_TSoAArray")
+    {
+        const std::span<float32> PX = Columns.GetColumn<PositionX>(), PY = Columns.GetColumn<PositionY>(), PZ = Columns.GetColumn<PositionZ>();
+        const std::span<float32> VX = Columns.GetColumn<VelocityX>(), VY = Columns.GetColumn<VelocityY>(), VZ = Columns.GetColumn<VelocityZ>();
+        const std::span<float32> R = Columns.GetColumn<ColorR>(), G = Columns.GetColumn<ColorG>(), B = Columns.GetColumn<ColorB>();
+        const std::span<float32> A = Columns.GetColumn<ColorA>(), Ages = Columns.GetColumn<Age>(), Lifetimes = Columns.GetColumn<Lifetime>();
+        const std::span<float32> Rotations = Columns.GetColumn<Rotation>(), Spins = Columns.GetColumn<Spin>();
+        const std::span<float32> Sizes = Columns.GetColumn<Size>(), Drags = Columns.GetColumn<Drag>();
+        // Loaded into locals first, the columns could alias as far as the compiler knows
+        for (size64 Index = 0; Index < NumParticles; ++Index)
+        {
+            const float32 Damping = 1.0f - Drags[Index] * DeltaTime;
+            const float32 NewVX = VX[Index] * Damping;
+            const float32 NewVY = VY[Index] * Damping - 9.8f * DeltaTime;
+            const float32 NewVZ = VZ[Index] * Damping;
+            const float32 NewAge = Ages[Index] + DeltaTime;
+            const float32 Fade = 1.0f - NewAge / Lifetimes[Index];
+            const float32 NewRotation = Rotations[Index] + Spins[Index] * DeltaTime;
+            const float32 NewR = R[Index] * Fade;
+            const float32 NewG = G[Index] * Fade;
+            const float32 NewB = B[Index] * Fade;
+            const float32 NewPX = PX[Index] + NewVX * DeltaTime;
+            const float32 NewPY = PY[Index] + NewVY * DeltaTime;
+            const float32 NewPZ = PZ[Index] + NewVZ * DeltaTime;
+            const float32 NewSize = Sizes[Index] + DeltaTime;
+            VX[Index] = NewVX;
+            VY[Index] = NewVY;
+            VZ[Index] = NewVZ;
+            PX[Index] = NewPX;
+            PY[Index] = NewPY;
+            PZ[Index] = NewPZ;
+            Ages[Index] = NewAge;
+            Rotations[Index] = NewRotation;
+            R[Index] = NewR;
+            G[Index] = NewG;
+            B[Index] = NewB;
+            A[Index] = Fade;
+            Sizes[Index] = NewSize;
+        }
+        return PY[0];
+    };
+
+    // Row access through the tuple proxy, for code that is not written against the columns
+    BENCHMARK("Position_TSoARows")
+    {
+        for (auto&& Row : Columns)
+        {
+            std::get<PositionX>(Row) += std::get<VelocityX>(Row) * DeltaTime;
+        }
+        return Columns.Get<PositionX>(0);
+    };
+
+    BENCHMARK("Position_TArrayStruct")
+    {
+        for (FSoAParticle& Particle : Structs)
+        {
+            Particle.PositionX += Particle.VelocityX * DeltaTime;
+        }
+        return Structs[0].PositionX;
+    };
+}
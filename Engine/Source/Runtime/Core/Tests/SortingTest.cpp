@@ -0,0 +1,280 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Sorting.hpp"
+#include "Core/Containers/StaticArray.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+struct FSortKey
+{
+    uint32 Key;
+    uint32 Payload;
+};
+
+static TArray<int32> MakeRandomArray(const size64 Count, const uint32 Seed = 1337)
+{
+    std::mt19937 Generator(Seed);
+    std::uniform_int_distribution<int32> Distribution(-100000, 100000);
+    TArray<int32> Array;
+    Array.Reserve(Count);
+    for (size64 Index = 0; Index < Count; ++Index)
+    {
+        Array.PushBack(Distribution(Generator));
+    }
+    return Array;
+}
+
+TEST_CASE("Ranges::Sort", "[Sorting]")
+{
+    SECTION("EmptyAndSingle")
+    {
+        TArray<int32> Empty;
+        Ranges::Sort(Empty);
+        REQUIRE(Empty.IsEmpty());
+
+        TArray<int32> Single{42};
+        Ranges::Sort(Single);
+        REQUIRE(Single[0] == 42);
+    }
+
+    SECTION("RandomData")
+    {
+        TArray<int32> Array = MakeRandomArray(10000);
+        Ranges::Sort(Array);
+        REQUIRE(Ranges::IsSorted(Array));
+    }
+
+    SECTION("ManyDuplicates")
+    {
+        TArray<int32> Array;
+        for (int32 Index = 0; Index < 5000; ++Index)
+        {
+            Array.PushBack(Index % 3);
+        }
+        Ranges::Sort(Array);
+        REQUIRE(Ranges::IsSorted(Array));
+        REQUIRE(Array.GetFirst() == 0);
+        REQUIRE(Array.GetLast() == 2);
+    }
+
+    SECTION("AlreadySortedAndReversed")
+    {
+        TArray<int32> Ascending;
+        TArray<int32> Descending;
+        for (int32 Index = 0; Index < 4096; ++Index)
+        {
+            Ascending.PushBack(Index);
+            Descending.PushBack(4096 - Index);
+        }
+        Ranges::Sort(Ascending);
+        Ranges::Sort(Descending);
+        REQUIRE(Ranges::IsSorted(Ascending));
+        REQUIRE(Ranges::IsSorted(Descending));
+    }
+
+    SECTION("CustomComparer")
+    {
+        TArray<int32> Array = MakeRandomArray(1000);
+        Ranges::Sort(Array, std::greater<>());
+        REQUIRE(Ranges::IsSorted(Array, std::greater<>()));
+    }
+
+    SECTION("StaticArray")
+    {
+        TStaticArray<float32, 5> Array{3.0f, 1.0f, 4.0f, 1.5f, -2.0f};
+        Ranges::Sort(Array);
+        REQUIRE(Array[0] == -2.0f);
+        REQUIRE(Array[4] == 4.0f);
+    }
+
+    SECTION("NonTrivialType")
+    {
+        TArray<std::string> Array{"delta", "alpha", "charlie", "bravo"};
+        Ranges::Sort(Array);
+        REQUIRE(Array[0] == "alpha");
+        REQUIRE(Array[3] == "delta");
+    }
+}
+
+TEST_CASE("Ranges::StableSort", "[Sorting]")
+{
+    TArray<FSortKey> Array;
+    for (uint32 Index = 0; Index < 1000; ++Index)
+    {
+        Array.PushBack(FSortKey{.Key = (Index * 7919) % 10, .Payload = Index});
+    }
+
+    Ranges::StableSort(Array, [](const FSortKey& A, const FSortKey& B) { return A.Key < B.Key; });
+
+    for (size64 Index = 1; Index < Array.Num(); ++Index)
+    {
+        REQUIRE(Array[Index - 1].Key <= Array[Index].Key);
+        if (Array[Index - 1].Key == Array[Index].Key)
+        {
+            REQUIRE(Array[Index - 1].Payload < Array[Index].Payload);
+        }
+    }
+}
+
+TEST_CASE("Ranges::RadixSort", "[Sorting]")
+{
+    SECTION("SignedIntegers")
+    {
+        TArray<int32> Array = MakeRandomArray(10000);
+        TArray<int32> Expected = Array;
+        std::sort(Expected.begin(), Expected.end());
+
+        Ranges::RadixSort(Array);
+
+        REQUIRE(Array == Expected);
+    }
+
+    SECTION("UnsignedSmallRange")
+    {
+        TArray<uint64> Array;
+        for (uint64 Index = 0; Index < 1000; ++Index)
+        {
+            Array.PushBack((Index * 31) % 200);
+        }
+        Ranges::RadixSort(Array);
+        REQUIRE(Ranges::IsSorted(Array));
+    }
+
+    SECTION("Floats")
+    {
+        TArray<float32> Array{3.5f, -1.0f, 0.0f, -0.5f, 100.0f, -100.0f, 2.25f, 1.0f, -3.75f, 7.0f,
+                              0.125f, -8.0f, 9.5f, -0.25f, 4.0f, 11.0f, -12.5f, 6.0f, 5.5f, -7.0f};
+        Ranges::RadixSort(Array);
+        REQUIRE(Ranges::IsSorted(Array));
+        REQUIRE(Array.GetFirst() == -100.0f);
+        REQUIRE(Array.GetLast() == 100.0f);
+    }
+
+    SECTION("ProjectionIsStable")
+    {
+        TArray<FSortKey> Array;
+        for (uint32 Index = 0; Index < 5000; ++Index)
+        {
+            Array.PushBack(FSortKey{.Key = (Index * 7919) % 97, .Payload = Index});
+        }
+
+        Ranges::RadixSort(Array, [](const FSortKey& Element) { return Element.Key; });
+
+        for (size64 Index = 1; Index < Array.Num(); ++Index)
+        {
+            REQUIRE(Array[Index - 1].Key <= Array[Index].Key);
+            if (Array[Index - 1].Key == Array[Index].Key)
+            {
+                REQUIRE(Array[Index - 1].Payload < Array[Index].Payload);
+            }
+        }
+    }
+}
+
+TEST_CASE("Ranges::BinarySearch", "[Sorting]")
+{
+    const TArray<int32> Array{1, 3, 3, 3, 5, 8, 13};
+
+    REQUIRE(Ranges::LowerBound(Array, 3) == 1);
+    REQUIRE(Ranges::UpperBound(Array, 3) == 4);
+    REQUIRE(Ranges::LowerBound(Array, 0) == 0);
+    REQUIRE(Ranges::LowerBound(Array, 100) == Array.Num());
+    REQUIRE(Ranges::UpperBound(Array, 13) == Array.Num());
+
+    REQUIRE(Ranges::BinarySearch(Array, 8) == 5);
+    REQUIRE(Ranges::BinarySearch(Array, 1) == 0);
+    REQUIRE(Ranges::BinarySearch(Array, 4) == static_cast<size64>(-1));
+    REQUIRE(Ranges::BinarySearch(Array, 14) == static_cast<size64>(-1));
+
+    const TArray<int32> Empty;
+    REQUIRE(Ranges::BinarySearch(Empty, 1) == static_cast<size64>(-1));
+}
+
+TEST_CASE("Ranges::BenchmarkSort", "[Sorting][.benchmark]")
+{
+    const TArray<int32> Source = MakeRandomArray(1000000);
+
+    BENCHMARK("StdSort")
+    {
+        TArray<int32> Array = Source;
+        std::sort(Array.begin(), Array.end());
+        return Array.GetFirst();
+    };
+
+    BENCHMARK("Sort")
+    {
+        TArray<int32> Array = Source;
+        Ranges::Sort(Array);
+        return Array.GetFirst();
+    };
+
+    BENCHMARK("StableSort")
+    {
+        TArray<int32> Array = Source;
+        Ranges::StableSort(Array);
+        return Array.GetFirst();
+    };
+
+    BENCHMARK("RadixSort")
+    {
+        TArray<int32> Array = Source;
+        Ranges::RadixSort(Array);
+        return Array.GetFirst();
+    };
+}
+
+TEST_CASE("Ranges::BenchmarkSortKeys", "[Sorting][.benchmark]")
+{
+    std::mt19937 Generator(42);
+    TArray<FSortKey> Source;
+    Source.Reserve(1000000);
+    for (uint32 Index = 0; Index < 1000000; ++Index)
+    {
+        Source.PushBack(FSortKey{.Key = static_cast<uint32>(Generator()), .Payload = Index});
+    }
+
+    BENCHMARK("SortByKey")
+    {
+        TArray<FSortKey> Array = Source;
+        Ranges::Sort(Array, [](const FSortKey& A, const FSortKey& B) { return A.Key < B.Key; });
+        return Array.GetFirst().Key;
+    };
+
+    BENCHMARK("RadixSortByKey")
+    {
+        TArray<FSortKey> Array = Source;
+        Ranges::RadixSort(Array, [](const FSortKey& Element) { return Element.Key; });
+        return Array.GetFirst().Key;
+    };
+}
+
+TEST_CASE("Ranges::BenchmarkBinarySearch", "[Sorting][.benchmark]")
+{
+    TArray<int32> Array = MakeRandomArray(1000000);
+    Ranges::Sort(Array);
+    const TArray<int32> Queries = MakeRandomArray(1000, 7);
+
+    BENCHMARK("LinearFind")
+    {
+        size64 Found = 0;
+        for (const int32 Query : Queries)
+        {
+            Found += Ranges::Find(Array, Query) != static_cast<size64>(-1);
+        }
+        return Found;
+    };
+
+    BENCHMARK("BinarySearch")
+    {
+        size64 Found = 0;
+        for (const int32 Query : Queries)
+        {
+            Found += Ranges::BinarySearch(Array, Query) != static_cast<size64>(-1);
+        }
+        return Found;
+    };
+}
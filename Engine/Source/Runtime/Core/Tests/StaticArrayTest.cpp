@@ -1,5 +1,6 @@
 // RavenStorm Copyright @ 2025-2025
 
+#include <string>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include "Core/Containers/StaticArray.hpp"
@@ -386,6 +387,19 @@ TEST_CASE("TStaticArray::CustomStructType", "[StaticArray]")
     }
 }
 
+TEST_CASE("TStaticArray::NonTrivialElements", "[StaticArray]")
+{
+    TStaticArray<std::string, 3> Array{"alpha", std::string(64, 'b'), "gamma"};
+    TStaticArray<std::string, 3> Copy(Array);
+    Array[1] = "beta";
+
+    REQUIRE(Copy[1] == std::string(64, 'b'));
+    REQUIRE(Array[1] == "beta");
+
+    Copy = Array;
+    REQUIRE(Copy == Array);
+}
+
 TEST_CASE("TStaticArray::ConstexprSupport", "[StaticArray]")
 {
     constexpr TStaticArray<int32, 3> ConstexprArray{10, 20, 30};
@@ -0,0 +1,295 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "Core/Containers/Ranges.hpp"
+#include "Core/Containers/StaticArray.hpp"
+#include "Core/Containers/StaticMap.hpp"
+
+namespace
+{
+    enum class EStaticMapColor : uint8
+    {
+        Red,
+        Green,
+        Blue,
+        Alpha,
+        Unnamed
+    };
+
+    constexpr auto ColorNames = MakeStaticMap<EStaticMapColor, std::string_view>({
+        {EStaticMapColor::Red, "Red"},
+        {EStaticMapColor::Green, "Green"},
+        {EStaticMapColor::Blue, "Blue"},
+        {EStaticMapColor::Alpha, "Alpha"},
+    });
+
+    // Console command style names, "cmd.0" to "cmd.N", stored in a constant so that string views can point at them
+    template <size64 NumNames>
+    struct TCommandNames
+    {
+        char Characters[NumNames][12] = {};
+        std::string_view Names[NumNames] = {};
+
+        constexpr TCommandNames()
+        {
+            for (size64 Index = 0; Index < NumNames; ++Index)
+            {
+                char* Name = Characters[Index];
+                size64 Length = 0;
+                for (const char Character : {'c', 'm', 'd', '.'})
+                {
+                    Name[Length++] = Character;
+                }
+                char Digits[8] = {};
+                size64 NumDigits = 0;
+                for (size64 Value = Index; NumDigits == 0 || Value > 0; Value /= 10)
+                {
+                    Digits[NumDigits++] = static_cast<char>('0' + Value % 10);
+                }
+                while (NumDigits > 0)
+                {
+                    Name[Length++] = Digits[--NumDigits];
+                }
+                Names[Index] = std::string_view(Name, Length);
+            }
+        }
+    };
+
+    constexpr TCommandNames<16> CommandNames16;
+    constexpr TCommandNames<256> CommandNames256;
+
+    template <size64 NumNames>
+    consteval TStaticMap<std::string_view, int32, NumNames> MakeCommandMap(const TCommandNames<NumNames>& Commands)
+    {
+        std::pair<std::string_view, int32> Entries[NumNames] = {};
+        for (size64 Index = 0; Index < NumNames; ++Index)
+        {
+            Entries[Index] = {Commands.Names[Index], static_cast<int32>(Index)};
+        }
+        return TStaticMap<std::string_view, int32, NumNames>(Entries);
+    }
+
+    constexpr auto CommandMap16 = MakeCommandMap(CommandNames16);
+    constexpr auto CommandMap256 = MakeCommandMap(CommandNames256);
+
+    consteval auto MakeIntegerMap()
+    {
+        std::pair<int64, int64> Entries[1000] = {};
+        for (int64 Index = 0; Index < 1000; ++Index)
+        {
+            Entries[Index] = {(Index + 1) * 7919, Index};
+        }
+        return TStaticMap<int64, int64, 1000>(Entries);
+    }
+
+    constexpr auto IntegerMap = MakeIntegerMap();
+
+    // Linear search over parallel key and value arrays, the usual hand written table
+    template <typename TKey, typename TValue, size64 NumElements>
+    struct TLinearTable
+    {
+        TStaticArray<TKey, NumElements> Keys;
+        TStaticArray<TValue, NumElements> Values;
+
+        const TValue* Find(const TKey& Key) const
+        {
+            const size64 Index = Ranges::Find(Keys, Key);
+            return Index != static_cast<size64>(-1) ? &Values[Index] : nullptr;
+        }
+    };
+}
+
+TEST_CASE("TStaticMap::EnumNames", "[StaticMap]")
+{
+    static_assert(ColorNames.Num() == 4);
+    static_assert(*ColorNames.Find(EStaticMapColor::Green) == "Green");
+    static_assert(ColorNames[EStaticMapColor::Alpha] == "Alpha");
+    static_assert(!ColorNames.Contains(EStaticMapColor::Unnamed));
+
+    REQUIRE(*ColorNames.Find(EStaticMapColor::Red) == "Red");
+    REQUIRE(ColorNames[EStaticMapColor::Blue] == "Blue");
+    REQUIRE(ColorNames.Find(EStaticMapColor::Unnamed) == nullptr);
+}
+
+TEST_CASE("TStaticMap::StringKeys", "[StaticMap]")
+{
+    static_assert(CommandMap256[CommandNames256.Names[200]] == 200);
+    REQUIRE(CommandMap256.GetSlotCount() == 512);
+
+    for (size64 Index = 0; Index < 256; ++Index)
+    {
+        // Looked up through a copy, so nothing can match by address
+        const std::string Name(CommandNames256.Names[Index]);
+        const int32* Value = CommandMap256.Find(Name);
+        REQUIRE(Value != nullptr);
+        REQUIRE(*Value == static_cast<int32>(Index));
+    }
+    for (const std::string_view Missing : {"", "cmd.", "cmd.256", "cmd.1000", "cmd.00", "dmc.1", "cmd.12 "})
+    {
+        REQUIRE(CommandMap256.Find(Missing) == nullptr);
+        REQUIRE_FALSE(CommandMap16.Contains(Missing));
+    }
+    REQUIRE(CommandMap16["cmd.15"] == 15);
+    REQUIRE_FALSE(CommandMap16.Contains("cmd.16"));
+}
+
+TEST_CASE("TStaticMap::IntegerKeys", "[StaticMap]")
+{
+    static_assert(IntegerMap[7919 * 500] == 499);
+
+    for (int64 Index = 0; Index < 1000; ++Index)
+    {
+        const int64* Value = IntegerMap.Find((Index + 1) * 7919);
+        REQUIRE(Value != nullptr);
+        REQUIRE(*Value == Index);
+    }
+    // Also covers the default key 0, which fills no slot, and keys off by one from stored ones
+    for (int64 Key = 0; Key < 100000; ++Key)
+    {
+        REQUIRE(IntegerMap.Contains(Key) == (Key > 0 && Key % 7919 == 0));
+    }
+
+    constexpr auto Single = MakeStaticMap<int32, int32>({{5, 50}});
+    static_assert(Single[5] == 50);
+    static_assert(!Single.Contains(0));
+    static_assert(!Single.Contains(6));
+}
+
+TEST_CASE("TStaticMap::Benchmark", "[StaticMap][.benchmark]")
+{
+    static constexpr size64 NumQueries = 4096;
+
+    std::mt19937 Random(11);
+    TArray<std::string_view> Queries16;
+    TArray<std::string_view> Queries256;
+    for (size64 Index = 0; Index < NumQueries; ++Index)
+    {
+        Queries16.PushBack(CommandNames16.Names[Random() % 16]);
+        Queries256.PushBack(CommandNames256.Names[Random() % 256]);
+    }
+
+    TMap<std::string_view, int32> Map16;
+    TMap<std::string_view, int32> Map256;
+    TLinearTable<std::string_view, int32, 16> Linear16;
+    TLinearTable<std::string_view, int32, 256> Linear256;
+    for (size64 Index = 0; Index < 256; ++Index)
+    {
+        Map256[CommandNames256.Names[Index]] = static_cast<int32>(Index);
+        Linear256.Keys[Index] = CommandNames256.Names[Index];
+        Linear256.Values[Index] = static_cast<int32>(Index);
+        if (Index < 16)
+        {
+            Map16[CommandNames16.Names[Index]] = static_cast<int32>(Index);
+            Linear16.Keys[Index] = CommandNames16.Names[Index];
+            Linear16.Values[Index] = static_cast<int32>(Index);
+        }
+    }
+
+    BENCHMARK("Find_TStaticMap_16Strings")
+    {
+        int64 Sum = 0;
+        for (const std::string_view Query : Queries16)
+        {
+            Sum += *CommandMap16.Find(Query);
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Find_TMap_16Strings")
+    {
+        int64 Sum = 0;
+        for (const std::string_view Query : Queries16)
+        {
+            Sum += Map16.Find(Query)->second;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Find_Linear_16Strings")
+    {
+        int64 Sum = 0;
+        for (const std::string_view Query : Queries16)
+        {
+            Sum += *Linear16.Find(Query);
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Find_TStaticMap_256Strings")
+    {
+        int64 Sum = 0;
+        for (const std::string_view Query : Queries256)
+        {
+            Sum += *CommandMap256.Find(Query);
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Find_TMap_256Strings")
+    {
+        int64 Sum = 0;
+        for (const std::string_view Query : Queries256)
+        {
+            Sum += Map256.Find(Query)->second;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Find_Linear_256Strings")
+    {
+        int64 Sum = 0;
+        for (const std::string_view Query : Queries256)
+        {
+            Sum += *Linear256.Find(Query);
+        }
+        return Sum;
+    };
+
+    // Enum keys, where the linear search is vectorized
+    TArray<EStaticMapColor> ColorQueries;
+    for (size64 Index = 0; Index < NumQueries; ++Index)
+    {
+        ColorQueries.PushBack(static_cast<EStaticMapColor>(Random() % 4));
+    }
+    const TMap<EStaticMapColor, std::string_view> ColorMap{{EStaticMapColor::Red, "Red"}, {EStaticMapColor::Green, "Green"},
+        {EStaticMapColor::Blue, "Blue"}, {EStaticMapColor::Alpha, "Alpha"}};
+    const TLinearTable<EStaticMapColor, std::string_view, 4> ColorLinear{
+        TStaticArray<EStaticMapColor, 4>{EStaticMapColor::Red, EStaticMapColor::Green, EStaticMapColor::Blue, EStaticMapColor::Alpha},
+        TStaticArray<std::string_view, 4>{"Red", "Green", "Blue", "Alpha"}};
+
+    BENCHMARK("Find_TStaticMap_4Enums")
+    {
+        size64 Length = 0;
+        for (const EStaticMapColor Query : ColorQueries)
+        {
+            Length += ColorNames.Find(Query)->size();
+        }
+        return Length;
+    };
+
+    BENCHMARK("Find_TMap_4Enums")
+    {
+        size64 Length = 0;
+        for (const EStaticMapColor Query : ColorQueries)
+        {
+            Length += ColorMap.Find(Query)->second.size();
+        }
+        return Length;
+    };
+
+    BENCHMARK("Find_Linear_4Enums")
+    {
+        size64 Length = 0;
+        for (const EStaticMapColor Query : ColorQueries)
+        {
+            Length += ColorLinear.Find(Query)->size();
+        }
+        return Length;
+    };
+}
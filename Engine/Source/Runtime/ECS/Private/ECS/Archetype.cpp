@@ -0,0 +1,311 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "ECS/Archetype.hpp"
+
+#include "Core/Memory/Memory.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    [[nodiscard]] constexpr size64 AlignOffset(const size64 Offset, const size64 Alignment)
+    {
+        return (Offset + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    void RelocateComponents(const FComponentTypeInfo& TypeInfo, void* Target, void* Source, const size64 Count)
+    {
+        if (TypeInfo.Relocate != nullptr)
+        {
+            TypeInfo.Relocate(Target, Source, Count);
+        }
+        else
+        {
+            FMemory::Copy(Source, Target, static_cast<size64>(TypeInfo.Size) * Count);
+        }
+    }
+}
+
+FArchetype::FArchetype(const FComponentSignature& InSignature)
+    : Signature(InSignature), Columns(MakeColumns(InSignature))
+{
+    ChunkCapacity = ComputeLayout(Columns, ChunkVersionOffset);
+    assert(ChunkCapacity > 0 && "Components of the archetype do not fit into a single chunk");
+}
+
+FArchetype::~FArchetype()
+{
+    for (uint32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        FArchetypeChunk& Chunk = Chunks[ChunkIndex];
+        for (uint32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex)
+        {
+            if (Columns[ColumnIndex].TypeInfo.Destroy != nullptr)
+            {
+                Columns[ColumnIndex].TypeInfo.Destroy(GetColumnData(ChunkIndex, ColumnIndex), Chunk.NumEntities);
+            }
+        }
+        FMemory::Free(Chunk.Data, ArchetypeChunkAlignment);
+    }
+    if (SpareChunkData != nullptr)
+    {
+        FMemory::Free(SpareChunkData, ArchetypeChunkAlignment);
+    }
+}
+
+FEntityLocation FArchetype::AllocateRow(const FEntity Entity)
+{
+    if (Chunks.IsEmpty() || Chunks.GetLast().NumEntities == ChunkCapacity)
+    {
+        uint8* Data = SpareChunkData;
+        SpareChunkData = nullptr;
+        if (Data == nullptr)
+        {
+            Data = static_cast<uint8*>(FMemory::Allocate(ArchetypeChunkSize, ArchetypeChunkAlignment));
+        }
+        Chunks.PushBack(FArchetypeChunk{.Data = Data, .NumEntities = 0});
+        FMemory::Set(GetChunkVersions(static_cast<uint32>(Chunks.Num() - 1)), 0, sizeof(uint32) * 2 * Columns.Num());
+    }
+
+    const uint32 ChunkIndex = static_cast<uint32>(Chunks.Num() - 1);
+    FArchetypeChunk& Chunk = Chunks[ChunkIndex];
+    const FEntityLocation Location{.ChunkIndex = ChunkIndex, .Row = Chunk.NumEntities};
+    GetEntities(ChunkIndex)[Location.Row] = Entity;
+    for (uint32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex)
+    {
+        if (uint32* Versions = GetRowVersions(ChunkIndex, ColumnIndex))
+        {
+            Versions[Location.Row] = 0;
+            Versions[ChunkCapacity + Location.Row] = 0;
+        }
+    }
+    ++Chunk.NumEntities;
+    ++NumEntities;
+    return Location;
+}
+
+void FArchetype::DestroyRow(const FEntityLocation& Location)
+{
+    for (uint32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex)
+    {
+        if (Columns[ColumnIndex].TypeInfo.Destroy != nullptr)
+        {
+            Columns[ColumnIndex].TypeInfo.Destroy(GetComponentData(Location, ColumnIndex), 1);
+        }
+    }
+}
+
+FEntity FArchetype::RemoveRow(const FEntityLocation& Location)
+{
+    assert(Location.ChunkIndex < Chunks.Num() && Location.Row < Chunks[Location.ChunkIndex].NumEntities && "Row out of range");
+
+    const uint32 LastChunkIndex = static_cast<uint32>(Chunks.Num() - 1);
+    FArchetypeChunk& LastChunk = Chunks[LastChunkIndex];
+    const FEntityLocation LastLocation{.ChunkIndex = LastChunkIndex, .Row = LastChunk.NumEntities - 1};
+
+    FEntity MovedEntity;
+    if (Location.ChunkIndex != LastLocation.ChunkIndex || Location.Row != LastLocation.Row)
+    {
+        for (uint32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex)
+        {
+            RelocateComponents(Columns[ColumnIndex].TypeInfo, GetComponentData(Location, ColumnIndex), GetComponentData(LastLocation, ColumnIndex), 1);
+            SetRowVersions(Location, ColumnIndex, GetRowChangedVersion(LastLocation, ColumnIndex), GetRowAddedVersion(LastLocation, ColumnIndex));
+        }
+        MovedEntity = GetEntities(LastChunkIndex)[LastLocation.Row];
+        GetEntities(Location.ChunkIndex)[Location.Row] = MovedEntity;
+    }
+
+    --LastChunk.NumEntities;
+    --NumEntities;
+    if (LastChunk.NumEntities == 0)
+    {
+        if (SpareChunkData != nullptr)
+        {
+            FMemory::Free(SpareChunkData, ArchetypeChunkAlignment);
+        }
+        SpareChunkData = LastChunk.Data;
+        Chunks.PopBack();
+    }
+    return MovedEntity;
+}
+
+void FArchetype::Clear()
+{
+    for (uint32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        for (uint32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex)
+        {
+            if (Columns[ColumnIndex].TypeInfo.Destroy != nullptr)
+            {
+                Columns[ColumnIndex].TypeInfo.Destroy(GetColumnData(ChunkIndex, ColumnIndex), Chunks[ChunkIndex].NumEntities);
+            }
+        }
+        Chunks[ChunkIndex].NumEntities = 0;
+    }
+    ResizeForRestore(0);
+}
+
+void FArchetype::ResizeForRestore(const size64 InNumEntities)
+{
+    const size64 NumChunks = (InNumEntities + ChunkCapacity - 1) / ChunkCapacity;
+    while (Chunks.Num() > NumChunks)
+    {
+        if (SpareChunkData != nullptr)
+        {
+            FMemory::Free(SpareChunkData, ArchetypeChunkAlignment);
+        }
+        SpareChunkData = Chunks.GetLast().Data;
+        Chunks.PopBack();
+    }
+    while (Chunks.Num() < NumChunks)
+    {
+        uint8* Data = SpareChunkData;
+        SpareChunkData = nullptr;
+        if (Data == nullptr)
+        {
+            Data = static_cast<uint8*>(FMemory::Allocate(ArchetypeChunkSize, ArchetypeChunkAlignment));
+        }
+        Chunks.PushBack(FArchetypeChunk{.Data = Data, .NumEntities = 0});
+    }
+
+    size64 Remaining = InNumEntities;
+    for (FArchetypeChunk& Chunk : Chunks)
+    {
+        Chunk.NumEntities = static_cast<uint32>(Remaining < ChunkCapacity ? Remaining : ChunkCapacity);
+        Remaining -= Chunk.NumEntities;
+    }
+    NumEntities = InNumEntities;
+}
+
+bool8 FArchetype::IsTriviallyCopyable() const
+{
+    for (const FArchetypeColumn& Column : Columns)
+    {
+        if (Column.TypeInfo.Relocate != nullptr)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FArchetype::MarkChanged(const uint32 ChunkIndex, const uint32 ColumnIndex, const uint32 Tick)
+{
+    if (uint32* Versions = GetRowVersions(ChunkIndex, ColumnIndex))
+    {
+        const uint32 NumRows = Chunks[ChunkIndex].NumEntities;
+        for (uint32 Row = 0; Row < NumRows; ++Row)
+        {
+            Versions[Row] = Tick;
+        }
+    }
+    GetChunkVersions(ChunkIndex)[ColumnIndex] = Tick;
+}
+
+void FArchetype::SetRowVersions(const FEntityLocation& Location, const uint32 ColumnIndex, const uint32 ChangedTick, const uint32 AddedTick)
+{
+    if (uint32* Versions = GetRowVersions(Location.ChunkIndex, ColumnIndex))
+    {
+        Versions[Location.Row] = ChangedTick;
+        Versions[ChunkCapacity + Location.Row] = AddedTick;
+    }
+    uint32* ChunkVersions = GetChunkVersions(Location.ChunkIndex);
+    ChunkVersions[ColumnIndex] = std::max(ChunkVersions[ColumnIndex], ChangedTick);
+    ChunkVersions[Columns.Num() + ColumnIndex] = std::max(ChunkVersions[Columns.Num() + ColumnIndex], AddedTick);
+}
+
+uint32 FArchetype::FindColumn(const FComponentId ComponentId) const
+{
+    for (uint32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex)
+    {
+        if (Columns[ColumnIndex].ComponentId == ComponentId)
+        {
+            return ColumnIndex;
+        }
+    }
+    return InvalidColumn;
+}
+
+FArchetype* FArchetype::FindAddEdge(const FComponentId ComponentId) const
+{
+    const auto It = AddEdges.Find(ComponentId);
+    return It != AddEdges.end() ? It->second : nullptr;
+}
+
+FArchetype* FArchetype::FindRemoveEdge(const FComponentId ComponentId) const
+{
+    const auto It = RemoveEdges.Find(ComponentId);
+    return It != RemoveEdges.end() ? It->second : nullptr;
+}
+
+void FArchetype::SetAddEdge(const FComponentId ComponentId, FArchetype* Target)
+{
+    AddEdges[ComponentId] = Target;
+}
+
+void FArchetype::SetRemoveEdge(const FComponentId ComponentId, FArchetype* Target)
+{
+    RemoveEdges[ComponentId] = Target;
+}
+
+uint32 FArchetype::ComputeChunkCapacity(const FComponentSignature& InSignature)
+{
+    TArray<FArchetypeColumn> Columns = MakeColumns(InSignature);
+    uint32 ChunkVersionOffset = 0;
+    return ComputeLayout(Columns, ChunkVersionOffset);
+}
+
+TArray<FArchetypeColumn> FArchetype::MakeColumns(const FComponentSignature& InSignature)
+{
+    TArray<FArchetypeColumn> Columns;
+    Columns.Reserve(InSignature.Num());
+    InSignature.ForEach([&Columns](const FComponentId ComponentId)
+    {
+        Columns.PushBack(FArchetypeColumn{.ComponentId = ComponentId, .Offset = 0, .VersionOffset = 0, .TypeInfo = FComponentRegistry::GetTypeInfo(ComponentId)});
+    });
+    return Columns;
+}
+
+uint32 FArchetype::ComputeLayout(TArray<FArchetypeColumn>& InOutColumns, uint32& OutChunkVersionOffset)
+{
+    // Changed and added version of every row of a component tracking entities, of every column per chunk
+    static constexpr size64 VersionsSize = 2 * sizeof(uint32);
+
+    size64 BytesPerEntity = sizeof(FEntity);
+    for (const FArchetypeColumn& Column : InOutColumns)
+    {
+        assert(Column.TypeInfo.Alignment <= ArchetypeChunkAlignment && "Component alignment exceeds the chunk alignment");
+        BytesPerEntity += Column.TypeInfo.Size + (Column.TypeInfo.bEntityVersions ? VersionsSize : 0);
+    }
+    const size64 ChunkVersionsSize = VersionsSize * InOutColumns.Num();
+
+    // Start from the padding free estimate and shrink until the cache line aligned columns fit
+    size64 Capacity = (ArchetypeChunkSize - ChunkVersionsSize) / BytesPerEntity;
+    while (Capacity > 0)
+    {
+        size64 Offset = sizeof(FEntity) * Capacity;
+        for (FArchetypeColumn& Column : InOutColumns)
+        {
+            Offset = AlignOffset(Offset, ArchetypeChunkAlignment);
+            Column.Offset = static_cast<uint32>(Offset);
+            Offset += static_cast<size64>(Column.TypeInfo.Size) * Capacity;
+        }
+        Offset = AlignOffset(Offset, alignof(uint32));
+        for (FArchetypeColumn& Column : InOutColumns)
+        {
+            if (Column.TypeInfo.bEntityVersions)
+            {
+                Column.VersionOffset = static_cast<uint32>(Offset);
+                Offset += VersionsSize * Capacity;
+            }
+        }
+        OutChunkVersionOffset = static_cast<uint32>(Offset);
+        Offset += ChunkVersionsSize;
+        if (Offset <= ArchetypeChunkSize)
+        {
+            break;
+        }
+        --Capacity;
+    }
+    return static_cast<uint32>(Capacity);
+}
@@ -0,0 +1,96 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "ECS/CommandBuffer.hpp"
+
+#include "Core/Memory/Memory.hpp"
+
+FCommandBuffer::FCommandBuffer(const uint32 InBufferIndex)
+    : BufferIndex(InBufferIndex)
+{
+    assert(InBufferIndex < MaxCommandBufferThreads && "Command buffer index out of range");
+}
+
+FCommandBuffer::~FCommandBuffer()
+{
+    Clear();
+    for (const FBlock& Block : Blocks)
+    {
+        FMemory::Free(Block.Data, 64);
+    }
+}
+
+FEntity FCommandBuffer::CreateEntity(const uint32 SortKey)
+{
+    assert(NumCreatedEntities < DeferredEntityBit - 1 && "Too many entities created in one command buffer");
+    const FEntity Placeholder{.Index = DeferredEntityBit | NumCreatedEntities, .Generation = BufferIndex};
+    ++NumCreatedEntities;
+    AllocateCommand(ECommandType::CreateEntity, SortKey, Placeholder, 0, 1);
+    return Placeholder;
+}
+
+void FCommandBuffer::DestroyEntity(const uint32 SortKey, const FEntity Entity)
+{
+    AllocateCommand(ECommandType::DestroyEntity, SortKey, Entity, 0, 1);
+}
+
+void FCommandBuffer::Clear()
+{
+    for (const FCommand* Command : Commands)
+    {
+        if (Command->Payload != nullptr)
+        {
+            const FComponentTypeInfo& TypeInfo = FComponentRegistry::GetTypeInfo(Command->ComponentId);
+            if (TypeInfo.Destroy != nullptr)
+            {
+                TypeInfo.Destroy(Command->Payload, 1);
+            }
+        }
+    }
+    Commands.Clear();
+    CurrentBlock = 0;
+    BlockOffset = 0;
+    NumCreatedEntities = 0;
+}
+
+FCommandBuffer::FCommand& FCommandBuffer::AllocateCommand(const ECommandType Type, const uint32 SortKey, const FEntity Entity, const size64 PayloadSize,
+    const size64 PayloadAlignment)
+{
+    assert(PayloadAlignment <= 64 && "Component alignment is limited to the block alignment");
+
+    // Reserve both at once so a command never ends up in a different block than its payload
+    const size64 PayloadOffset = (sizeof(FCommand) + PayloadAlignment - 1) & ~(PayloadAlignment - 1);
+    uint8* Data = AllocateBytes(PayloadOffset + PayloadSize, PayloadAlignment > alignof(FCommand) ? PayloadAlignment : alignof(FCommand));
+
+    FCommand* Command = std::construct_at(reinterpret_cast<FCommand*>(Data), FCommand{
+        .Type = Type,
+        .ComponentId = 0,
+        .SortKey = SortKey,
+        .Entity = Entity,
+        .Apply = nullptr,
+        .Payload = PayloadSize > 0 ? Data + PayloadOffset : nullptr
+    });
+    Commands.PushBack(Command);
+    return *Command;
+}
+
+uint8* FCommandBuffer::AllocateBytes(const size64 Size, const size64 Alignment)
+{
+    while (CurrentBlock < Blocks.Num())
+    {
+        const FBlock& Block = Blocks[CurrentBlock];
+        const size64 Offset = (BlockOffset + Alignment - 1) & ~(Alignment - 1);
+        if (Offset + Size <= Block.Size)
+        {
+            BlockOffset = Offset + Size;
+            return Block.Data + Offset;
+        }
+        ++CurrentBlock;
+        BlockOffset = 0;
+    }
+
+    const size64 BlockSize = Size > CommandBufferBlockSize ? Size : CommandBufferBlockSize;
+    Blocks.PushBack(FBlock{.Data = static_cast<uint8*>(FMemory::Allocate(BlockSize, 64)), .Size = BlockSize});
+    CurrentBlock = static_cast<uint32>(Blocks.Num() - 1);
+    BlockOffset = Size;
+    return Blocks[CurrentBlock].Data;
+}
@@ -0,0 +1,62 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "ECS/Component.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <string>
+
+namespace
+{
+    struct FComponentRegistryState
+    {
+        std::mutex Mutex;
+        FComponentTypeInfo TypeInfos[MaxComponentTypes];
+        std::string TypeKeys[MaxComponentTypes];
+
+        // Published after the type info it covers is written, so readers do not need the mutex
+        std::atomic<uint32> NumComponentTypes = 0;
+    };
+
+    FComponentRegistryState& GetRegistryState()
+    {
+        static FComponentRegistryState State;
+        return State;
+    }
+}
+
+FComponentId FComponentRegistry::Register(const std::string_view TypeKey, const FComponentTypeInfo& TypeInfo)
+{
+    FComponentRegistryState& State = GetRegistryState();
+    std::scoped_lock Lock(State.Mutex);
+    const uint32 NumComponentTypes = State.NumComponentTypes.load(std::memory_order_relaxed);
+    for (uint32 ComponentId = 0; ComponentId < NumComponentTypes; ++ComponentId)
+    {
+        if (State.TypeKeys[ComponentId] == TypeKey)
+        {
+            const FComponentTypeInfo& Existing = State.TypeInfos[ComponentId];
+            assert(Existing.Size == TypeInfo.Size && Existing.Alignment == TypeInfo.Alignment && Existing.bEntityVersions == TypeInfo.bEntityVersions &&
+                "Two different component types share a name");
+            return ComponentId;
+        }
+    }
+
+    assert(NumComponentTypes < MaxComponentTypes && "Too many component types registered");
+    State.TypeInfos[NumComponentTypes] = TypeInfo;
+    State.TypeKeys[NumComponentTypes] = TypeKey;
+    State.NumComponentTypes.store(NumComponentTypes + 1, std::memory_order_release);
+    return NumComponentTypes;
+}
+
+const FComponentTypeInfo& FComponentRegistry::GetTypeInfo(const FComponentId ComponentId)
+{
+    const FComponentRegistryState& State = GetRegistryState();
+    assert(ComponentId < State.NumComponentTypes.load(std::memory_order_acquire) && "Unknown component id");
+    return State.TypeInfos[ComponentId];
+}
+
+uint32 FComponentRegistry::GetNumComponentTypes()
+{
+    return GetRegistryState().NumComponentTypes.load(std::memory_order_acquire);
+}
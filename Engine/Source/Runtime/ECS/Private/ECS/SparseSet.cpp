@@ -0,0 +1,165 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "ECS/SparseSet.hpp"
+
+#include "Core/Memory/Memory.hpp"
+
+FSparseSet::~FSparseSet()
+{
+    for (uint32* Page : Pages)
+    {
+        if (Page != nullptr)
+        {
+            FMemory::Free(Page);
+        }
+    }
+}
+
+void FSparseSet::Remove(const FEntity Entity)
+{
+    const uint32 DenseIndex = GetDenseIndex(Entity);
+    if (DenseIndex == InvalidIndex)
+    {
+        return;
+    }
+
+    RemoveComponentAt(DenseIndex);
+    const uint32 LastDenseIndex = static_cast<uint32>(Entities.Num() - 1);
+    if (DenseIndex != LastDenseIndex)
+    {
+        const FEntity MovedEntity = Entities[LastDenseIndex];
+        Entities[DenseIndex] = MovedEntity;
+        SetSparseIndex(MovedEntity.Index, DenseIndex);
+    }
+    Entities.PopBack();
+    SetSparseIndex(Entity.Index, InvalidIndex);
+}
+
+void FSparseSet::SwapEntries(const uint32 DenseIndexA, const uint32 DenseIndexB)
+{
+    if (DenseIndexA == DenseIndexB)
+    {
+        return;
+    }
+    const FEntity EntityA = Entities[DenseIndexA];
+    const FEntity EntityB = Entities[DenseIndexB];
+    Entities[DenseIndexA] = EntityB;
+    Entities[DenseIndexB] = EntityA;
+    SetSparseIndex(EntityA.Index, DenseIndexB);
+    SetSparseIndex(EntityB.Index, DenseIndexA);
+    SwapComponents(DenseIndexA, DenseIndexB);
+}
+
+void FSparseSet::SortAs(const FSparseSet& Other)
+{
+    assert(OwningGroup == nullptr && "Sets owned by a group keep the group order");
+    uint32 Position = 0;
+    for (const FEntity Entity : Other.GetEntities())
+    {
+        const uint32 DenseIndex = GetDenseIndex(Entity);
+        if (DenseIndex != InvalidIndex)
+        {
+            SwapEntries(DenseIndex, Position);
+            ++Position;
+        }
+    }
+}
+
+uint32 FSparseSet::AddEntity(const FEntity Entity)
+{
+    const uint32 DenseIndex = static_cast<uint32>(Entities.Num());
+    Entities.PushBack(Entity);
+    SetSparseIndex(Entity.Index, DenseIndex);
+    return DenseIndex;
+}
+
+void FSparseSet::SetSparseIndex(const uint32 EntityIndex, const uint32 DenseIndex)
+{
+    const uint32 PageIndex = EntityIndex / SparseSetPageSize;
+    if (PageIndex >= Pages.Num())
+    {
+        Pages.Resize(PageIndex + 1);
+    }
+    if (Pages[PageIndex] == nullptr)
+    {
+        Pages[PageIndex] = static_cast<uint32*>(FMemory::Allocate(SparseSetPageSize * sizeof(uint32)));
+        FMemory::Set(Pages[PageIndex], 0xFF, SparseSetPageSize * sizeof(uint32));
+    }
+    Pages[PageIndex][EntityIndex % SparseSetPageSize] = DenseIndex;
+}
+
+FSparseGroup::FSparseGroup(TArray<FSparseSet*> InOwnedSets)
+    : OwnedSets(std::move(InOwnedSets))
+{
+    FSparseSet* Smallest = nullptr;
+    for (FSparseSet* Set : OwnedSets)
+    {
+        assert(Set->GetOwningGroup() == nullptr && "A sparse set can only be owned by one group");
+        Set->SetOwningGroup(this);
+        if (Smallest == nullptr || Set->Num() < Smallest->Num())
+        {
+            Smallest = Set;
+        }
+    }
+
+    // HandleAdded only reorders entries in front of the current position, so walking by index stays valid
+    for (uint32 Index = 0; Index < Smallest->Num(); ++Index)
+    {
+        HandleAdded(Smallest->GetEntities()[Index]);
+    }
+}
+
+FSparseGroup::~FSparseGroup()
+{
+    for (FSparseSet* Set : OwnedSets)
+    {
+        Set->SetOwningGroup(nullptr);
+    }
+}
+
+void FSparseGroup::HandleAdded(const FEntity Entity)
+{
+    for (const FSparseSet* Set : OwnedSets)
+    {
+        if (!Set->Contains(Entity))
+        {
+            return;
+        }
+    }
+    if (OwnedSets[0]->GetDenseIndex(Entity) < Size)
+    {
+        return;
+    }
+    for (FSparseSet* Set : OwnedSets)
+    {
+        Set->SwapEntries(Set->GetDenseIndex(Entity), Size);
+    }
+    ++Size;
+}
+
+void FSparseGroup::HandleRemoving(const FEntity Entity)
+{
+    // Entries in front of Size are exactly the group members, in every owned set
+    const uint32 DenseIndex = OwnedSets[0]->GetDenseIndex(Entity);
+    if (DenseIndex == FSparseSet::InvalidIndex || DenseIndex >= Size)
+    {
+        return;
+    }
+    --Size;
+    for (FSparseSet* Set : OwnedSets)
+    {
+        Set->SwapEntries(Set->GetDenseIndex(Entity), Size);
+    }
+}
+
+bool8 FSparseGroup::Owns(const FSparseSet* Set) const
+{
+    for (const FSparseSet* OwnedSet : OwnedSets)
+    {
+        if (OwnedSet == Set)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,143 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "ECS/SystemScheduler.hpp"
+
+#include "Core/Threading/JobSystem.hpp"
+#include "ECS/World.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+DEFINE_LOG_CHANNEL(ECS, Info)
+
+FSystemScheduler::~FSystemScheduler()
+{
+    for (FSystem* System : Systems)
+    {
+        FMemory::DestroyObject(System);
+    }
+}
+
+FSystem& FSystemScheduler::AddSystem(FSystem* System)
+{
+    Systems.PushBack(System);
+    bScheduleDirty = true;
+    return *System;
+}
+
+void FSystemScheduler::Run(FWorld& World)
+{
+    BuildSchedule();
+    Timings.Resize(Systems.Num());
+
+    for (uint32 Stage = 0; Stage + 1 < StageOffsets.Num(); ++Stage)
+    {
+        World.AdvanceChangeTick();
+        const uint32 StageTick = World.GetChangeTick();
+        const uint32 FirstSystem = StageOffsets[Stage];
+        FJobSystem::ParallelFor(StageOffsets[Stage + 1] - FirstSystem, [this, &World, Stage, StageTick, FirstSystem](const size64 TaskIndex)
+        {
+            const uint32 SystemIndex = StageSystems[FirstSystem + TaskIndex];
+            FSystem& System = *Systems[SystemIndex];
+            const auto StartTime = std::chrono::steady_clock::now();
+            System.Execute(World);
+            System.LastRunTick = StageTick;
+            const std::chrono::duration<float64, std::milli> Duration = std::chrono::steady_clock::now() - StartTime;
+            Timings[SystemIndex] = FSystemTiming{.Stage = Stage, .ThreadIndex = FJobSystem::GetCurrentThreadIndex(), .Milliseconds = Duration.count()};
+        });
+
+        // Stages are the sync points where structural changes recorded by the systems are applied. They get a
+        // tick of their own, so the systems of this stage see them the next time they run
+        World.AdvanceChangeTick();
+        World.FlushCommands();
+    }
+
+    if (bFrameLogging)
+    {
+        float64 TotalMilliseconds = 0.0;
+        for (uint32 SystemIndex = 0; SystemIndex < Systems.Num(); ++SystemIndex)
+        {
+            const FSystemTiming& Timing = Timings[SystemIndex];
+            TotalMilliseconds += Timing.Milliseconds;
+            CVLOG(LogECS, Info, "System {} stage {} thread {}: {:.3f} ms", Systems[SystemIndex]->GetName(), Timing.Stage, Timing.ThreadIndex, Timing.Milliseconds);
+        }
+        CVLOG(LogECS, Info, "{} systems in {} stages, {:.3f} ms of system time\n{}", Systems.Num(), StageOffsets.Num() - 1, TotalMilliseconds, DescribeSchedule());
+    }
+}
+
+FAnsiString FSystemScheduler::DescribeSchedule()
+{
+    BuildSchedule();
+    FAnsiString Description;
+    for (uint32 Stage = 0; Stage + 1 < StageOffsets.Num(); ++Stage)
+    {
+        Description += "Stage " + std::to_string(Stage) + ":";
+        for (uint32 Offset = StageOffsets[Stage]; Offset < StageOffsets[Stage + 1]; ++Offset)
+        {
+            const uint32 SystemIndex = StageSystems[Offset];
+            Description += " " + Systems[SystemIndex]->GetName();
+            if (DependencyOffsets[SystemIndex] != DependencyOffsets[SystemIndex + 1])
+            {
+                Description += " (after";
+                for (uint32 Dependency = DependencyOffsets[SystemIndex]; Dependency < DependencyOffsets[SystemIndex + 1]; ++Dependency)
+                {
+                    Description += " " + Systems[DependencyIndices[Dependency]]->GetName();
+                }
+                Description += ")";
+            }
+        }
+        Description += "\n";
+    }
+    return Description;
+}
+
+void FSystemScheduler::BuildSchedule()
+{
+    if (!bScheduleDirty)
+    {
+        return;
+    }
+    bScheduleDirty = false;
+
+    const uint32 NumSystems = static_cast<uint32>(Systems.Num());
+    DependencyOffsets.Clear();
+    DependencyIndices.Clear();
+    SystemStages.Resize(NumSystems);
+
+    // A system waits for every earlier conflicting system, its stage is one past the latest of them
+    uint32 NumStages = 0;
+    for (uint32 SystemIndex = 0; SystemIndex < NumSystems; ++SystemIndex)
+    {
+        DependencyOffsets.PushBack(static_cast<uint32>(DependencyIndices.Num()));
+        uint32 Stage = 0;
+        for (uint32 EarlierIndex = 0; EarlierIndex < SystemIndex; ++EarlierIndex)
+        {
+            if (Systems[SystemIndex]->GetAccess().ConflictsWith(Systems[EarlierIndex]->GetAccess()))
+            {
+                DependencyIndices.PushBack(EarlierIndex);
+                Stage = std::max(Stage, SystemStages[EarlierIndex] + 1);
+            }
+        }
+        SystemStages[SystemIndex] = Stage;
+        NumStages = std::max(NumStages, Stage + 1);
+    }
+    DependencyOffsets.PushBack(static_cast<uint32>(DependencyIndices.Num()));
+
+    // Counting sort of the systems by stage, systems keep their relative order within a stage
+    StageOffsets.Clear();
+    StageOffsets.Resize(NumStages + 1);
+    for (const uint32 Stage : SystemStages)
+    {
+        ++StageOffsets[Stage + 1];
+    }
+    for (uint32 Stage = 0; Stage < NumStages; ++Stage)
+    {
+        StageOffsets[Stage + 1] += StageOffsets[Stage];
+    }
+    StageSystems.Resize(NumSystems);
+    TArray<uint32> NextOffsets = StageOffsets;
+    for (uint32 SystemIndex = 0; SystemIndex < NumSystems; ++SystemIndex)
+    {
+        StageSystems[NextOffsets[SystemStages[SystemIndex]]++] = SystemIndex;
+    }
+}
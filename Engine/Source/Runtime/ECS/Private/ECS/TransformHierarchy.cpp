@@ -0,0 +1,257 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "ECS/TransformHierarchy.hpp"
+
+#include "Core/Memory/Memory.hpp"
+#include "Core/Threading/JobSystem.hpp"
+
+FTransformHandle FTransformHierarchy::AddNode(const FMatrix44& Local, const FTransformHandle Parent)
+{
+    const uint32 ParentIndex = Parent.IsValid() ? GetNodeIndex(Parent) : InvalidIndex;
+    const FTransformHandle Handle = Slots.Acquire(static_cast<uint32>(Parents.Num()));
+
+    // Appending keeps parents ahead of their children, only the levels are no longer contiguous
+    LocalTransforms.PushBack(Local);
+    WorldTransforms.PushBack(Local);
+    Parents.PushBack(ParentIndex);
+    DirtyFlags.PushBack(1);
+    NodeSlots.PushBack(Handle.GetIndex());
+    bOrderDirty = true;
+    bAnyDirty = true;
+    return Handle;
+}
+
+void FTransformHierarchy::RemoveNode(const FTransformHandle Handle)
+{
+    assert(Contains(Handle) && "Transform handle is stale or invalid");
+    if (bOrderDirty)
+    {
+        SortBreadthFirst();
+    }
+    const uint32 RemovedIndex = GetNodeIndex(Handle);
+
+    // Parents precede their children, so one sweep from the node finds the whole subtree. Depths is reused to
+    // mark the removed nodes, then to hold the new index of every kept one
+    TArray<uint32>& NewIndices = Depths;
+    NewIndices.Clear();
+    NewIndices.Resize(Parents.Num());
+    uint32 NumKept = 0;
+    for (uint32 Index = 0; Index < Parents.Num(); ++Index)
+    {
+        const uint32 Parent = Parents[Index];
+        const bool8 bRemoved = Index == RemovedIndex || (Index > RemovedIndex && Parent != InvalidIndex && NewIndices[Parent] == InvalidIndex);
+        if (bRemoved)
+        {
+            NewIndices[Index] = InvalidIndex;
+            Slots.Release(NodeSlots[Index]);
+            continue;
+        }
+
+        // Compacting in order keeps the breadth first order
+        NewIndices[Index] = NumKept;
+        LocalTransforms[NumKept] = LocalTransforms[Index];
+        WorldTransforms[NumKept] = WorldTransforms[Index];
+        Parents[NumKept] = Parent != InvalidIndex ? NewIndices[Parent] : InvalidIndex;
+        DirtyFlags[NumKept] = DirtyFlags[Index];
+        NodeSlots[NumKept] = NodeSlots[Index];
+        Slots.SetTarget(NodeSlots[NumKept], NumKept);
+        ++NumKept;
+    }
+
+    LocalTransforms.Resize(NumKept);
+    WorldTransforms.Resize(NumKept);
+    Parents.Resize(NumKept);
+    DirtyFlags.Resize(NumKept);
+    NodeSlots.Resize(NumKept);
+    bOrderDirty = true;
+}
+
+void FTransformHierarchy::SetParent(const FTransformHandle Handle, const FTransformHandle Parent)
+{
+    const uint32 NodeIndex = GetNodeIndex(Handle);
+    const uint32 ParentIndex = Parent.IsValid() ? GetNodeIndex(Parent) : InvalidIndex;
+    for (uint32 Ancestor = ParentIndex; Ancestor != InvalidIndex; Ancestor = Parents[Ancestor])
+    {
+        assert(Ancestor != NodeIndex && "A node cannot become a descendant of itself");
+    }
+
+    Parents[NodeIndex] = ParentIndex;
+    DirtyFlags[NodeIndex] = 1;
+    bOrderDirty = true;
+    bAnyDirty = true;
+}
+
+void FTransformHierarchy::SetLocal(const FTransformHandle Handle, const FMatrix44& Local)
+{
+    const uint32 NodeIndex = GetNodeIndex(Handle);
+    LocalTransforms[NodeIndex] = Local;
+    DirtyFlags[NodeIndex] = 1;
+    bAnyDirty = true;
+}
+
+FTransformHandle FTransformHierarchy::GetParent(const FTransformHandle Handle) const
+{
+    const uint32 ParentIndex = Parents[GetNodeIndex(Handle)];
+    if (ParentIndex == InvalidIndex)
+    {
+        return {};
+    }
+    return Slots.GetHandle(NodeSlots[ParentIndex]);
+}
+
+bool8 FTransformHierarchy::Contains(const FTransformHandle Handle) const noexcept
+{
+    return Slots.Contains(Handle);
+}
+
+void FTransformHierarchy::Update()
+{
+    if (bOrderDirty)
+    {
+        SortBreadthFirst();
+    }
+    if (!bAnyDirty)
+    {
+        return;
+    }
+
+    // Every level only reads the finished level above it, so its nodes can be split freely
+    for (uint32 Level = 0; Level + 1 < LevelOffsets.Num(); ++Level)
+    {
+        const uint32 Begin = LevelOffsets[Level];
+        const uint32 End = LevelOffsets[Level + 1];
+        const uint32 NumTasks = (End - Begin + NodesPerTask - 1) / NodesPerTask;
+        if (NumTasks <= 1)
+        {
+            UpdateRange(Begin, End);
+            continue;
+        }
+        FJobSystem::ParallelFor(NumTasks, [this, Begin, End](const size64 TaskIndex)
+        {
+            const uint32 TaskBegin = Begin + static_cast<uint32>(TaskIndex) * NodesPerTask;
+            UpdateRange(TaskBegin, TaskBegin + NodesPerTask < End ? TaskBegin + NodesPerTask : End);
+        });
+    }
+
+    FMemory::Set(DirtyFlags.GetData(), 0, DirtyFlags.Num());
+    bAnyDirty = false;
+}
+
+uint32 FTransformHierarchy::GetNodeIndex(const FTransformHandle Handle) const
+{
+    assert(Contains(Handle) && "Transform handle is stale or invalid");
+    return Slots.GetTarget(Handle.GetIndex());
+}
+
+void FTransformHierarchy::SortBreadthFirst()
+{
+    ComputeDepths();
+    const uint32 NumNodes = static_cast<uint32>(Parents.Num());
+
+    uint32 MaxDepth = 0;
+    for (const uint32 Depth : Depths)
+    {
+        MaxDepth = Depth > MaxDepth ? Depth : MaxDepth;
+    }
+    LevelOffsets.Clear();
+    LevelOffsets.Resize(NumNodes > 0 ? MaxDepth + 2 : 0);
+    for (const uint32 Depth : Depths)
+    {
+        ++LevelOffsets[Depth + 1];
+    }
+    for (uint32 Level = 1; Level < LevelOffsets.Num(); ++Level)
+    {
+        LevelOffsets[Level] += LevelOffsets[Level - 1];
+    }
+
+    // Depths becomes the new index of every node, parents are remapped once all new indices are known
+    TArray<uint32> Cursors = LevelOffsets;
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        Depths[Index] = Cursors[Depths[Index]]++;
+    }
+
+    TArray<FMatrix44> SortedLocals;
+    TArray<FMatrix44> SortedWorlds;
+    TArray<uint32> SortedParents;
+    TArray<uint8> SortedDirtyFlags;
+    TArray<uint32> SortedSlots;
+    SortedLocals.Resize(NumNodes);
+    SortedWorlds.Resize(NumNodes);
+    SortedParents.Resize(NumNodes);
+    SortedDirtyFlags.Resize(NumNodes);
+    SortedSlots.Resize(NumNodes);
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        const uint32 NewIndex = Depths[Index];
+        SortedLocals[NewIndex] = LocalTransforms[Index];
+        SortedWorlds[NewIndex] = WorldTransforms[Index];
+        SortedParents[NewIndex] = Parents[Index] != InvalidIndex ? Depths[Parents[Index]] : InvalidIndex;
+        SortedDirtyFlags[NewIndex] = DirtyFlags[Index];
+        SortedSlots[NewIndex] = NodeSlots[Index];
+        Slots.SetTarget(NodeSlots[Index], NewIndex);
+    }
+
+    LocalTransforms = std::move(SortedLocals);
+    WorldTransforms = std::move(SortedWorlds);
+    Parents = std::move(SortedParents);
+    DirtyFlags = std::move(SortedDirtyFlags);
+    NodeSlots = std::move(SortedSlots);
+    bOrderDirty = false;
+}
+
+void FTransformHierarchy::ComputeDepths()
+{
+    const uint32 NumNodes = static_cast<uint32>(Parents.Num());
+    Depths.Clear();
+    Depths.Resize(NumNodes);
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        Depths[Index] = InvalidIndex;
+    }
+
+    // Walks up to the first node with a known depth, then fills in the path on the way back down
+    TArray<uint32> Path;
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        uint32 Node = Index;
+        while (Node != InvalidIndex && Depths[Node] == InvalidIndex)
+        {
+            Path.PushBack(Node);
+            Node = Parents[Node];
+        }
+        uint32 Depth = Node != InvalidIndex ? Depths[Node] + 1 : 0;
+        while (!Path.IsEmpty())
+        {
+            Depths[Path.GetLast()] = Depth++;
+            Path.PopBack();
+        }
+    }
+}
+
+void FTransformHierarchy::UpdateRange(const uint32 Begin, const uint32 End)
+{
+    const FMatrix44* Locals = LocalTransforms.GetData();
+    FMatrix44* Worlds = WorldTransforms.GetData();
+    const uint32* ParentIndices = Parents.GetData();
+    uint8* Dirty = DirtyFlags.GetData();
+    for (uint32 Index = Begin; Index < End; ++Index)
+    {
+        const uint32 Parent = ParentIndices[Index];
+        if (Parent == InvalidIndex)
+        {
+            if (Dirty[Index] != 0)
+            {
+                Worlds[Index] = Locals[Index];
+            }
+            continue;
+        }
+
+        // A dirty parent dirties its children, which pass it on to the next level
+        Dirty[Index] |= Dirty[Parent];
+        if (Dirty[Index] != 0)
+        {
+            Worlds[Index] = FMatrix44::Multiply(Worlds[Parent], Locals[Index]);
+        }
+    }
+}
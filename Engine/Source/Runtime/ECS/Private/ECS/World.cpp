@@ -0,0 +1,364 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "ECS/World.hpp"
+
+#include "Core/Containers/Sorting.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Threading/JobSystem.hpp"
+
+namespace
+{
+    struct FCommandPlaybackEntry
+    {
+        uint32 SortKey;
+        FCommandBuffer::FCommand* Command;
+    };
+}
+
+FWorld::FWorld()
+    : EmptyArchetype(nullptr), NumEntities(0), ChangeTick(1)
+{
+    EmptyArchetype = FindOrCreateArchetype(FComponentSignature());
+}
+
+FWorld::~FWorld()
+{
+    for (FCommandBuffer* Buffer : CommandBuffers)
+    {
+        if (Buffer != nullptr)
+        {
+            FMemory::DestroyObject(Buffer);
+        }
+    }
+    for (FSparseGroup* Group : Groups)
+    {
+        FMemory::DestroyObject(Group);
+    }
+    for (FSparseSet* Set : SparseSets)
+    {
+        if (Set != nullptr)
+        {
+            FMemory::DestroyObject(Set);
+        }
+    }
+    for (FArchetype* Archetype : Archetypes)
+    {
+        FMemory::DestroyObject(Archetype);
+    }
+}
+
+FEntity FWorld::CreateEntity()
+{
+    return CreateEntityInArchetype(EmptyArchetype);
+}
+
+void FWorld::DestroyEntity(const FEntity Entity)
+{
+    assert(IsAlive(Entity) && "Entity is not alive");
+    for (FComponentId ComponentId = 0; ComponentId < SparseSets.Num(); ++ComponentId)
+    {
+        RemoveSparseComponent(Entity, ComponentId);
+    }
+
+    FEntityRecord& Record = EntityRecords[Entity.Index];
+    Record.Archetype->DestroyRow(Record.Location);
+    RemoveRecordRow(Record);
+
+    Record.Archetype = nullptr;
+    // An index whose generation would wrap is retired, or stale entities would match the next one created in it
+    if (Record.Generation < FEntity::MaxGeneration)
+    {
+        ++Record.Generation;
+        FreeEntityIndices.PushBack(Entity.Index);
+    }
+    --NumEntities;
+}
+
+bool8 FWorld::IsAlive(const FEntity Entity) const
+{
+    return Entity.Index < EntityRecords.Num() && EntityRecords[Entity.Index].Generation == Entity.Generation && EntityRecords[Entity.Index].Archetype != nullptr;
+}
+
+FCommandBuffer& FWorld::GetCommandBuffer()
+{
+    const uint32 ThreadIndex = FJobSystem::GetCurrentThreadIndex();
+    assert(ThreadIndex < MaxCommandBufferThreads && "More threads than command buffers");
+    FCommandBuffer*& Buffer = CommandBuffers[ThreadIndex];
+    if (Buffer == nullptr)
+    {
+        Buffer = FMemory::New<FCommandBuffer>(ThreadIndex);
+    }
+    return *Buffer;
+}
+
+void FWorld::FlushCommands()
+{
+    size64 NumCommands = 0;
+    for (const FCommandBuffer* Buffer : CommandBuffers)
+    {
+        NumCommands += Buffer != nullptr ? Buffer->Num() : 0;
+    }
+    if (NumCommands == 0)
+    {
+        return;
+    }
+
+    TArray<FCommandPlaybackEntry> Entries;
+    Entries.Reserve(NumCommands);
+    bool8 bSorted = true;
+    for (FCommandBuffer* Buffer : CommandBuffers)
+    {
+        if (Buffer == nullptr || Buffer->IsEmpty())
+        {
+            continue;
+        }
+        Buffer->CreatedEntities.Clear();
+        Buffer->CreatedEntities.Resize(Buffer->NumCreatedEntities);
+        for (FCommandBuffer::FCommand* Command : Buffer->GetCommands())
+        {
+            bSorted &= Entries.IsEmpty() || Entries.GetLast().SortKey <= Command->SortKey;
+            Entries.PushBack(FCommandPlaybackEntry{.SortKey = Command->SortKey, .Command = Command});
+        }
+    }
+
+    // Stable, so commands with equal keys keep the order of their buffer. A single thread recording in key
+    // order needs no sort at all
+    if (!bSorted)
+    {
+        Ranges::RadixSort(Entries, [](const FCommandPlaybackEntry& Entry)
+        {
+            return Entry.SortKey;
+        });
+    }
+
+    for (const FCommandPlaybackEntry& Entry : Entries)
+    {
+        FCommandBuffer::FCommand& Command = *Entry.Command;
+        switch (Command.Type)
+        {
+        case FCommandBuffer::ECommandType::CreateEntity:
+            CommandBuffers[Command.Entity.Generation]->CreatedEntities[Command.Entity.Index & ~DeferredEntityBit] = CreateEntity();
+            break;
+        case FCommandBuffer::ECommandType::DestroyEntity:
+        {
+            // Several threads may destroy the same entity, only the first command applies
+            const FEntity Entity = ResolveCommandEntity(Command.Entity);
+            if (IsAlive(Entity))
+            {
+                DestroyEntity(Entity);
+            }
+            break;
+        }
+        case FCommandBuffer::ECommandType::AddComponent:
+        case FCommandBuffer::ECommandType::RemoveComponent:
+        {
+            // Payloads of skipped commands are destroyed when the buffer is cleared
+            const FEntity Entity = ResolveCommandEntity(Command.Entity);
+            if (IsAlive(Entity))
+            {
+                Command.Apply(*this, Entity, Command.Payload);
+                Command.Payload = nullptr;
+            }
+            break;
+        }
+        }
+    }
+
+    for (FCommandBuffer* Buffer : CommandBuffers)
+    {
+        if (Buffer != nullptr)
+        {
+            Buffer->Clear();
+        }
+    }
+}
+
+FArchetype* FWorld::FindOrCreateArchetype(const FComponentSignature& Signature)
+{
+    const auto It = ArchetypesBySignature.Find(Signature);
+    if (It != ArchetypesBySignature.end())
+    {
+        return It->second;
+    }
+    FArchetype* Archetype = FMemory::New<FArchetype>(Signature);
+    ArchetypesBySignature.Insert({Signature, Archetype});
+    Archetypes.PushBack(Archetype);
+    return Archetype;
+}
+
+void FWorld::RemoveSparseComponent(const FEntity Entity, const FComponentId ComponentId)
+{
+    FSparseSet* Set = FindSparseSet(ComponentId);
+    if (Set == nullptr || !Set->Contains(Entity))
+    {
+        return;
+    }
+    if (FSparseGroup* Group = Set->GetOwningGroup())
+    {
+        Group->HandleRemoving(Entity);
+    }
+    Set->Remove(Entity);
+}
+
+FEntity FWorld::ResolveCommandEntity(const FEntity Entity) const
+{
+    if (!FCommandBuffer::IsDeferredEntity(Entity))
+    {
+        return Entity;
+    }
+    const FCommandBuffer* Buffer = Entity.Generation < MaxCommandBufferThreads ? CommandBuffers[Entity.Generation] : nullptr;
+    const uint32 CreationIndex = Entity.Index & ~DeferredEntityBit;
+    assert(Buffer != nullptr && CreationIndex < Buffer->CreatedEntities.Num() && "Placeholder entity does not belong to a command buffer");
+    assert(Buffer->CreatedEntities[CreationIndex].IsValid() && "Placeholder entity used before the command creating it was played back");
+    return Buffer->CreatedEntities[CreationIndex];
+}
+
+FEntity FWorld::CreateEntityInArchetype(FArchetype* Archetype)
+{
+    uint32 Index;
+    if (!FreeEntityIndices.IsEmpty())
+    {
+        Index = FreeEntityIndices.GetLast();
+        FreeEntityIndices.PopBack();
+    }
+    else
+    {
+        Index = static_cast<uint32>(EntityRecords.Num());
+        assert(Index < DeferredEntityBit && "Entity indices with the deferred bit are reserved for command buffer placeholders");
+        EntityRecords.PushBack(FEntityRecord{.Archetype = nullptr, .Location = {}, .Generation = 0});
+    }
+
+    FEntityRecord& Record = EntityRecords[Index];
+    const FEntity Entity{.Index = Index, .Generation = Record.Generation};
+    Record.Archetype = Archetype;
+    Record.Location = Archetype->AllocateRow(Entity);
+    for (uint32 ColumnIndex = 0; ColumnIndex < Archetype->GetColumns().Num(); ++ColumnIndex)
+    {
+        Archetype->SetRowVersions(Record.Location, ColumnIndex, ChangeTick, ChangeTick);
+    }
+    ++NumEntities;
+    return Entity;
+}
+
+void FWorld::MoveEntity(FEntityRecord& Record, FArchetype* Target)
+{
+    FArchetype* Source = Record.Archetype;
+    const FEntity Entity = Source->GetEntities(Record.Location.ChunkIndex)[Record.Location.Row];
+    const FEntityLocation TargetLocation = Target->AllocateRow(Entity);
+
+    // Both column lists are sorted by component id, walk them side by side
+    const TArray<FArchetypeColumn>& SourceColumns = Source->GetColumns();
+    const TArray<FArchetypeColumn>& TargetColumns = Target->GetColumns();
+    uint32 TargetIndex = 0;
+    for (uint32 SourceIndex = 0; SourceIndex < SourceColumns.Num(); ++SourceIndex)
+    {
+        const FArchetypeColumn& Column = SourceColumns[SourceIndex];
+        while (TargetIndex < TargetColumns.Num() && TargetColumns[TargetIndex].ComponentId < Column.ComponentId)
+        {
+            ++TargetIndex;
+        }
+
+        void* SourceData = Source->GetComponentData(Record.Location, SourceIndex);
+        if (TargetIndex < TargetColumns.Num() && TargetColumns[TargetIndex].ComponentId == Column.ComponentId)
+        {
+            // Moving is no change, the component keeps its versions
+            Target->SetRowVersions(TargetLocation, TargetIndex, Source->GetRowChangedVersion(Record.Location, SourceIndex),
+                Source->GetRowAddedVersion(Record.Location, SourceIndex));
+            void* TargetData = Target->GetComponentData(TargetLocation, TargetIndex);
+            if (Column.TypeInfo.Relocate != nullptr)
+            {
+                Column.TypeInfo.Relocate(TargetData, SourceData, 1);
+            }
+            else
+            {
+                FMemory::Copy(SourceData, TargetData, Column.TypeInfo.Size);
+            }
+        }
+        else if (Column.TypeInfo.Destroy != nullptr)
+        {
+            Column.TypeInfo.Destroy(SourceData, 1);
+        }
+    }
+
+    RemoveRecordRow(Record);
+    Record.Archetype = Target;
+    Record.Location = TargetLocation;
+}
+
+void* FWorld::AddComponentStorage(const FEntity Entity, const FComponentId ComponentId)
+{
+    assert(IsAlive(Entity) && "Entity is not alive");
+    FEntityRecord& Record = EntityRecords[Entity.Index];
+    FArchetype* Source = Record.Archetype;
+
+    FArchetype* Target = Source->FindAddEdge(ComponentId);
+    if (Target == nullptr)
+    {
+        FComponentSignature Signature = Source->GetSignature();
+        Signature.Add(ComponentId);
+        Target = FindOrCreateArchetype(Signature);
+        Source->SetAddEdge(ComponentId, Target);
+        Target->SetRemoveEdge(ComponentId, Source);
+    }
+
+    MoveEntity(Record, Target);
+    const uint32 ColumnIndex = Target->FindColumn(ComponentId);
+    Target->SetRowVersions(Record.Location, ColumnIndex, ChangeTick, ChangeTick);
+    return Target->GetComponentData(Record.Location, ColumnIndex);
+}
+
+void FWorld::RemoveComponentStorage(const FEntity Entity, const FComponentId ComponentId)
+{
+    assert(IsAlive(Entity) && "Entity is not alive");
+    FEntityRecord& Record = EntityRecords[Entity.Index];
+    FArchetype* Source = Record.Archetype;
+    if (!Source->GetSignature().Contains(ComponentId))
+    {
+        return;
+    }
+
+    FArchetype* Target = Source->FindRemoveEdge(ComponentId);
+    if (Target == nullptr)
+    {
+        FComponentSignature Signature = Source->GetSignature();
+        Signature.Remove(ComponentId);
+        Target = FindOrCreateArchetype(Signature);
+        Source->SetRemoveEdge(ComponentId, Target);
+        Target->SetAddEdge(ComponentId, Source);
+    }
+
+    MoveEntity(Record, Target);
+}
+
+void* FWorld::FindComponentStorage(const FEntity Entity, const FComponentId ComponentId) const
+{
+    assert(IsAlive(Entity) && "Entity is not alive");
+    const FEntityRecord& Record = EntityRecords[Entity.Index];
+    if (!Record.Archetype->GetSignature().Contains(ComponentId))
+    {
+        return nullptr;
+    }
+    return Record.Archetype->GetComponentData(Record.Location, Record.Archetype->FindColumn(ComponentId));
+}
+
+void* FWorld::FindMutableComponentStorage(const FEntity Entity, const FComponentId ComponentId)
+{
+    assert(IsAlive(Entity) && "Entity is not alive");
+    const FEntityRecord& Record = EntityRecords[Entity.Index];
+    if (!Record.Archetype->GetSignature().Contains(ComponentId))
+    {
+        return nullptr;
+    }
+    const uint32 ColumnIndex = Record.Archetype->FindColumn(ComponentId);
+    Record.Archetype->MarkRowChanged(Record.Location, ColumnIndex, ChangeTick);
+    return Record.Archetype->GetComponentData(Record.Location, ColumnIndex);
+}
+
+void FWorld::RemoveRecordRow(const FEntityRecord& Record)
+{
+    const FEntity MovedEntity = Record.Archetype->RemoveRow(Record.Location);
+    if (MovedEntity.IsValid())
+    {
+        EntityRecords[MovedEntity.Index].Location = Record.Location;
+    }
+}
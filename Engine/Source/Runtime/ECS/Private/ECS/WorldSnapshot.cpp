@@ -0,0 +1,419 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "ECS/WorldSnapshot.hpp"
+
+#include "Core/Containers/BitArray.hpp"
+#include "Core/Containers/Set.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "ECS/World.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    // Layout: header, per archetype a description followed by its columns, the entity records, the free entity
+    // indices and finally the chunks of all archetypes in order, starting on a chunk aligned offset
+    struct FSnapshotHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint32 ChunkSize;
+        uint32 NumArchetypes;
+        uint32 NumEntityRecords;
+        uint32 NumFreeEntityIndices;
+        uint32 ChangeTick;
+        uint32 ChunksOffset;
+        uint64 NumEntities;
+    };
+
+    struct FSnapshotArchetype
+    {
+        uint32 NumColumns;
+        uint32 ChunkCapacity;
+        uint64 NumEntities;
+    };
+
+    struct FSnapshotColumn
+    {
+        FComponentId ComponentId;
+        uint32 Size;
+        uint32 Alignment;
+        uint32 bEntityVersions;
+    };
+
+    struct FSnapshotEntityRecord
+    {
+        // Index into the saved archetypes, InvalidArchetype for destroyed entities
+        uint32 ArchetypeIndex;
+        uint32 ChunkIndex;
+        uint32 Row;
+        uint32 Generation;
+    };
+
+    constexpr uint32 InvalidArchetype = 0xFFFFFFFF;
+
+    [[nodiscard]] constexpr size64 AlignOffset(const size64 Offset, const size64 Alignment)
+    {
+        return (Offset + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    // Copies plain structs in and out of a byte buffer that may not be aligned for them
+    class FSnapshotWriter
+    {
+    public:
+        explicit FSnapshotWriter(uint8* InData)
+            : Data(InData)
+        {
+        }
+
+        template <typename T>
+        void Write(const T& Value)
+        {
+            WriteBytes(&Value, sizeof(T));
+        }
+
+        void WriteBytes(const void* Source, const size64 Size)
+        {
+            FMemory::Copy(Source, Data + Offset, Size);
+            Offset += Size;
+        }
+
+        void Seek(const size64 InOffset)
+        {
+            Offset = InOffset;
+        }
+
+    private:
+        uint8* Data;
+        size64 Offset = 0;
+    };
+
+    class FSnapshotReader
+    {
+    public:
+        FSnapshotReader(const uint8* InData, const size64 InSize)
+            : Data(InData), Size(InSize)
+        {
+        }
+
+        template <typename T>
+        [[nodiscard]] bool8 Read(T& OutValue)
+        {
+            if (Size - Offset < sizeof(T))
+            {
+                return false;
+            }
+            FMemory::Copy(Data + Offset, &OutValue, sizeof(T));
+            Offset += sizeof(T);
+            return true;
+        }
+
+        // Pointer to the next Count bytes, null if the data ends before
+        [[nodiscard]] const uint8* Skip(const size64 Count)
+        {
+            if (Size - Offset < Count)
+            {
+                return nullptr;
+            }
+            const uint8* Result = Data + Offset;
+            Offset += Count;
+            return Result;
+        }
+
+        [[nodiscard]] bool8 Seek(const size64 InOffset)
+        {
+            if (InOffset > Size)
+            {
+                return false;
+            }
+            Offset = InOffset;
+            return true;
+        }
+
+    private:
+        const uint8* Data;
+        size64 Size;
+        size64 Offset = 0;
+    };
+
+    struct FRestoredArchetype
+    {
+        FComponentSignature Signature;
+        size64 NumEntities;
+        uint32 ChunkCapacity;
+
+        // Position of the archetype's first chunk among all saved chunks
+        size64 FirstChunk;
+        FArchetype* Archetype;
+    };
+
+    [[nodiscard]] FSnapshotEntityRecord ReadEntityRecord(const uint8* SavedRecords, const uint32 Index)
+    {
+        FSnapshotEntityRecord Saved;
+        FMemory::Copy(SavedRecords + sizeof(FSnapshotEntityRecord) * Index, &Saved, sizeof(Saved));
+        return Saved;
+    }
+}
+
+bool8 FWorldSnapshot::Save(const FWorld& World, TArray<uint8>& OutData)
+{
+    for (const FSparseSet* Set : World.SparseSets)
+    {
+        if (Set != nullptr && !Set->IsEmpty())
+        {
+            return false;
+        }
+    }
+
+    size64 NumChunks = 0;
+    size64 HeaderSize = sizeof(FSnapshotHeader);
+    for (const FArchetype* Archetype : World.Archetypes)
+    {
+        if (Archetype->GetNumEntities() > 0 && !Archetype->IsTriviallyCopyable())
+        {
+            return false;
+        }
+        NumChunks += Archetype->GetNumChunks();
+        HeaderSize += sizeof(FSnapshotArchetype) + sizeof(FSnapshotColumn) * Archetype->GetColumns().Num();
+    }
+    HeaderSize += sizeof(FSnapshotEntityRecord) * World.EntityRecords.Num() + sizeof(uint32) * World.FreeEntityIndices.Num();
+    const size64 ChunksOffset = AlignOffset(HeaderSize, ArchetypeChunkAlignment);
+    assert(ChunksOffset <= 0xFFFFFFFF && "Snapshot header too large");
+
+    OutData.Clear();
+    OutData.ResizeUninitialized(ChunksOffset + NumChunks * ArchetypeChunkSize);
+    FSnapshotWriter Writer(OutData.GetData());
+    Writer.Write(FSnapshotHeader{
+        .Magic = Magic,
+        .Version = Version,
+        .ChunkSize = static_cast<uint32>(ArchetypeChunkSize),
+        .NumArchetypes = static_cast<uint32>(World.Archetypes.Num()),
+        .NumEntityRecords = static_cast<uint32>(World.EntityRecords.Num()),
+        .NumFreeEntityIndices = static_cast<uint32>(World.FreeEntityIndices.Num()),
+        .ChangeTick = World.ChangeTick,
+        .ChunksOffset = static_cast<uint32>(ChunksOffset),
+        .NumEntities = World.NumEntities
+    });
+
+    // Archetypes are written in the order of World.Archetypes, entity records refer to them by that index
+    TArray<uint32> RecordArchetypes;
+    RecordArchetypes.ResizeUninitialized(World.EntityRecords.Num());
+    std::fill_n(RecordArchetypes.GetData(), RecordArchetypes.Num(), InvalidArchetype);
+    for (uint32 ArchetypeIndex = 0; ArchetypeIndex < World.Archetypes.Num(); ++ArchetypeIndex)
+    {
+        const FArchetype* Archetype = World.Archetypes[ArchetypeIndex];
+        for (uint32 ChunkIndex = 0; ChunkIndex < Archetype->GetNumChunks(); ++ChunkIndex)
+        {
+            const FEntity* Entities = Archetype->GetEntities(ChunkIndex);
+            for (uint32 Row = 0; Row < Archetype->GetChunk(ChunkIndex).NumEntities; ++Row)
+            {
+                RecordArchetypes[Entities[Row].Index] = ArchetypeIndex;
+            }
+        }
+        Writer.Write(FSnapshotArchetype{
+            .NumColumns = static_cast<uint32>(Archetype->GetColumns().Num()),
+            .ChunkCapacity = Archetype->GetChunkCapacity(),
+            .NumEntities = Archetype->GetNumEntities()
+        });
+        for (const FArchetypeColumn& Column : Archetype->GetColumns())
+        {
+            Writer.Write(FSnapshotColumn{
+                .ComponentId = Column.ComponentId,
+                .Size = Column.TypeInfo.Size,
+                .Alignment = Column.TypeInfo.Alignment,
+                .bEntityVersions = Column.TypeInfo.bEntityVersions ? 1u : 0u
+            });
+        }
+    }
+
+    for (uint32 Index = 0; Index < World.EntityRecords.Num(); ++Index)
+    {
+        const FWorld::FEntityRecord& Record = World.EntityRecords[Index];
+        Writer.Write(FSnapshotEntityRecord{
+            .ArchetypeIndex = RecordArchetypes[Index],
+            .ChunkIndex = Record.Location.ChunkIndex,
+            .Row = Record.Location.Row,
+            .Generation = Record.Generation
+        });
+    }
+    Writer.WriteBytes(World.FreeEntityIndices.GetData(), sizeof(uint32) * World.FreeEntityIndices.Num());
+
+    Writer.Seek(ChunksOffset);
+    for (const FArchetype* Archetype : World.Archetypes)
+    {
+        for (uint32 ChunkIndex = 0; ChunkIndex < Archetype->GetNumChunks(); ++ChunkIndex)
+        {
+            Writer.WriteBytes(Archetype->GetChunk(ChunkIndex).Data, ArchetypeChunkSize);
+        }
+    }
+    return true;
+}
+
+bool8 FWorldSnapshot::Load(FWorld& World, const uint8* Data, const size64 Size)
+{
+    for (const FCommandBuffer* CommandBuffer : World.CommandBuffers)
+    {
+        assert((CommandBuffer == nullptr || CommandBuffer->IsEmpty()) && "Flush pending commands before loading a snapshot");
+    }
+
+    FSnapshotReader Reader(Data, Size);
+    FSnapshotHeader Header;
+    if (!Reader.Read(Header) || Header.Magic != Magic || Header.Version != Version || Header.ChunkSize != ArchetypeChunkSize)
+    {
+        return false;
+    }
+
+    // Validate everything before the world is touched
+    TArray<FRestoredArchetype> Restored;
+    Restored.Reserve(Header.NumArchetypes);
+    TSet<FComponentSignature> Signatures;
+    size64 NumChunks = 0;
+    uint64 NumArchetypeEntities = 0;
+    for (uint32 ArchetypeIndex = 0; ArchetypeIndex < Header.NumArchetypes; ++ArchetypeIndex)
+    {
+        FSnapshotArchetype SavedArchetype;
+        if (!Reader.Read(SavedArchetype))
+        {
+            return false;
+        }
+
+        FComponentSignature Signature;
+        for (uint32 ColumnIndex = 0; ColumnIndex < SavedArchetype.NumColumns; ++ColumnIndex)
+        {
+            FSnapshotColumn Column;
+            if (!Reader.Read(Column) || Column.ComponentId >= FComponentRegistry::GetNumComponentTypes() || Signature.Contains(Column.ComponentId))
+            {
+                return false;
+            }
+            const FComponentTypeInfo& TypeInfo = FComponentRegistry::GetTypeInfo(Column.ComponentId);
+            if (TypeInfo.Size != Column.Size || TypeInfo.Alignment != Column.Alignment || TypeInfo.bEntityVersions != (Column.bEntityVersions != 0) ||
+                (SavedArchetype.NumEntities > 0 && TypeInfo.Relocate != nullptr))
+            {
+                return false;
+            }
+            Signature.Add(Column.ComponentId);
+        }
+
+        // Two entries with one signature would restore into the same archetype, the second overwriting the first
+        if (!Signatures.Insert(Signature).second)
+        {
+            return false;
+        }
+
+        // Chunk layouts only depend on the signature, a different capacity means a different build. Every entity
+        // takes more than a byte of chunk, which bounds the count before it goes into any size computation
+        if (SavedArchetype.ChunkCapacity == 0 || SavedArchetype.ChunkCapacity != FArchetype::ComputeChunkCapacity(Signature) ||
+            SavedArchetype.NumEntities > Size)
+        {
+            return false;
+        }
+        Restored.PushBack(FRestoredArchetype{.Signature = Signature, .NumEntities = SavedArchetype.NumEntities,
+            .ChunkCapacity = SavedArchetype.ChunkCapacity, .FirstChunk = NumChunks, .Archetype = nullptr});
+        NumChunks += (SavedArchetype.NumEntities + SavedArchetype.ChunkCapacity - 1) / SavedArchetype.ChunkCapacity;
+        NumArchetypeEntities += SavedArchetype.NumEntities;
+    }
+    if (NumArchetypeEntities != Header.NumEntities || Header.NumEntityRecords > DeferredEntityBit)
+    {
+        return false;
+    }
+
+    const uint8* SavedRecords = Reader.Skip(sizeof(FSnapshotEntityRecord) * static_cast<size64>(Header.NumEntityRecords));
+    const uint8* SavedFreeIndices = Reader.Skip(sizeof(uint32) * static_cast<size64>(Header.NumFreeEntityIndices));
+    if (SavedRecords == nullptr || SavedFreeIndices == nullptr || !Reader.Seek(Header.ChunksOffset) || Reader.Skip(NumChunks * ArchetypeChunkSize) == nullptr)
+    {
+        return false;
+    }
+
+    // Every live record has to point at a row that holds that very entity, so no two records share a row and with
+    // the counts matching every row has its record
+    const uint8* Chunks = Data + Header.ChunksOffset;
+    uint64 NumLiveRecords = 0;
+    for (uint32 Index = 0; Index < Header.NumEntityRecords; ++Index)
+    {
+        const FSnapshotEntityRecord Saved = ReadEntityRecord(SavedRecords, Index);
+        if (Saved.ArchetypeIndex == InvalidArchetype)
+        {
+            continue;
+        }
+        if (Saved.ArchetypeIndex >= Restored.Num())
+        {
+            return false;
+        }
+        const FRestoredArchetype& Entry = Restored[Saved.ArchetypeIndex];
+        if (Saved.Row >= Entry.ChunkCapacity || static_cast<uint64>(Saved.ChunkIndex) * Entry.ChunkCapacity + Saved.Row >= Entry.NumEntities)
+        {
+            return false;
+        }
+        FEntity Stored;
+        FMemory::Copy(Chunks + (Entry.FirstChunk + Saved.ChunkIndex) * ArchetypeChunkSize + sizeof(FEntity) * Saved.Row, &Stored, sizeof(Stored));
+        if (Stored.Index != Index || Stored.Generation != Saved.Generation)
+        {
+            return false;
+        }
+        ++NumLiveRecords;
+    }
+    if (NumLiveRecords != Header.NumEntities)
+    {
+        return false;
+    }
+
+    // Free indices name destroyed records, each at most once, or creating entities would hand out an index twice
+    TBitArray bFreed(Header.NumEntityRecords);
+    for (uint32 FreeIndex = 0; FreeIndex < Header.NumFreeEntityIndices; ++FreeIndex)
+    {
+        uint32 Index;
+        FMemory::Copy(SavedFreeIndices + sizeof(uint32) * FreeIndex, &Index, sizeof(Index));
+        if (Index >= Header.NumEntityRecords || bFreed[Index] || ReadEntityRecord(SavedRecords, Index).ArchetypeIndex != InvalidArchetype)
+        {
+            return false;
+        }
+        bFreed.Set(Index);
+    }
+
+    // Nothing can fail from here on
+    for (FRestoredArchetype& Entry : Restored)
+    {
+        Entry.Archetype = World.FindOrCreateArchetype(Entry.Signature);
+        assert(Entry.Archetype->GetChunkCapacity() == Entry.ChunkCapacity && "Archetype layout differs from the one computed for its signature");
+    }
+
+    for (FComponentId ComponentId = 0; ComponentId < World.SparseSets.Num(); ++ComponentId)
+    {
+        const FSparseSet* Set = World.SparseSets[ComponentId];
+        while (Set != nullptr && !Set->IsEmpty())
+        {
+            World.RemoveSparseComponent(Set->GetEntities().GetLast(), ComponentId);
+        }
+    }
+
+    // Archetypes missing from the snapshot lose their entities, the others take over the saved chunks
+    for (FArchetype* Archetype : World.Archetypes)
+    {
+        Archetype->Clear();
+    }
+    for (const FRestoredArchetype& Entry : Restored)
+    {
+        Entry.Archetype->ResizeForRestore(Entry.NumEntities);
+        for (uint32 ChunkIndex = 0; ChunkIndex < Entry.Archetype->GetNumChunks(); ++ChunkIndex)
+        {
+            FMemory::Copy(Chunks, Entry.Archetype->GetChunk(ChunkIndex).Data, ArchetypeChunkSize);
+            Chunks += ArchetypeChunkSize;
+        }
+    }
+
+    World.EntityRecords.Resize(Header.NumEntityRecords);
+    for (uint32 Index = 0; Index < Header.NumEntityRecords; ++Index)
+    {
+        const FSnapshotEntityRecord Saved = ReadEntityRecord(SavedRecords, Index);
+        World.EntityRecords[Index] = FWorld::FEntityRecord{
+            .Archetype = Saved.ArchetypeIndex != InvalidArchetype ? Restored[Saved.ArchetypeIndex].Archetype : nullptr,
+            .Location = {.ChunkIndex = Saved.ChunkIndex, .Row = Saved.Row},
+            .Generation = Saved.Generation
+        };
+    }
+    World.FreeEntityIndices.ResizeUninitialized(Header.NumFreeEntityIndices);
+    FMemory::Copy(SavedFreeIndices, World.FreeEntityIndices.GetData(), sizeof(uint32) * Header.NumFreeEntityIndices);
+    World.NumEntities = Header.NumEntities;
+    World.ChangeTick = Header.ChangeTick;
+    return true;
+}
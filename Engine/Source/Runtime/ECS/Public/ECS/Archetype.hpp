@@ -0,0 +1,225 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "ECS/Component.hpp"
+#include "ECS/ComponentSignature.hpp"
+#include "ECS/Entity.hpp"
+
+static constexpr size64 ArchetypeChunkSize = 16 * 1024;
+static constexpr uint8 ArchetypeChunkAlignment = 64;
+
+// One fixed size block holding ChunkCapacity entities as structure of arrays: the entity column first,
+// followed by one column per component, each starting on a cache line. The end of the block holds the
+// change versions, per row for components tracking entities and per chunk for every component
+struct FArchetypeChunk
+{
+    uint8* Data = nullptr;
+    uint32 NumEntities = 0;
+};
+
+struct FArchetypeColumn
+{
+    FComponentId ComponentId;
+
+    // Byte offset of the column from the start of every chunk
+    uint32 Offset;
+
+    // Byte offset of the changed versions of every row, followed by their added versions. Zero when the
+    // component is only tracked per chunk
+    uint32 VersionOffset;
+    FComponentTypeInfo TypeInfo;
+};
+
+struct FEntityLocation
+{
+    uint32 ChunkIndex = 0;
+    uint32 Row = 0;
+};
+
+// Storage for all entities sharing exactly one component signature. Rows are kept dense, every chunk
+// but the last one is full, so iteration never has to skip holes
+class ECS_API FArchetype
+{
+public:
+    static constexpr uint32 InvalidColumn = 0xFFFFFFFF;
+
+public:
+    explicit FArchetype(const FComponentSignature& InSignature);
+    ~FArchetype();
+
+    // Rows per chunk an archetype of this signature would have, without creating it. Zero if the components do
+    // not fit into one chunk
+    [[nodiscard]] static uint32 ComputeChunkCapacity(const FComponentSignature& InSignature);
+
+    FArchetype(const FArchetype&) = delete;
+    FArchetype& operator=(const FArchetype&) = delete;
+    FArchetype(FArchetype&&) = delete;
+    FArchetype& operator=(FArchetype&&) = delete;
+
+public:
+    // Appends a row for Entity, the component columns of the new row are left uninitialized and its
+    // versions are zero
+    [[nodiscard]] FEntityLocation AllocateRow(FEntity Entity);
+
+    // Destroys the components of a row, RemoveRow has to follow
+    void DestroyRow(const FEntityLocation& Location);
+
+    // Fills the row with the last row of the archetype, the components of the removed row must already be
+    // destroyed or relocated. Returns the entity that moved into the row, invalid if nothing moved
+    FEntity RemoveRow(const FEntityLocation& Location);
+
+public:
+    // Change ticks of the last write and the last addition of a component anywhere in a chunk
+    [[nodiscard]] uint32 GetChangedVersion(const uint32 ChunkIndex, const uint32 ColumnIndex) const
+    {
+        return GetChunkVersions(ChunkIndex)[ColumnIndex];
+    }
+
+    [[nodiscard]] uint32 GetAddedVersion(const uint32 ChunkIndex, const uint32 ColumnIndex) const
+    {
+        return GetChunkVersions(ChunkIndex)[Columns.Num() + ColumnIndex];
+    }
+
+    // Versions of a single row, the versions of its chunk when the component is only tracked per chunk
+    [[nodiscard]] uint32 GetRowChangedVersion(const FEntityLocation& Location, const uint32 ColumnIndex) const
+    {
+        const uint32* Versions = GetRowVersions(Location.ChunkIndex, ColumnIndex);
+        return Versions != nullptr ? Versions[Location.Row] : GetChangedVersion(Location.ChunkIndex, ColumnIndex);
+    }
+
+    [[nodiscard]] uint32 GetRowAddedVersion(const FEntityLocation& Location, const uint32 ColumnIndex) const
+    {
+        const uint32* Versions = GetRowVersions(Location.ChunkIndex, ColumnIndex);
+        return Versions != nullptr ? Versions[ChunkCapacity + Location.Row] : GetAddedVersion(Location.ChunkIndex, ColumnIndex);
+    }
+
+    // Changed versions of every row followed by their added versions, null when the component is only tracked per chunk
+    [[nodiscard]] uint32* GetRowVersions(const uint32 ChunkIndex, const uint32 ColumnIndex) const
+    {
+        const uint32 VersionOffset = Columns[ColumnIndex].VersionOffset;
+        return VersionOffset != 0 ? reinterpret_cast<uint32*>(Chunks[ChunkIndex].Data + VersionOffset) : nullptr;
+    }
+
+    [[nodiscard]] bool8 HasRowVersions(const uint32 ColumnIndex) const
+    {
+        return Columns[ColumnIndex].VersionOffset != 0;
+    }
+
+    // Stamps every row of the chunk as written at Tick
+    void MarkChanged(uint32 ChunkIndex, uint32 ColumnIndex, uint32 Tick);
+
+    // Stamps a single row as written at Tick
+    void MarkRowChanged(const FEntityLocation& Location, const uint32 ColumnIndex, const uint32 Tick)
+    {
+        if (uint32* Versions = GetRowVersions(Location.ChunkIndex, ColumnIndex))
+        {
+            Versions[Location.Row] = Tick;
+        }
+        GetChunkVersions(Location.ChunkIndex)[ColumnIndex] = Tick;
+    }
+
+    // Gives a row the versions of a component that was created or moved into it, the chunk versions only grow
+    void SetRowVersions(const FEntityLocation& Location, uint32 ColumnIndex, uint32 ChangedTick, uint32 AddedTick);
+
+    // Destroys every row, one chunk is kept as spare
+    void Clear();
+
+    // Sets the number of rows without constructing or destroying any component, chunks are allocated or released
+    // to match. The rows are filled by copying in the raw chunks of an archetype with the same signature, so
+    // every component has to be trivially copyable
+    void ResizeForRestore(size64 InNumEntities);
+
+    // Every component is trivially copyable, so raw copies of the chunks are valid rows
+    [[nodiscard]] bool8 IsTriviallyCopyable() const;
+
+    [[nodiscard]] uint32 FindColumn(FComponentId ComponentId) const;
+
+    [[nodiscard]] void* GetColumnData(const uint32 ChunkIndex, const uint32 ColumnIndex) const
+    {
+        return Chunks[ChunkIndex].Data + Columns[ColumnIndex].Offset;
+    }
+
+    [[nodiscard]] void* GetComponentData(const FEntityLocation& Location, const uint32 ColumnIndex) const
+    {
+        const FArchetypeColumn& Column = Columns[ColumnIndex];
+        return Chunks[Location.ChunkIndex].Data + Column.Offset + static_cast<size64>(Location.Row) * Column.TypeInfo.Size;
+    }
+
+    template <CComponent T>
+    [[nodiscard]] T* GetColumn(const uint32 ChunkIndex, const uint32 ColumnIndex) const
+    {
+        assert(Columns[ColumnIndex].ComponentId == GetComponentId<T>() && "Column does not store this component");
+        return static_cast<T*>(GetColumnData(ChunkIndex, ColumnIndex));
+    }
+
+    [[nodiscard]] FEntity* GetEntities(const uint32 ChunkIndex) const
+    {
+        return reinterpret_cast<FEntity*>(Chunks[ChunkIndex].Data);
+    }
+
+    [[nodiscard]] const FComponentSignature& GetSignature() const noexcept
+    {
+        return Signature;
+    }
+
+    [[nodiscard]] const TArray<FArchetypeColumn>& GetColumns() const noexcept
+    {
+        return Columns;
+    }
+
+    [[nodiscard]] uint32 GetChunkCapacity() const noexcept
+    {
+        return ChunkCapacity;
+    }
+
+    [[nodiscard]] uint32 GetNumChunks() const noexcept
+    {
+        return static_cast<uint32>(Chunks.Num());
+    }
+
+    [[nodiscard]] const FArchetypeChunk& GetChunk(const uint32 ChunkIndex) const
+    {
+        return Chunks[ChunkIndex];
+    }
+
+    [[nodiscard]] size64 GetNumEntities() const noexcept
+    {
+        return NumEntities;
+    }
+
+public:
+    // Cached transitions to the archetype with one component more or less
+    [[nodiscard]] FArchetype* FindAddEdge(FComponentId ComponentId) const;
+    [[nodiscard]] FArchetype* FindRemoveEdge(FComponentId ComponentId) const;
+    void SetAddEdge(FComponentId ComponentId, FArchetype* Target);
+    void SetRemoveEdge(FComponentId ComponentId, FArchetype* Target);
+
+private:
+    // Places the columns in a chunk and returns the chunk capacity, zero if they do not fit
+    [[nodiscard]] static uint32 ComputeLayout(TArray<FArchetypeColumn>& InOutColumns, uint32& OutChunkVersionOffset);
+
+    [[nodiscard]] static TArray<FArchetypeColumn> MakeColumns(const FComponentSignature& InSignature);
+
+    // Changed versions of every column followed by their added versions
+    [[nodiscard]] uint32* GetChunkVersions(const uint32 ChunkIndex) const
+    {
+        return reinterpret_cast<uint32*>(Chunks[ChunkIndex].Data + ChunkVersionOffset);
+    }
+
+private:
+    FComponentSignature Signature;
+    TArray<FArchetypeColumn> Columns;
+    TArray<FArchetypeChunk> Chunks;
+    uint32 ChunkCapacity = 0;
+    uint32 ChunkVersionOffset = 0;
+    size64 NumEntities = 0;
+
+    // The last emptied chunk is kept around so entities churning across a chunk boundary do not allocate
+    uint8* SpareChunkData = nullptr;
+
+    TMap<FComponentId, FArchetype*> AddEdges;
+    TMap<FComponentId, FArchetype*> RemoveEdges;
+};
@@ -0,0 +1,149 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+#include "ECS/Component.hpp"
+#include "ECS/Entity.hpp"
+
+class FWorld;
+
+// Threads that may record commands at the same time, job system threads use their thread index
+static constexpr uint32 MaxCommandBufferThreads = 256;
+
+// Commands are carved out of blocks of this size, blocks are kept for the next frame after playback
+static constexpr uint32 CommandBufferBlockSize = 64 * 1024;
+
+// Entities created through a command buffer are placeholders until playback: the index carries this bit plus
+// the number of the creation within its buffer, the generation carries the index of the buffer
+static constexpr uint32 DeferredEntityBit = 0x80000000;
+
+// Records structural changes while queries or systems run on several threads, FWorld::FlushCommands
+// applies them later. Commands live in a linear arena, so recording never allocates per command.
+// Playback orders the commands of all buffers by their sort key, commands with equal keys keep the order
+// they were recorded in. Use keys that only one thread records, e.g. the index of the processed entity or
+// chunk, to get the same result no matter which thread did the work
+class ECS_API FCommandBuffer
+{
+public:
+    enum class ECommandType : uint8
+    {
+        CreateEntity,
+        DestroyEntity,
+        AddComponent,
+        RemoveComponent
+    };
+
+    using FApplyFunction = void (*)(FWorld& World, FEntity Entity, void* Payload);
+
+    struct FCommand
+    {
+        ECommandType Type;
+        FComponentId ComponentId;
+        uint32 SortKey;
+        FEntity Entity;
+        FApplyFunction Apply;
+
+        // Component moved into the arena by AddComponent, null otherwise
+        void* Payload;
+    };
+
+public:
+    explicit FCommandBuffer(uint32 InBufferIndex);
+    ~FCommandBuffer();
+
+    FCommandBuffer(const FCommandBuffer&) = delete;
+    FCommandBuffer& operator=(const FCommandBuffer&) = delete;
+    FCommandBuffer(FCommandBuffer&&) = delete;
+    FCommandBuffer& operator=(FCommandBuffer&&) = delete;
+
+public:
+    // Returns a placeholder that later commands of this buffer can refer to
+    FEntity CreateEntity(uint32 SortKey);
+
+    void DestroyEntity(uint32 SortKey, FEntity Entity);
+
+    template <CComponent T, typename... TArguments> requires std::is_constructible_v<T, TArguments...>
+    void AddComponent(const uint32 SortKey, const FEntity Entity, TArguments&&... Arguments)
+    {
+        FCommand& Command = AllocateCommand(ECommandType::AddComponent, SortKey, Entity, sizeof(T), alignof(T));
+        Command.ComponentId = GetComponentId<T>();
+        std::construct_at(static_cast<T*>(Command.Payload), std::forward<TArguments>(Arguments)...);
+
+        // Generic lambda so FWorld only has to be complete where a component type is recorded
+        Command.Apply = [](auto& World, const FEntity Target, void* Payload)
+        {
+            T& Component = *static_cast<T*>(Payload);
+            World.template AddComponent<T>(Target, std::move(Component));
+            std::destroy_at(&Component);
+        };
+    }
+
+    template <CComponent T>
+    void RemoveComponent(const uint32 SortKey, const FEntity Entity)
+    {
+        FCommand& Command = AllocateCommand(ECommandType::RemoveComponent, SortKey, Entity, 0, 1);
+        Command.ComponentId = GetComponentId<T>();
+        Command.Apply = [](auto& World, const FEntity Target, void*)
+        {
+            World.template RemoveComponent<T>(Target);
+        };
+    }
+
+    // Destroys recorded payloads and rewinds the arena, the blocks stay allocated
+    void Clear();
+
+    [[nodiscard]] const TArray<FCommand*>& GetCommands() const noexcept
+    {
+        return Commands;
+    }
+
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Commands.Num();
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return Commands.IsEmpty();
+    }
+
+    [[nodiscard]] uint32 GetBufferIndex() const noexcept
+    {
+        return BufferIndex;
+    }
+
+    [[nodiscard]] static bool8 IsDeferredEntity(const FEntity Entity) noexcept
+    {
+        return Entity.Index != FEntity::InvalidIndex && (Entity.Index & DeferredEntityBit) != 0;
+    }
+
+private:
+    friend class FWorld;
+
+    // The command and its payload are placed in the current block, a new block is started when they do not fit
+    FCommand& AllocateCommand(ECommandType Type, uint32 SortKey, FEntity Entity, size64 PayloadSize, size64 PayloadAlignment);
+
+    [[nodiscard]] uint8* AllocateBytes(size64 Size, size64 Alignment);
+
+private:
+    struct FBlock
+    {
+        uint8* Data;
+        size64 Size;
+    };
+
+    TArray<FCommand*> Commands;
+    TArray<FBlock> Blocks;
+    uint32 CurrentBlock = 0;
+    size64 BlockOffset = 0;
+    uint32 BufferIndex;
+
+    // Real entities of the placeholders, filled in while the buffer is played back
+    TArray<FEntity> CreatedEntities;
+    uint32 NumCreatedEntities = 0;
+};
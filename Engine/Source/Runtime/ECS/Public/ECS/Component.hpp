@@ -0,0 +1,120 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <type_traits>
+
+using FComponentId = uint32;
+
+static constexpr uint32 MaxComponentTypes = 256;
+
+template <typename T>
+concept CComponent = std::is_object_v<T> && !std::is_const_v<T> && !std::is_array_v<T> &&
+    std::is_move_constructible_v<T> && std::is_nothrow_destructible_v<T>;
+
+enum class EComponentStorage : uint8
+{
+    // Stored in the chunks of the entity's archetype, best for components that stay on an entity
+    Archetype,
+
+    // Stored in a sparse set next to the archetypes, adding and removing never moves the entity
+    SparseSet
+};
+
+// Components opt into sparse set storage with a static constexpr EComponentStorage Storage member
+template <typename T>
+concept CSparseComponent = CComponent<T> && requires { requires T::Storage == EComponentStorage::SparseSet; };
+
+// Queries list a component as const to only read it, every other listed component counts as written
+template <typename T>
+concept CQueryComponent = CComponent<std::remove_const_t<T>>;
+
+enum class EChangeTracking : uint8
+{
+    // One version per chunk and component, change filters skip whole chunks but pass every entity of a touched one
+    Chunk,
+
+    // Additionally one version per entity, so change filters also skip the untouched entities of a touched chunk
+    Entity
+};
+
+// Components opt into per entity versions with a static constexpr EChangeTracking ChangeTracking member
+template <typename T>
+concept CEntityTrackedComponent = CComponent<T> && requires { requires T::ChangeTracking == EChangeTracking::Entity; };
+
+// Type erased operations the archetype storage needs to move and destroy components it only knows by id
+struct FComponentTypeInfo
+{
+    // Move constructs Count elements from Source into uninitialized Target and destroys the sources
+    using FRelocateFunction = void (*)(void* Target, void* Source, size64 Count);
+    using FDestroyFunction = void (*)(void* Target, size64 Count);
+
+    uint32 Size;
+    uint32 Alignment;
+
+    // Null when the component is trivially copyable, a plain memory copy relocates it
+    FRelocateFunction Relocate;
+
+    // Null when the component is trivially destructible
+    FDestroyFunction Destroy;
+
+    // Archetypes keep a change and an added version per row for this component
+    bool8 bEntityVersions;
+};
+
+template <CComponent T>
+[[nodiscard]] constexpr FComponentTypeInfo MakeComponentTypeInfo()
+{
+    FComponentTypeInfo TypeInfo{.Size = sizeof(T), .Alignment = alignof(T), .Relocate = nullptr, .Destroy = nullptr,
+        .bEntityVersions = CEntityTrackedComponent<T>};
+    if constexpr (!std::is_trivially_copyable_v<T>)
+    {
+        TypeInfo.Relocate = [](void* Target, void* Source, const size64 Count)
+        {
+            T* Sources = static_cast<T*>(Source);
+            std::uninitialized_move_n(Sources, Count, static_cast<T*>(Target));
+            std::destroy_n(Sources, Count);
+        };
+    }
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        TypeInfo.Destroy = [](void* Target, const size64 Count)
+        {
+            std::destroy_n(static_cast<T*>(Target), Count);
+        };
+    }
+    return TypeInfo;
+}
+
+// Identifies T by the signature the compiler gives this function, which names T and reads the same in every module
+// of one build. Types in anonymous namespaces are spelled alike in every file, so their names must not repeat
+template <typename T>
+[[nodiscard]] constexpr std::string_view GetComponentTypeKey()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+class ECS_API FComponentRegistry
+{
+public:
+    // Returns the id TypeKey already has if another module registered it first
+    [[nodiscard]] static FComponentId Register(std::string_view TypeKey, const FComponentTypeInfo& TypeInfo);
+
+    [[nodiscard]] static const FComponentTypeInfo& GetTypeInfo(FComponentId ComponentId);
+    [[nodiscard]] static uint32 GetNumComponentTypes();
+};
+
+// Ids are handed out on first use, so they are only stable within one run of the process. Every module caches the
+// id in its own copy of the static, the registry in the ECS module makes sure they all agree
+template <CComponent T>
+[[nodiscard]] FComponentId GetComponentId()
+{
+    static const FComponentId ComponentId = FComponentRegistry::Register(GetComponentTypeKey<T>(), MakeComponentTypeInfo<T>());
+    return ComponentId;
+}
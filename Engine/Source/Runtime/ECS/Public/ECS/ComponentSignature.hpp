@@ -0,0 +1,89 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <cassert>
+#include <functional>
+
+#include "Core/Containers/BitArray.hpp"
+#include "ECS/Component.hpp"
+
+// Set of component ids as a fixed bitset, identifies an archetype and describes what a query requires
+class FComponentSignature
+{
+public:
+    constexpr FComponentSignature() = default;
+
+    template <CComponent... TComponents>
+    [[nodiscard]] static FComponentSignature Make()
+    {
+        FComponentSignature Signature;
+        (Signature.Add(GetComponentId<TComponents>()), ...);
+        return Signature;
+    }
+
+public:
+    constexpr void Add(const FComponentId ComponentId)
+    {
+        assert(ComponentId < MaxComponentTypes && "Component id out of range");
+        Bits.Set(ComponentId);
+    }
+
+    constexpr void Remove(const FComponentId ComponentId)
+    {
+        assert(ComponentId < MaxComponentTypes && "Component id out of range");
+        Bits.Reset(ComponentId);
+    }
+
+    [[nodiscard]] constexpr bool8 Contains(const FComponentId ComponentId) const
+    {
+        assert(ComponentId < MaxComponentTypes && "Component id out of range");
+        return Bits.Test(ComponentId);
+    }
+
+    [[nodiscard]] constexpr bool8 ContainsAll(const FComponentSignature& Other) const
+    {
+        return Bits.ContainsAll(Other.Bits);
+    }
+
+    [[nodiscard]] constexpr bool8 ContainsAny(const FComponentSignature& Other) const
+    {
+        return Bits.ContainsAny(Other.Bits);
+    }
+
+    [[nodiscard]] constexpr bool8 IsEmpty() const
+    {
+        return !Bits.AnySet();
+    }
+
+    [[nodiscard]] constexpr uint32 Num() const
+    {
+        return static_cast<uint32>(Bits.CountSetBits());
+    }
+
+    // Calls Function(FComponentId) for every contained id in ascending order
+    template <typename TFunction>
+    constexpr void ForEach(const TFunction& Function) const
+    {
+        Bits.ForEachSetBit([&Function](const size64 Index) { Function(static_cast<FComponentId>(Index)); });
+    }
+
+    [[nodiscard]] constexpr size64 GetHash() const
+    {
+        return Bits.GetHash();
+    }
+
+    constexpr bool8 operator==(const FComponentSignature& Other) const = default;
+
+private:
+    TStaticBitArray<MaxComponentTypes> Bits;
+};
+
+template <>
+struct std::hash<FComponentSignature>
+{
+    size64 operator()(const FComponentSignature& Signature) const noexcept
+    {
+        return Signature.GetHash();
+    }
+};
@@ -0,0 +1,42 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <functional>
+
+// Index into the world's entity records plus the generation of that record when the entity was created,
+// a destroyed entity keeps failing lookups after its index got recycled
+struct FEntity
+{
+    static constexpr uint32 InvalidIndex = 0xFFFFFFFF;
+    static constexpr uint32 MaxGeneration = 0xFFFFFFFF;
+
+    uint32 Index = InvalidIndex;
+    uint32 Generation = 0;
+
+    [[nodiscard]] constexpr bool8 IsValid() const noexcept
+    {
+        return Index != InvalidIndex;
+    }
+
+    [[nodiscard]] constexpr uint64 ToId() const noexcept
+    {
+        return static_cast<uint64>(Generation) << 32 | Index;
+    }
+
+    [[nodiscard]] static constexpr FEntity FromId(const uint64 Id) noexcept
+    {
+        return FEntity{.Index = static_cast<uint32>(Id), .Generation = static_cast<uint32>(Id >> 32)};
+    }
+
+    constexpr bool8 operator==(const FEntity& Other) const noexcept = default;
+};
+
+template <>
+struct std::hash<FEntity>
+{
+    size64 operator()(const FEntity& Entity) const noexcept
+    {
+        return std::hash<uint64>{}(Entity.ToId());
+    }
+};
@@ -0,0 +1,67 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "ECS/Component.hpp"
+
+// Restricts a query to entities whose components were written or added after a change tick, see
+// FWorld::AdvanceChangeTick. All terms have to pass, chunks failing a term are skipped without looking at
+// their entities. Only components stored in archetypes carry versions
+class FQueryFilter
+{
+public:
+    static constexpr uint32 MaxTerms = 8;
+
+    struct FTerm
+    {
+        FComponentId ComponentId;
+        uint32 SinceTick;
+
+        // Tests the version of the last addition instead of the last write
+        bool8 bAdded;
+    };
+
+public:
+    // Passes components written after SinceTick, either through a query listing them without const, a
+    // mutable GetComponent or by being added
+    template <CComponent T> requires (!CSparseComponent<T>)
+    FQueryFilter& Changed(const uint32 SinceTick)
+    {
+        return AddTerm(FTerm{.ComponentId = GetComponentId<T>(), .SinceTick = SinceTick, .bAdded = false});
+    }
+
+    // Passes components added to their entity after SinceTick, including entities created since then
+    template <CComponent T> requires (!CSparseComponent<T>)
+    FQueryFilter& Added(const uint32 SinceTick)
+    {
+        return AddTerm(FTerm{.ComponentId = GetComponentId<T>(), .SinceTick = SinceTick, .bAdded = true});
+    }
+
+    [[nodiscard]] const FTerm& operator[](const uint32 Index) const
+    {
+        assert(Index < NumTerms && "Filter term out of range");
+        return Terms[Index];
+    }
+
+    [[nodiscard]] uint32 Num() const noexcept
+    {
+        return NumTerms;
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return NumTerms == 0;
+    }
+
+private:
+    FQueryFilter& AddTerm(const FTerm& Term)
+    {
+        assert(NumTerms < MaxTerms && "Too many terms in one query filter");
+        Terms[NumTerms++] = Term;
+        return *this;
+    }
+
+private:
+    FTerm Terms[MaxTerms] = {};
+    uint32 NumTerms = 0;
+};
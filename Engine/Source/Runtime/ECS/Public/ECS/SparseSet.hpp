@@ -0,0 +1,221 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+#include "ECS/Component.hpp"
+#include "ECS/Entity.hpp"
+
+class FSparseGroup;
+
+// Entities per sparse page, pages are only allocated for index ranges that are actually used
+static constexpr uint32 SparseSetPageSize = 4096;
+
+// Dense array of entities plus a paged sparse index from entity index to dense index. Adding and removing is
+// O(1) without touching any other storage, which makes it the right home for components that come and go
+// every frame
+class ECS_API FSparseSet
+{
+public:
+    static constexpr uint32 InvalidIndex = 0xFFFFFFFF;
+
+public:
+    FSparseSet() = default;
+    virtual ~FSparseSet();
+
+    FSparseSet(const FSparseSet&) = delete;
+    FSparseSet& operator=(const FSparseSet&) = delete;
+    FSparseSet(FSparseSet&&) = delete;
+    FSparseSet& operator=(FSparseSet&&) = delete;
+
+public:
+    // Removes the entity and its component, moving the last entry into the hole
+    void Remove(FEntity Entity);
+
+    // Swaps two dense entries together with their components
+    void SwapEntries(uint32 DenseIndexA, uint32 DenseIndexB);
+
+    // Moves the entities this set shares with Other to the front, in the order Other stores them, so both
+    // sets can be walked side by side
+    void SortAs(const FSparseSet& Other);
+
+    [[nodiscard]] uint32 GetDenseIndex(const FEntity Entity) const
+    {
+        const uint32 PageIndex = Entity.Index / SparseSetPageSize;
+        if (PageIndex >= Pages.Num() || Pages[PageIndex] == nullptr)
+        {
+            return InvalidIndex;
+        }
+        const uint32 DenseIndex = Pages[PageIndex][Entity.Index % SparseSetPageSize];
+        return DenseIndex != InvalidIndex && Entities[DenseIndex] == Entity ? DenseIndex : InvalidIndex;
+    }
+
+    [[nodiscard]] bool8 Contains(const FEntity Entity) const
+    {
+        return GetDenseIndex(Entity) != InvalidIndex;
+    }
+
+    [[nodiscard]] const TArray<FEntity>& GetEntities() const noexcept
+    {
+        return Entities;
+    }
+
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Entities.Num();
+    }
+
+    [[nodiscard]] bool8 IsEmpty() const noexcept
+    {
+        return Entities.IsEmpty();
+    }
+
+    [[nodiscard]] FSparseGroup* GetOwningGroup() const noexcept
+    {
+        return OwningGroup;
+    }
+
+    void SetOwningGroup(FSparseGroup* InOwningGroup) noexcept
+    {
+        OwningGroup = InOwningGroup;
+    }
+
+protected:
+    // Appends the entity to the dense array and returns its dense index
+    uint32 AddEntity(FEntity Entity);
+
+    virtual void SwapComponents(uint32 DenseIndexA, uint32 DenseIndexB) = 0;
+
+    // Removes the component at DenseIndex by moving the last component into it
+    virtual void RemoveComponentAt(uint32 DenseIndex) = 0;
+
+private:
+    void SetSparseIndex(uint32 EntityIndex, uint32 DenseIndex);
+
+private:
+    TArray<FEntity> Entities;
+    TArray<uint32*> Pages;
+    FSparseGroup* OwningGroup = nullptr;
+};
+
+template <CComponent T>
+class TSparseSet final : public FSparseSet
+{
+public:
+    using ValueType = T;
+
+public:
+    template <typename... TArguments> requires std::is_constructible_v<T, TArguments...>
+    T& Emplace(const FEntity Entity, TArguments&&... Arguments)
+    {
+        assert(!Contains(Entity) && "Entity already has this component");
+        AddEntity(Entity);
+        return Components.EmplaceBack(std::forward<TArguments>(Arguments)...);
+    }
+
+    [[nodiscard]] T* Find(const FEntity Entity)
+    {
+        const uint32 DenseIndex = GetDenseIndex(Entity);
+        return DenseIndex != InvalidIndex ? &Components[DenseIndex] : nullptr;
+    }
+
+    [[nodiscard]] const T* Find(const FEntity Entity) const
+    {
+        const uint32 DenseIndex = GetDenseIndex(Entity);
+        return DenseIndex != InvalidIndex ? &Components[DenseIndex] : nullptr;
+    }
+
+    [[nodiscard]] T& Get(const FEntity Entity)
+    {
+        const uint32 DenseIndex = GetDenseIndex(Entity);
+        assert(DenseIndex != InvalidIndex && "Entity does not have this component");
+        return Components[DenseIndex];
+    }
+
+    [[nodiscard]] T* GetData() noexcept
+    {
+        return Components.GetData();
+    }
+
+    [[nodiscard]] const T* GetData() const noexcept
+    {
+        return Components.GetData();
+    }
+
+public:
+    [[nodiscard]] T* begin() noexcept
+    {
+        return Components.begin();
+    }
+
+    [[nodiscard]] const T* begin() const noexcept
+    {
+        return Components.begin();
+    }
+
+    [[nodiscard]] T* end() noexcept
+    {
+        return Components.end();
+    }
+
+    [[nodiscard]] const T* end() const noexcept
+    {
+        return Components.end();
+    }
+
+protected:
+    void SwapComponents(const uint32 DenseIndexA, const uint32 DenseIndexB) override
+    {
+        std::swap(Components[DenseIndexA], Components[DenseIndexB]);
+    }
+
+    void RemoveComponentAt(const uint32 DenseIndex) override
+    {
+        Components.RemoveAtSwap(DenseIndex);
+    }
+
+private:
+    TArray<T> Components;
+};
+
+// Owning group over several sparse sets: the first GetSize() entries of every owned set are the entities
+// having all of the owned components, in the same order, so iterating the group is a lockstep walk over
+// plain arrays without any lookups. The world keeps the group up to date on every add and remove
+class ECS_API FSparseGroup
+{
+public:
+    explicit FSparseGroup(TArray<FSparseSet*> InOwnedSets);
+    ~FSparseGroup();
+
+    FSparseGroup(const FSparseGroup&) = delete;
+    FSparseGroup& operator=(const FSparseGroup&) = delete;
+    FSparseGroup(FSparseGroup&&) = delete;
+    FSparseGroup& operator=(FSparseGroup&&) = delete;
+
+public:
+    // Must be called after the entity received an owned component
+    void HandleAdded(FEntity Entity);
+
+    // Must be called before the entity loses an owned component
+    void HandleRemoving(FEntity Entity);
+
+    [[nodiscard]] bool8 Owns(const FSparseSet* Set) const;
+
+    [[nodiscard]] const TArray<FSparseSet*>& GetOwnedSets() const noexcept
+    {
+        return OwnedSets;
+    }
+
+    [[nodiscard]] uint32 GetSize() const noexcept
+    {
+        return Size;
+    }
+
+private:
+    TArray<FSparseSet*> OwnedSets;
+    uint32 Size = 0;
+};
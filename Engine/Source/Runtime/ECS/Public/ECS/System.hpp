@@ -0,0 +1,120 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/String.hpp"
+#include "ECS/Component.hpp"
+#include "ECS/ComponentSignature.hpp"
+
+class FWorld;
+
+// Components a system reads and writes. Two systems may run at the same time unless one of them writes a
+// component the other one touches, or one of them is exclusive
+struct FSystemAccess
+{
+    FComponentSignature Reads;
+    FComponentSignature Writes;
+
+    // Exclusive systems run alone, e.g. because they make structural changes to the world directly
+    bool8 bExclusive = false;
+
+    template <CComponent... TComponents>
+    FSystemAccess& Read()
+    {
+        (Reads.Add(GetComponentId<TComponents>()), ...);
+        return *this;
+    }
+
+    template <CComponent... TComponents>
+    FSystemAccess& Write()
+    {
+        (Writes.Add(GetComponentId<TComponents>()), ...);
+        return *this;
+    }
+
+    FSystemAccess& Exclusive()
+    {
+        bExclusive = true;
+        return *this;
+    }
+
+    [[nodiscard]] bool8 ConflictsWith(const FSystemAccess& Other) const
+    {
+        return bExclusive || Other.bExclusive || Writes.ContainsAny(Other.Reads) || Writes.ContainsAny(Other.Writes) || Other.Writes.ContainsAny(Reads);
+    }
+};
+
+class FSystem
+{
+public:
+    FSystem(FAnsiString InName, const FSystemAccess& InAccess)
+        : Name(std::move(InName)), Access(InAccess)
+    {
+    }
+
+    virtual ~FSystem() = default;
+
+    FSystem(const FSystem&) = delete;
+    FSystem& operator=(const FSystem&) = delete;
+    FSystem(FSystem&&) = delete;
+    FSystem& operator=(FSystem&&) = delete;
+
+public:
+    // May run concurrently with any system whose access does not conflict
+    virtual void Execute(FWorld& World) = 0;
+
+    [[nodiscard]] const FAnsiString& GetName() const noexcept
+    {
+        return Name;
+    }
+
+    [[nodiscard]] const FSystemAccess& GetAccess() const noexcept
+    {
+        return Access;
+    }
+
+    // Change tick the system last ran at, filter with it to only see what changed since then
+    [[nodiscard]] uint32 GetLastRunTick() const noexcept
+    {
+        return LastRunTick;
+    }
+
+private:
+    friend class FSystemScheduler;
+
+    FAnsiString Name;
+    FSystemAccess Access;
+    uint32 LastRunTick = 0;
+};
+
+template <typename TFunction>
+concept CSystemFunction = std::is_invocable_v<TFunction&, FWorld&> || std::is_invocable_v<TFunction&, FWorld&, const FSystem&>;
+
+// System running a callable, Function(FWorld&) or Function(FWorld&, const FSystem&)
+template <CSystemFunction TFunction>
+class TFunctionSystem final : public FSystem
+{
+public:
+    TFunctionSystem(FAnsiString InName, const FSystemAccess& InAccess, TFunction InFunction)
+        : FSystem(std::move(InName), InAccess), Function(std::move(InFunction))
+    {
+    }
+
+    void Execute(FWorld& World) override
+    {
+        if constexpr (std::is_invocable_v<TFunction&, FWorld&, const FSystem&>)
+        {
+            Function(World, static_cast<const FSystem&>(*this));
+        }
+        else
+        {
+            Function(World);
+        }
+    }
+
+private:
+    TFunction Function;
+};
@@ -0,0 +1,99 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/String.hpp"
+#include "Core/Logging/LogManager.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "ECS/System.hpp"
+
+ECS_API DECLARE_LOG_CHANNEL_EXTERN(ECS)
+
+// Runs systems on the job system. Each system depends on every system added before it whose access
+// conflicts with its own, and is placed in the first stage after all of its dependencies. Systems of one
+// stage run concurrently, stages run one after the other, so conflicting systems keep the order they were
+// added in. Systems can split their own queries further with FWorld::ParallelEach and record structural
+// changes into FWorld::GetCommandBuffer, the commands are played back after each stage. Every stage and
+// every playback starts a new change tick, systems filter with FSystem::GetLastRunTick to only process
+// what changed since they last ran
+class ECS_API FSystemScheduler
+{
+public:
+    struct FSystemTiming
+    {
+        uint32 Stage;
+        uint32 ThreadIndex;
+        float64 Milliseconds;
+    };
+
+public:
+    FSystemScheduler() = default;
+    ~FSystemScheduler();
+
+    FSystemScheduler(const FSystemScheduler&) = delete;
+    FSystemScheduler& operator=(const FSystemScheduler&) = delete;
+    FSystemScheduler(FSystemScheduler&&) = delete;
+    FSystemScheduler& operator=(FSystemScheduler&&) = delete;
+
+public:
+    // Takes ownership of a system allocated with FMemory::New
+    FSystem& AddSystem(FSystem* System);
+
+    template <typename TFunction> requires CSystemFunction<std::decay_t<TFunction>>
+    FSystem& AddSystem(FAnsiString Name, const FSystemAccess& Access, TFunction&& Function)
+    {
+        return AddSystem(FMemory::New<TFunctionSystem<std::decay_t<TFunction>>>(std::move(Name), Access, std::forward<TFunction>(Function)));
+    }
+
+    // Executes every system once and records its timing
+    void Run(FWorld& World);
+
+    // One line per stage listing its systems, each with the systems it waits for
+    [[nodiscard]] FAnsiString DescribeSchedule();
+
+    // Timing of every system during the last Run, in the order the systems were added
+    [[nodiscard]] const TArray<FSystemTiming>& GetTimings() const noexcept
+    {
+        return Timings;
+    }
+
+    // Logs the schedule and the timings of every frame to LogECS
+    void SetFrameLogging(const bool8 bEnabled) noexcept
+    {
+        bFrameLogging = bEnabled;
+    }
+
+    [[nodiscard]] size64 GetNumSystems() const noexcept
+    {
+        return Systems.Num();
+    }
+
+    [[nodiscard]] uint32 GetNumStages()
+    {
+        BuildSchedule();
+        return static_cast<uint32>(StageOffsets.Num() - 1);
+    }
+
+private:
+    void BuildSchedule();
+
+private:
+    TArray<FSystem*> Systems;
+
+    // Dependencies of system I are DependencyIndices[DependencyOffsets[I], DependencyOffsets[I + 1])
+    TArray<uint32> DependencyOffsets;
+    TArray<uint32> DependencyIndices;
+
+    // Systems of stage I are StageSystems[StageOffsets[I], StageOffsets[I + 1])
+    TArray<uint32> StageOffsets;
+    TArray<uint32> StageSystems;
+    TArray<uint32> SystemStages;
+
+    TArray<FSystemTiming> Timings;
+    bool8 bScheduleDirty = true;
+    bool8 bFrameLogging = false;
+};
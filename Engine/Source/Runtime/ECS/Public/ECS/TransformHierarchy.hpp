@@ -0,0 +1,96 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/HandlePool.hpp"
+#include "Core/Math/Matrix.hpp"
+
+using FTransformHandle = FHandle64;
+
+// Scene graph of transforms stored as structure of arrays: local transforms, world transforms, parents and
+// dirty flags are separate TArray columns indexed by node. Update keeps the nodes sorted breadth first, so
+// every depth level is a contiguous range and parents precede their children, then recomputes the world
+// transforms of dirty nodes and everything below them in one linear sweep per level. Levels large enough
+// are split across the job system. Handles stay valid while the nodes move around
+class ECS_API FTransformHierarchy
+{
+public:
+    static constexpr uint32 InvalidIndex = 0xFFFFFFFF;
+
+    // Nodes per job when a level is split across the job system
+    static constexpr uint32 NodesPerTask = 8192;
+
+public:
+    FTransformHierarchy() = default;
+
+    // Adds a node below Parent, or a root when Parent is invalid. Its world transform is computed by the next Update
+    FTransformHandle AddNode(const FMatrix44& Local, FTransformHandle Parent = {});
+
+    // Removes the node together with all of its descendants
+    void RemoveNode(FTransformHandle Handle);
+
+    // Moves the node and its descendants below Parent, or makes it a root when Parent is invalid. Parent must
+    // not be part of the moved subtree
+    void SetParent(FTransformHandle Handle, FTransformHandle Parent);
+
+    void SetLocal(FTransformHandle Handle, const FMatrix44& Local);
+
+    [[nodiscard]] const FMatrix44& GetLocal(FTransformHandle Handle) const
+    {
+        return LocalTransforms[GetNodeIndex(Handle)];
+    }
+
+    // As of the last Update
+    [[nodiscard]] const FMatrix44& GetWorld(FTransformHandle Handle) const
+    {
+        return WorldTransforms[GetNodeIndex(Handle)];
+    }
+
+    // Invalid for roots
+    [[nodiscard]] FTransformHandle GetParent(FTransformHandle Handle) const;
+
+    [[nodiscard]] bool8 Contains(FTransformHandle Handle) const noexcept;
+
+    // Recomputes the world transforms of dirty subtrees
+    void Update();
+
+    [[nodiscard]] size64 Num() const noexcept
+    {
+        return Parents.Num();
+    }
+
+    // Depth levels as of the last Update
+    [[nodiscard]] uint32 GetNumLevels() const noexcept
+    {
+        return LevelOffsets.IsEmpty() ? 0 : static_cast<uint32>(LevelOffsets.Num() - 1);
+    }
+
+private:
+    [[nodiscard]] uint32 GetNodeIndex(FTransformHandle Handle) const;
+
+    // Stable counting sort of the nodes by depth, rebuilding the level ranges
+    void SortBreadthFirst();
+
+    // Recomputes Depths, parents may follow their children after SetParent
+    void ComputeDepths();
+
+    void UpdateRange(uint32 Begin, uint32 End);
+
+private:
+    // Columns, one entry per node
+    TArray<FMatrix44> LocalTransforms;
+    TArray<FMatrix44> WorldTransforms;
+    TArray<uint32> Parents;
+    TArray<uint32> Depths;
+    TArray<uint8> DirtyFlags;
+    TArray<uint32> NodeSlots;
+
+    // Handles to node indices, kept up to date as nodes move
+    THandleSlots<FTransformHandle> Slots;
+
+    // Nodes of level I are [LevelOffsets[I], LevelOffsets[I + 1]) while the order is not dirty
+    TArray<uint32> LevelOffsets;
+    bool8 bOrderDirty = false;
+    bool8 bAnyDirty = false;
+};
@@ -0,0 +1,693 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Core/Containers/Array.hpp"
+#include "Core/Containers/Map.hpp"
+#include "Core/Containers/StaticArray.hpp"
+#include "Core/Memory/Memory.hpp"
+#include "Core/Threading/JobSystem.hpp"
+#include "ECS/Archetype.hpp"
+#include "ECS/CommandBuffer.hpp"
+#include "ECS/Component.hpp"
+#include "ECS/ComponentSignature.hpp"
+#include "ECS/Entity.hpp"
+#include "ECS/QueryFilter.hpp"
+#include "ECS/SparseSet.hpp"
+
+// Owns all entities and their archetypes. Adding or removing a component moves the entity into the
+// archetype of its new signature, queries visit every archetype containing the requested components
+// chunk by chunk. Components declared as sparse live in per component sparse sets instead, so toggling them
+// never moves the entity. Structural changes must not happen while a query is running.
+// Archetype components carry change versions: writes and additions are stamped with the current change
+// tick, so queries with a FQueryFilter only visit what changed since an earlier tick
+class ECS_API FWorld
+{
+public:
+    FWorld();
+    ~FWorld();
+
+    FWorld(const FWorld&) = delete;
+    FWorld& operator=(const FWorld&) = delete;
+    FWorld(FWorld&&) = delete;
+    FWorld& operator=(FWorld&&) = delete;
+
+public:
+    FEntity CreateEntity();
+
+    template <typename... TComponents> requires (sizeof...(TComponents) > 0 && (CComponent<std::remove_cvref_t<TComponents>> && ...))
+    FEntity CreateEntity(TComponents&&... Components)
+    {
+        const FComponentSignature Signature = MakeArchetypeSignature<std::remove_cvref_t<TComponents>...>();
+        assert(Signature.Num() == (static_cast<uint32>(!CSparseComponent<std::remove_cvref_t<TComponents>>) + ...) && "Each component type can only be passed once");
+        FArchetype* Archetype = FindOrCreateArchetype(Signature);
+        const FEntity Entity = CreateEntityInArchetype(Archetype);
+        (ConstructComponent<std::remove_cvref_t<TComponents>>(Entity, std::forward<TComponents>(Components)), ...);
+        return Entity;
+    }
+
+    void DestroyEntity(FEntity Entity);
+
+    [[nodiscard]] bool8 IsAlive(FEntity Entity) const;
+
+    // Replaces the component if the entity already has one
+    template <CComponent T, typename... TArguments> requires std::is_constructible_v<T, TArguments...>
+    T& AddComponent(const FEntity Entity, TArguments&&... Arguments)
+    {
+        T* Existing = GetComponent<T>(Entity);
+        if (Existing != nullptr)
+        {
+            std::destroy_at(Existing);
+            return *std::construct_at(Existing, std::forward<TArguments>(Arguments)...);
+        }
+        if constexpr (CSparseComponent<T>)
+        {
+            return ConstructComponent<T>(Entity, std::forward<TArguments>(Arguments)...);
+        }
+        else
+        {
+            return *std::construct_at(static_cast<T*>(AddComponentStorage(Entity, GetComponentId<T>())), std::forward<TArguments>(Arguments)...);
+        }
+    }
+
+    template <CComponent T>
+    void RemoveComponent(const FEntity Entity)
+    {
+        if constexpr (CSparseComponent<T>)
+        {
+            assert(IsAlive(Entity) && "Entity is not alive");
+            RemoveSparseComponent(Entity, GetComponentId<T>());
+        }
+        else
+        {
+            RemoveComponentStorage(Entity, GetComponentId<T>());
+        }
+    }
+
+    template <CComponent T>
+    [[nodiscard]] bool8 HasComponent(const FEntity Entity) const
+    {
+        return GetComponent<T>(Entity) != nullptr;
+    }
+
+    // Stamps archetype components as written, read through the const overload to keep their version
+    template <CComponent T>
+    [[nodiscard]] T* GetComponent(const FEntity Entity)
+    {
+        if constexpr (CSparseComponent<T>)
+        {
+            return const_cast<T*>(std::as_const(*this).template GetComponent<T>(Entity));
+        }
+        else
+        {
+            return static_cast<T*>(FindMutableComponentStorage(Entity, GetComponentId<T>()));
+        }
+    }
+
+    template <CComponent T>
+    [[nodiscard]] const T* GetComponent(const FEntity Entity) const
+    {
+        if constexpr (CSparseComponent<T>)
+        {
+            assert(IsAlive(Entity) && "Entity is not alive");
+            const TSparseSet<T>* Set = FindSparseSet<T>();
+            return Set != nullptr ? Set->Find(Entity) : nullptr;
+        }
+        else
+        {
+            return static_cast<const T*>(FindComponentStorage(Entity, GetComponentId<T>()));
+        }
+    }
+
+    // Storage of a sparse component, null until the first entity received one
+    template <CSparseComponent T>
+    [[nodiscard]] TSparseSet<T>* FindSparseSet() const
+    {
+        return static_cast<TSparseSet<T>*>(FindSparseSet(GetComponentId<T>()));
+    }
+
+    // Lets the sparse sets of the listed components own their common entities, EachGroup then walks them
+    // in lockstep. A sparse set can only be owned by one group
+    template <CSparseComponent... TComponents> requires (sizeof...(TComponents) > 1)
+    void CreateGroup()
+    {
+        TArray<FSparseSet*> Sets;
+        (Sets.PushBack(&GetOrCreateSparseSet<TComponents>()), ...);
+        Groups.PushBack(FMemory::New<FSparseGroup>(std::move(Sets)));
+    }
+
+public:
+    // Calls Function(const FEntity* Entities, size64 NumEntities, TComponents*... Columns) once per non empty chunk.
+    // Components listed without const are stamped as written for the whole chunk
+    template <CQueryComponent... TComponents, typename TFunction>
+    void EachChunk(const TFunction& Function)
+    {
+        EachChunk<TComponents...>(FQueryFilter(), Function);
+    }
+
+    // Like EachChunk, but skips the chunks failing the filter. The entities of a passing chunk are not filtered
+    template <CQueryComponent... TComponents, typename TFunction>
+    void EachChunk(const FQueryFilter& Filter, const TFunction& Function)
+    {
+        static_assert(!(CSparseComponent<std::remove_const_t<TComponents>> || ...), "Sparse components are not stored in chunks");
+        ForEachQueryChunk<TComponents...>(Filter, MakeChunkVisitor<TComponents...>(Function));
+    }
+
+    // Calls Function(TComponents&...) or Function(FEntity, TComponents&...) for every matching entity. Queries
+    // touching sparse components walk whichever is smaller, the smallest sparse set or the matching archetypes,
+    // and probe the remaining components per entity
+    template <CQueryComponent... TComponents, typename TFunction>
+    void Each(const TFunction& Function)
+    {
+        if constexpr ((CSparseComponent<std::remove_const_t<TComponents>> || ...))
+        {
+            EachWithSparseSets<TComponents...>(Function, std::index_sequence_for<TComponents...>());
+        }
+        else
+        {
+            Each<TComponents...>(FQueryFilter(), Function);
+        }
+    }
+
+    // Like Each, but only visits entities passing the filter. Chunks failing it are skipped as a whole, within
+    // a passing chunk components tracking entities are tested per entity
+    template <CQueryComponent... TComponents, typename TFunction>
+    void Each(const FQueryFilter& Filter, const TFunction& Function)
+    {
+        static_assert(!(CSparseComponent<std::remove_const_t<TComponents>> || ...), "Change filters only support queries over archetype components");
+        ForEachQueryChunk<TComponents...>(Filter, MakeEntityVisitor<TComponents...>(Filter, Function));
+    }
+
+    // Like EachChunk, but every chunk is a task on the job system, so Function runs concurrently on several
+    // threads. Returns once all chunks are done
+    template <CQueryComponent... TComponents, typename TFunction>
+    void ParallelEachChunk(const TFunction& Function)
+    {
+        ParallelEachChunk<TComponents...>(FQueryFilter(), Function);
+    }
+
+    template <CQueryComponent... TComponents, typename TFunction>
+    void ParallelEachChunk(const FQueryFilter& Filter, const TFunction& Function)
+    {
+        static_assert(!(CSparseComponent<std::remove_const_t<TComponents>> || ...), "Sparse components are not stored in chunks");
+        ParallelForEachQueryChunk<TComponents...>(Filter, MakeChunkVisitor<TComponents...>(Function));
+    }
+
+    // Like Each, but split into one job per chunk
+    template <CQueryComponent... TComponents, typename TFunction>
+    void ParallelEach(const TFunction& Function)
+    {
+        ParallelEach<TComponents...>(FQueryFilter(), Function);
+    }
+
+    template <CQueryComponent... TComponents, typename TFunction>
+    void ParallelEach(const FQueryFilter& Filter, const TFunction& Function)
+    {
+        static_assert(!(CSparseComponent<std::remove_const_t<TComponents>> || ...), "Sparse components are not stored in chunks");
+        ParallelForEachQueryChunk<TComponents...>(Filter, MakeEntityVisitor<TComponents...>(Filter, Function));
+    }
+
+    // Like Each, but over the members of the group created for exactly these components, without any lookups
+    template <CSparseComponent... TComponents, typename TFunction>
+    void EachGroup(const TFunction& Function)
+    {
+        FSparseSet* const Sets[] = {FindSparseSet(GetComponentId<TComponents>())...};
+        const FSparseGroup* Group = Sets[0] != nullptr ? Sets[0]->GetOwningGroup() : nullptr;
+        assert(Group != nullptr && Group->GetOwnedSets().Num() == sizeof...(TComponents) && (Group->Owns(FindSparseSet<TComponents>()) && ...) &&
+            "No group owns exactly these components");
+
+        const FEntity* Entities = Sets[0]->GetEntities().GetData();
+        const uint32 Size = Group->GetSize();
+        EachGroupMember<TComponents...>(Function, Entities, Size, FindSparseSet<TComponents>()->GetData()...);
+    }
+
+public:
+    // Command buffer of the calling thread. Threads outside the job system share the buffer of index 0 and
+    // must not record at the same time
+    [[nodiscard]] FCommandBuffer& GetCommandBuffer();
+
+    // Plays back the commands of all threads ordered by their sort keys and clears the buffers. Must not run
+    // concurrently with anything else touching the world
+    void FlushCommands();
+
+public:
+    // Tick that writes and additions of archetype components are currently stamped with
+    [[nodiscard]] uint32 GetChangeTick() const noexcept
+    {
+        return ChangeTick;
+    }
+
+    // Starts a new tick and returns the one that ended, filters using it as SinceTick pass everything
+    // written from now on
+    uint32 AdvanceChangeTick() noexcept
+    {
+        return ChangeTick++;
+    }
+
+public:
+    [[nodiscard]] FArchetype* FindOrCreateArchetype(const FComponentSignature& Signature);
+
+    [[nodiscard]] const TArray<FArchetype*>& GetArchetypes() const noexcept
+    {
+        return Archetypes;
+    }
+
+    [[nodiscard]] size64 GetNumArchetypes() const noexcept
+    {
+        return Archetypes.Num();
+    }
+
+    [[nodiscard]] size64 GetNumEntities() const noexcept
+    {
+        return NumEntities;
+    }
+
+private:
+    friend class FWorldSnapshot;
+
+    struct FEntityRecord
+    {
+        FArchetype* Archetype;
+        FEntityLocation Location;
+        uint32 Generation;
+    };
+
+    // Columns of the queried components and of the filter terms within one archetype
+    template <size64 TNumComponents>
+    struct TQueryColumns
+    {
+        uint32 Components[TNumComponents];
+        uint32 Terms[FQueryFilter::MaxTerms];
+
+        // Some term tests a component with row versions, so passing chunks are filtered per entity as well
+        bool8 bFilterRows;
+    };
+
+    struct FChunkTask
+    {
+        FArchetype* Archetype;
+        uint32 ChunkIndex;
+        uint32 ColumnsIndex;
+    };
+
+private:
+    // Calls Visitor(FArchetype&, uint32 ChunkIndex, const TQueryColumns&, TComponents*... Columns) for every chunk matching
+    // the query and passing the filter
+    template <CQueryComponent... TComponents, typename TVisitor>
+    void ForEachQueryChunk(const FQueryFilter& Filter, const TVisitor& Visitor)
+    {
+        const FComponentSignature Required = MakeQuerySignature<TComponents...>(Filter);
+        for (FArchetype* Archetype : Archetypes)
+        {
+            if (Archetype->GetNumEntities() == 0 || !Archetype->GetSignature().ContainsAll(Required))
+            {
+                continue;
+            }
+            const TQueryColumns<sizeof...(TComponents)> Columns = FindQueryColumns<TComponents...>(*Archetype, Filter);
+            for (uint32 ChunkIndex = 0; ChunkIndex < Archetype->GetNumChunks(); ++ChunkIndex)
+            {
+                if (PassesChunkFilter(*Archetype, ChunkIndex, Filter, Columns.Terms))
+                {
+                    VisitQueryChunk<TComponents...>(Visitor, *Archetype, ChunkIndex, Columns, std::index_sequence_for<TComponents...>());
+                }
+            }
+        }
+    }
+
+    // Like ForEachQueryChunk, but every passing chunk is a task on the job system
+    template <CQueryComponent... TComponents, typename TVisitor>
+    void ParallelForEachQueryChunk(const FQueryFilter& Filter, const TVisitor& Visitor)
+    {
+        const FComponentSignature Required = MakeQuerySignature<TComponents...>(Filter);
+        TArray<TQueryColumns<sizeof...(TComponents)>> ArchetypeColumns;
+        TArray<FChunkTask> ChunkTasks;
+        for (FArchetype* Archetype : Archetypes)
+        {
+            if (Archetype->GetNumEntities() == 0 || !Archetype->GetSignature().ContainsAll(Required))
+            {
+                continue;
+            }
+            const uint32 ColumnsIndex = static_cast<uint32>(ArchetypeColumns.Num());
+            ArchetypeColumns.PushBack(FindQueryColumns<TComponents...>(*Archetype, Filter));
+            for (uint32 ChunkIndex = 0; ChunkIndex < Archetype->GetNumChunks(); ++ChunkIndex)
+            {
+                if (PassesChunkFilter(*Archetype, ChunkIndex, Filter, ArchetypeColumns[ColumnsIndex].Terms))
+                {
+                    ChunkTasks.PushBack(FChunkTask{.Archetype = Archetype, .ChunkIndex = ChunkIndex, .ColumnsIndex = ColumnsIndex});
+                }
+            }
+        }
+
+        FJobSystem::ParallelFor(ChunkTasks.Num(), [&ChunkTasks, &ArchetypeColumns, &Visitor](const size64 TaskIndex)
+        {
+            const FChunkTask& Task = ChunkTasks[TaskIndex];
+            VisitQueryChunk<TComponents...>(Visitor, *Task.Archetype, Task.ChunkIndex, ArchetypeColumns[Task.ColumnsIndex], std::index_sequence_for<TComponents...>());
+        });
+    }
+
+    template <CQueryComponent... TComponents, typename TVisitor, size64... TIndices>
+    static void VisitQueryChunk(const TVisitor& Visitor, FArchetype& Archetype, const uint32 ChunkIndex, const TQueryColumns<sizeof...(TComponents)>& Columns,
+        std::index_sequence<TIndices...>)
+    {
+        Visitor(Archetype, ChunkIndex, Columns, Archetype.GetColumn<std::remove_const_t<TComponents>>(ChunkIndex, Columns.Components[TIndices])...);
+    }
+
+    // Hands whole chunks to Function(const FEntity*, size64, TComponents*...)
+    template <CQueryComponent... TComponents, typename TFunction>
+    [[nodiscard]] auto MakeChunkVisitor(const TFunction& Function)
+    {
+        return [this, &Function](FArchetype& Archetype, const uint32 ChunkIndex, const TQueryColumns<sizeof...(TComponents)>& Columns, TComponents*... Data)
+        {
+            MarkChunkWritten<TComponents...>(Archetype, ChunkIndex, Columns.Components);
+            Function(static_cast<const FEntity*>(Archetype.GetEntities(ChunkIndex)), static_cast<size64>(Archetype.GetChunk(ChunkIndex).NumEntities), Data...);
+        };
+    }
+
+    // Hands the entities of a chunk that pass the filter to Function(FEntity, TComponents&...) one by one
+    template <CQueryComponent... TComponents, typename TFunction>
+    [[nodiscard]] auto MakeEntityVisitor(const FQueryFilter& Filter, const TFunction& Function)
+    {
+        return [this, &Filter, &Function](FArchetype& Archetype, const uint32 ChunkIndex, const TQueryColumns<sizeof...(TComponents)>& Columns, TComponents*... Data)
+        {
+            const FEntity* Entities = Archetype.GetEntities(ChunkIndex);
+            const uint32 NumRows = Archetype.GetChunk(ChunkIndex).NumEntities;
+            if (!Columns.bFilterRows)
+            {
+                MarkChunkWritten<TComponents...>(Archetype, ChunkIndex, Columns.Components);
+                for (uint32 Row = 0; Row < NumRows; ++Row)
+                {
+                    InvokeForEntity(Function, Entities[Row], Data[Row]...);
+                }
+                return;
+            }
+
+            // Only the visited rows count as written, so the skipped ones keep passing or failing later filters
+            for (uint32 Row = 0; Row < NumRows; ++Row)
+            {
+                const FEntityLocation Location{.ChunkIndex = ChunkIndex, .Row = Row};
+                if (PassesRowFilter(Archetype, Location, Filter, Columns.Terms))
+                {
+                    MarkRowWritten<TComponents...>(Archetype, Location, Columns.Components);
+                    InvokeForEntity(Function, Entities[Row], Data[Row]...);
+                }
+            }
+        };
+    }
+
+    template <CQueryComponent... TComponents>
+    [[nodiscard]] static FComponentSignature MakeQuerySignature(const FQueryFilter& Filter)
+    {
+        FComponentSignature Signature = FComponentSignature::Make<std::remove_const_t<TComponents>...>();
+        for (uint32 Index = 0; Index < Filter.Num(); ++Index)
+        {
+            Signature.Add(Filter[Index].ComponentId);
+        }
+        return Signature;
+    }
+
+    template <CQueryComponent... TComponents>
+    [[nodiscard]] static TQueryColumns<sizeof...(TComponents)> FindQueryColumns(const FArchetype& Archetype, const FQueryFilter& Filter)
+    {
+        TQueryColumns<sizeof...(TComponents)> Columns{.Components = {Archetype.FindColumn(GetComponentId<std::remove_const_t<TComponents>>())...}, .Terms = {},
+            .bFilterRows = false};
+        for (uint32 Index = 0; Index < Filter.Num(); ++Index)
+        {
+            Columns.Terms[Index] = Archetype.FindColumn(Filter[Index].ComponentId);
+            Columns.bFilterRows = Columns.bFilterRows || Archetype.HasRowVersions(Columns.Terms[Index]);
+        }
+        return Columns;
+    }
+
+    [[nodiscard]] static bool8 PassesChunkFilter(const FArchetype& Archetype, const uint32 ChunkIndex, const FQueryFilter& Filter, const uint32* TermColumns)
+    {
+        for (uint32 Index = 0; Index < Filter.Num(); ++Index)
+        {
+            const FQueryFilter::FTerm& Term = Filter[Index];
+            const uint32 Version = Term.bAdded ? Archetype.GetAddedVersion(ChunkIndex, TermColumns[Index]) : Archetype.GetChangedVersion(ChunkIndex, TermColumns[Index]);
+            if (Version <= Term.SinceTick)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] static bool8 PassesRowFilter(const FArchetype& Archetype, const FEntityLocation& Location, const FQueryFilter& Filter, const uint32* TermColumns)
+    {
+        for (uint32 Index = 0; Index < Filter.Num(); ++Index)
+        {
+            const FQueryFilter::FTerm& Term = Filter[Index];
+            const uint32 Version = Term.bAdded ? Archetype.GetRowAddedVersion(Location, TermColumns[Index]) : Archetype.GetRowChangedVersion(Location, TermColumns[Index]);
+            if (Version <= Term.SinceTick)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Stamps the archetype components a query lists without const
+    template <CQueryComponent... TComponents>
+    void MarkChunkWritten(FArchetype& Archetype, const uint32 ChunkIndex, const uint32* ComponentColumns) const
+    {
+        static constexpr bool8 bWritten[] = {(!std::is_const_v<TComponents> && !CSparseComponent<std::remove_const_t<TComponents>>)...};
+        for (uint32 Index = 0; Index < sizeof...(TComponents); ++Index)
+        {
+            if (bWritten[Index])
+            {
+                Archetype.MarkChanged(ChunkIndex, ComponentColumns[Index], ChangeTick);
+            }
+        }
+    }
+
+    template <CQueryComponent... TComponents>
+    void MarkRowWritten(FArchetype& Archetype, const FEntityLocation& Location, const uint32* ComponentColumns) const
+    {
+        static constexpr bool8 bWritten[] = {(!std::is_const_v<TComponents> && !CSparseComponent<std::remove_const_t<TComponents>>)...};
+        for (uint32 Index = 0; Index < sizeof...(TComponents); ++Index)
+        {
+            if (bWritten[Index])
+            {
+                Archetype.MarkRowChanged(Location, ComponentColumns[Index], ChangeTick);
+            }
+        }
+    }
+
+    template <CQueryComponent... TComponents, typename TFunction, size64... TIndices>
+    void EachWithSparseSets(const TFunction& Function, std::index_sequence<TIndices...>)
+    {
+        static constexpr bool8 bIsSparse[] = {CSparseComponent<std::remove_const_t<TComponents>>...};
+        FSparseSet* const Sets[] = {(bIsSparse[TIndices] ? FindSparseSet(GetComponentId<std::remove_const_t<TComponents>>()) : nullptr)...};
+
+        const FSparseSet* Smallest = nullptr;
+        for (uint32 Index = 0; Index < sizeof...(TComponents); ++Index)
+        {
+            if (!bIsSparse[Index])
+            {
+                continue;
+            }
+            if (Sets[Index] == nullptr)
+            {
+                return;
+            }
+            if (Smallest == nullptr || Sets[Index]->Num() < Smallest->Num())
+            {
+                Smallest = Sets[Index];
+            }
+        }
+
+        const FComponentSignature Required = MakeArchetypeSignature<std::remove_const_t<TComponents>...>();
+        const auto ProbeSparseSets = [&Sets](const FEntity Entity, uint32 (&DenseIndices)[sizeof...(TComponents)])
+        {
+            return ((!bIsSparse[TIndices] || (DenseIndices[TIndices] = Sets[TIndices]->GetDenseIndex(Entity)) != FSparseSet::InvalidIndex) && ...);
+        };
+
+        if (!Required.IsEmpty())
+        {
+            size64 NumArchetypeEntities = 0;
+            for (const FArchetype* Archetype : Archetypes)
+            {
+                NumArchetypeEntities += Archetype->GetSignature().ContainsAll(Required) ? Archetype->GetNumEntities() : 0;
+            }
+
+            if (NumArchetypeEntities < Smallest->Num())
+            {
+                for (FArchetype* Archetype : Archetypes)
+                {
+                    if (Archetype->GetNumEntities() == 0 || !Archetype->GetSignature().ContainsAll(Required))
+                    {
+                        continue;
+                    }
+                    const uint32 Columns[] = {(bIsSparse[TIndices] ? 0 : Archetype->FindColumn(GetComponentId<std::remove_const_t<TComponents>>()))...};
+                    for (uint32 ChunkIndex = 0; ChunkIndex < Archetype->GetNumChunks(); ++ChunkIndex)
+                    {
+                        const FEntity* Entities = Archetype->GetEntities(ChunkIndex);
+                        for (uint32 Row = 0; Row < Archetype->GetChunk(ChunkIndex).NumEntities; ++Row)
+                        {
+                            uint32 DenseIndices[sizeof...(TComponents)] = {};
+                            if (ProbeSparseSets(Entities[Row], DenseIndices))
+                            {
+                                const FEntityLocation Location{.ChunkIndex = ChunkIndex, .Row = Row};
+                                MarkRowWritten<TComponents...>(*Archetype, Location, Columns);
+                                InvokeForEntity(Function, Entities[Row],
+                                    GetQueryComponent<TComponents>(*Archetype, Location, Columns[TIndices], Sets[TIndices], DenseIndices[TIndices])...);
+                            }
+                        }
+                    }
+                }
+                return;
+            }
+        }
+
+        const TArray<FEntity>& Entities = Smallest->GetEntities();
+        for (size64 Index = 0; Index < Entities.Num(); ++Index)
+        {
+            const FEntity Entity = Entities[Index];
+            const FEntityRecord& Record = EntityRecords[Entity.Index];
+            uint32 DenseIndices[sizeof...(TComponents)] = {};
+            if (Record.Archetype->GetSignature().ContainsAll(Required) && ProbeSparseSets(Entity, DenseIndices))
+            {
+                const uint32 Columns[] = {(bIsSparse[TIndices] ? 0 : Record.Archetype->FindColumn(GetComponentId<std::remove_const_t<TComponents>>()))...};
+                MarkRowWritten<TComponents...>(*Record.Archetype, Record.Location, Columns);
+                InvokeForEntity(Function, Entity, GetQueryComponent<TComponents>(*Record.Archetype, Record.Location, Columns[TIndices], Sets[TIndices], DenseIndices[TIndices])...);
+            }
+        }
+    }
+
+    template <CQueryComponent T>
+    [[nodiscard]] static T& GetQueryComponent(const FArchetype& Archetype, const FEntityLocation& Location, const uint32 Column, FSparseSet* Set, const uint32 DenseIndex)
+    {
+        using TComponent = std::remove_const_t<T>;
+        if constexpr (CSparseComponent<TComponent>)
+        {
+            return static_cast<TSparseSet<TComponent>*>(Set)->GetData()[DenseIndex];
+        }
+        else
+        {
+            return *static_cast<TComponent*>(Archetype.GetComponentData(Location, Column));
+        }
+    }
+
+    template <CSparseComponent... TComponents, typename TFunction>
+    static void EachGroupMember(const TFunction& Function, const FEntity* Entities, const uint32 Size, TComponents*... Columns)
+    {
+        for (uint32 Index = 0; Index < Size; ++Index)
+        {
+            InvokeForEntity(Function, Entities[Index], Columns[Index]...);
+        }
+    }
+
+    template <typename TFunction, typename... TComponents>
+    static void InvokeForEntity(const TFunction& Function, const FEntity Entity, TComponents&... Components)
+    {
+        if constexpr (std::is_invocable_v<const TFunction&, FEntity, TComponents&...>)
+        {
+            Function(Entity, Components...);
+        }
+        else
+        {
+            Function(Components...);
+        }
+    }
+
+    // Signature of the components stored in archetypes, sparse components are left out
+    template <CComponent... TComponents>
+    [[nodiscard]] static FComponentSignature MakeArchetypeSignature()
+    {
+        FComponentSignature Signature;
+        ([&Signature]
+        {
+            if constexpr (!CSparseComponent<TComponents>)
+            {
+                Signature.Add(GetComponentId<TComponents>());
+            }
+        }(), ...);
+        return Signature;
+    }
+
+    // Constructs a component the entity does not have yet, archetype components must already have their storage
+    template <CComponent T, typename... TArguments>
+    T& ConstructComponent(const FEntity Entity, TArguments&&... Arguments)
+    {
+        if constexpr (CSparseComponent<T>)
+        {
+            assert(IsAlive(Entity) && "Entity is not alive");
+            TSparseSet<T>& Set = GetOrCreateSparseSet<T>();
+            Set.Emplace(Entity, std::forward<TArguments>(Arguments)...);
+            if (FSparseGroup* Group = Set.GetOwningGroup())
+            {
+                Group->HandleAdded(Entity);
+            }
+            return Set.Get(Entity);
+        }
+        else
+        {
+            return *std::construct_at(static_cast<T*>(FindComponentStorage(Entity, GetComponentId<T>())), std::forward<TArguments>(Arguments)...);
+        }
+    }
+
+    template <CSparseComponent T>
+    TSparseSet<T>& GetOrCreateSparseSet()
+    {
+        const FComponentId ComponentId = GetComponentId<T>();
+        if (ComponentId >= SparseSets.Num())
+        {
+            SparseSets.Resize(ComponentId + 1);
+        }
+        if (SparseSets[ComponentId] == nullptr)
+        {
+            SparseSets[ComponentId] = FMemory::New<TSparseSet<T>>();
+        }
+        return *static_cast<TSparseSet<T>*>(SparseSets[ComponentId]);
+    }
+
+    [[nodiscard]] FSparseSet* FindSparseSet(const FComponentId ComponentId) const
+    {
+        return ComponentId < SparseSets.Num() ? SparseSets[ComponentId] : nullptr;
+    }
+
+    // Real entity of a placeholder recorded in a command buffer, other entities are returned unchanged
+    [[nodiscard]] FEntity ResolveCommandEntity(FEntity Entity) const;
+
+    // Keeps the owning group, if any, consistent
+    void RemoveSparseComponent(FEntity Entity, FComponentId ComponentId);
+
+    [[nodiscard]] FEntity CreateEntityInArchetype(FArchetype* Archetype);
+
+    // Moves the entity into Target, relocating shared components and destroying the ones Target lacks.
+    // Components only Target has are left uninitialized
+    void MoveEntity(FEntityRecord& Record, FArchetype* Target);
+
+    [[nodiscard]] void* AddComponentStorage(FEntity Entity, FComponentId ComponentId);
+    void RemoveComponentStorage(FEntity Entity, FComponentId ComponentId);
+    [[nodiscard]] void* FindComponentStorage(FEntity Entity, FComponentId ComponentId) const;
+
+    // Like FindComponentStorage, stamping the component as written
+    [[nodiscard]] void* FindMutableComponentStorage(FEntity Entity, FComponentId ComponentId);
+
+    // Removes the row of a record and patches the record of the entity that filled the hole
+    void RemoveRecordRow(const FEntityRecord& Record);
+
+private:
+    TMap<FComponentSignature, FArchetype*> ArchetypesBySignature;
+    TArray<FArchetype*> Archetypes;
+    FArchetype* EmptyArchetype;
+
+    // Indexed by component id, null for components that are not sparse or have never been added
+    TArray<FSparseSet*> SparseSets;
+    TArray<FSparseGroup*> Groups;
+
+    // Created by the owning thread on first use, so the array itself never changes while threads record
+    TStaticArray<FCommandBuffer*, MaxCommandBufferThreads> CommandBuffers;
+
+    TArray<FEntityRecord> EntityRecords;
+    TArray<uint32> FreeEntityIndices;
+    size64 NumEntities;
+
+    // Starts at one, zero is the version of chunks nothing was written to yet
+    uint32 ChangeTick;
+};
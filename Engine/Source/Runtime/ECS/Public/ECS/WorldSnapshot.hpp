@@ -0,0 +1,32 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "Core/Containers/Array.hpp"
+
+class FWorld;
+
+// Saves the entities of a world as the raw memory of its archetype chunks behind a small schema header, for
+// rollback, replays and fast loads. Saving copies every chunk as is, loading validates the schema, copies
+// the chunks back into archetypes of the same signature and fixes up the archetype pointers of the entity
+// records. Components stored in archetypes have to be trivially copyable and sparse components are not
+// saved. Component ids are part of the schema, so snapshots are only portable between runs registering
+// their components in the same order
+class ECS_API FWorldSnapshot
+{
+public:
+    // "CVWS" in little endian byte order
+    static constexpr uint32 Magic = 0x53575643;
+    static constexpr uint32 Version = 1;
+
+public:
+    // Replaces the contents of OutData. Fails if a component cannot be copied as raw memory or a sparse set
+    // holds components
+    [[nodiscard]] static bool8 Save(const FWorld& World, TArray<uint8>& OutData);
+
+    // Replaces every entity of the world, including its sparse components. Fails without touching the world if
+    // the data is truncated or inconsistent, or its schema does not match the registered components. Archetypes and chunks
+    // the world already has are reused, so restoring into the world that was saved does not allocate.
+    // No commands may be pending
+    [[nodiscard]] static bool8 Load(FWorld& World, const uint8* Data, size64 Size);
+};
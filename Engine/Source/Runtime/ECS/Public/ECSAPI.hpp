@@ -0,0 +1,13 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#ifdef CORVUS_BUILD_MODULAR
+#   ifdef CORVUS_BUILD_ECS
+#       define ECS_API __declspec(dllexport)
+#   else
+#       define ECS_API __declspec(dllimport)
+#   endif
+#else
+#   define ECS_API
+#endif
@@ -0,0 +1,79 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include "ECS/Archetype.hpp"
+#include "TestComponents.hpp"
+
+struct alignas(16) FArchetypeTestAligned
+{
+    float32 Values[4];
+};
+
+struct FArchetypeTestLarge
+{
+    uint8 Bytes[1024];
+};
+
+TEST_CASE("FArchetype::Layout", "[ECS][Archetype]")
+{
+    const FArchetype Archetype(FComponentSignature::Make<FTestPosition, FArchetypeTestAligned, FArchetypeTestLarge>());
+
+    const uint32 Capacity = Archetype.GetChunkCapacity();
+    REQUIRE(Capacity > 0);
+    REQUIRE(Capacity <= ArchetypeChunkSize / (sizeof(FEntity) + sizeof(FTestPosition) + sizeof(FArchetypeTestAligned) + sizeof(FArchetypeTestLarge)));
+
+    const TArray<FArchetypeColumn>& Columns = Archetype.GetColumns();
+    REQUIRE(Columns.Num() == 3);
+    for (size64 Index = 0; Index < Columns.Num(); ++Index)
+    {
+        REQUIRE(Columns[Index].Offset % ArchetypeChunkAlignment == 0);
+        REQUIRE(Columns[Index].Offset + Columns[Index].TypeInfo.Size * Capacity <= ArchetypeChunkSize);
+        if (Index > 0)
+        {
+            REQUIRE(Columns[Index - 1].ComponentId < Columns[Index].ComponentId);
+        }
+    }
+}
+
+TEST_CASE("FArchetype::RowsStayDense", "[ECS][Archetype]")
+{
+    FArchetype Archetype(FComponentSignature::Make<FTestPosition>());
+    const uint32 Column = Archetype.FindColumn(GetComponentId<FTestPosition>());
+    REQUIRE(Column != FArchetype::InvalidColumn);
+    REQUIRE(Archetype.FindColumn(GetComponentId<FArchetypeTestLarge>()) == FArchetype::InvalidColumn);
+
+    const uint32 NumRows = Archetype.GetChunkCapacity() * 2 + 5;
+    for (uint32 Index = 0; Index < NumRows; ++Index)
+    {
+        const FEntityLocation Location = Archetype.AllocateRow(FEntity{.Index = Index, .Generation = 0});
+        *static_cast<FTestPosition*>(Archetype.GetComponentData(Location, Column)) = {static_cast<float32>(Index), 0.0f, 0.0f};
+    }
+    REQUIRE(Archetype.GetNumChunks() == 3);
+    REQUIRE(Archetype.GetNumEntities() == NumRows);
+
+    // Removing the first row moves the very last row into it
+    const FEntity Moved = Archetype.RemoveRow(FEntityLocation{.ChunkIndex = 0, .Row = 0});
+    REQUIRE(Moved.Index == NumRows - 1);
+    REQUIRE(Archetype.GetEntities(0)[0] == Moved);
+    REQUIRE(Archetype.GetColumn<FTestPosition>(0, Column)[0].X == static_cast<float32>(NumRows - 1));
+
+    // Removing the last row moves nothing and releases the emptied chunk
+    while (Archetype.GetNumChunks() == 3)
+    {
+        const FEntityLocation Last{.ChunkIndex = 2, .Row = Archetype.GetChunk(2).NumEntities - 1};
+        REQUIRE_FALSE(Archetype.RemoveRow(Last).IsValid());
+    }
+    REQUIRE(Archetype.GetNumEntities() == Archetype.GetChunkCapacity() * 2);
+}
+
+TEST_CASE("FComponentRegistry::SharedAcrossModules", "[ECS][Archetype]")
+{
+    // Another module instantiating GetComponentId has its own static, it registers the type again under the same key
+    const FComponentId ComponentId = GetComponentId<FTestPosition>();
+    const uint32 NumComponentTypes = FComponentRegistry::GetNumComponentTypes();
+    REQUIRE(FComponentRegistry::Register(GetComponentTypeKey<FTestPosition>(), MakeComponentTypeInfo<FTestPosition>()) == ComponentId);
+    REQUIRE(FComponentRegistry::GetNumComponentTypes() == NumComponentTypes);
+
+    REQUIRE(GetComponentTypeKey<FTestPosition>() != GetComponentTypeKey<FArchetypeTestLarge>());
+    REQUIRE(GetComponentTypeKey<FTestPosition>().find("FTestPosition") != std::string_view::npos);
+}
@@ -0,0 +1,250 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "ECS/SystemScheduler.hpp"
+#include "ECS/World.hpp"
+#include "TestComponents.hpp"
+
+#include <atomic>
+
+struct FChangeTestTransform
+{
+    static constexpr EChangeTracking ChangeTracking = EChangeTracking::Entity;
+
+    float32 X, Y, Z;
+};
+
+TEST_CASE("FWorld::ChangedChunks", "[ECS][ChangeDetection]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < 10000; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FTestPosition{}, FTestHealth{Index}));
+    }
+
+    const auto CountChanged = [&World](const uint32 SinceTick)
+    {
+        size64 NumVisited = 0;
+        World.Each<const FTestPosition>(FQueryFilter().Changed<FTestPosition>(SinceTick), [&NumVisited](const FTestPosition&)
+        {
+            ++NumVisited;
+        });
+        return NumVisited;
+    };
+
+    // Everything is new at first, nothing after the tick advanced
+    REQUIRE(CountChanged(0) == 10000);
+    const uint32 Since = World.AdvanceChangeTick();
+    REQUIRE(CountChanged(Since) == 0);
+
+    // Reading keeps the versions, writing one entity passes its whole chunk
+    REQUIRE(std::as_const(World).GetComponent<FTestPosition>(Entities[5000]) != nullptr);
+    World.Each<const FTestPosition, const FTestHealth>([](const FTestPosition&, const FTestHealth&)
+    {
+    });
+    REQUIRE(CountChanged(Since) == 0);
+
+    World.GetComponent<FTestPosition>(Entities[5000])->X = 1.0f;
+    const uint32 ChunkCapacity = World.GetArchetypes().GetLast()->GetChunkCapacity();
+    REQUIRE(CountChanged(Since) == ChunkCapacity);
+
+    size64 NumHealthChanged = 0;
+    World.Each<FTestHealth>(FQueryFilter().Changed<FTestHealth>(Since), [&NumHealthChanged](FTestHealth&)
+    {
+        ++NumHealthChanged;
+    });
+    REQUIRE(NumHealthChanged == 0);
+
+    // Queries listing a component without const write all of it
+    const uint32 SinceWrite = World.AdvanceChangeTick();
+    World.Each<FTestPosition>([](FTestPosition& Position)
+    {
+        Position.Y = 2.0f;
+    });
+    REQUIRE(CountChanged(SinceWrite) == 10000);
+}
+
+TEST_CASE("FWorld::ChangedEntities", "[ECS][ChangeDetection]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < 10000; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FChangeTestTransform{}, FTestHealth{Index}));
+    }
+
+    const uint32 Since = World.AdvanceChangeTick();
+    World.GetComponent<FChangeTestTransform>(Entities[10])->X = 1.0f;
+    World.GetComponent<FChangeTestTransform>(Entities[7000])->X = 1.0f;
+
+    // Components tracking entities pass only the written entities of a chunk
+    TArray<FEntity> Visited;
+    World.Each<FChangeTestTransform>(FQueryFilter().Changed<FChangeTestTransform>(Since), [&Visited](const FEntity Entity, FChangeTestTransform& Transform)
+    {
+        Transform.Y = 1.0f;
+        Visited.PushBack(Entity);
+    });
+    REQUIRE(Visited.Num() == 2);
+    REQUIRE(Visited[0] == Entities[10]);
+    REQUIRE(Visited[1] == Entities[7000]);
+
+    // The filtered query above only stamped the entities it visited
+    const uint32 SinceVisit = World.AdvanceChangeTick();
+    World.GetComponent<FChangeTestTransform>(Entities[20])->X = 1.0f;
+    size64 NumChanged = 0;
+    World.Each<const FChangeTestTransform>(FQueryFilter().Changed<FChangeTestTransform>(Since), [&NumChanged](const FChangeTestTransform&)
+    {
+        ++NumChanged;
+    });
+    REQUIRE(NumChanged == 3);
+
+    // Chunk filters still see whole chunks
+    size64 NumChunkEntities = 0;
+    World.EachChunk<const FChangeTestTransform>(FQueryFilter().Changed<FChangeTestTransform>(SinceVisit),
+        [&NumChunkEntities](const FEntity*, const size64 NumEntities, const FChangeTestTransform*)
+    {
+        NumChunkEntities += NumEntities;
+    });
+    REQUIRE(NumChunkEntities == World.GetArchetypes().GetLast()->GetChunkCapacity());
+}
+
+TEST_CASE("FWorld::AddedAndMoved", "[ECS][ChangeDetection]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FChangeTestTransform{}, FTestTag{}));
+    }
+
+    const uint32 Since = World.AdvanceChangeTick();
+    World.AddComponent<FTestHealth>(Entities[3], 3);
+    World.AddComponent<FTestHealth>(Entities[4], 4);
+    const FEntity Created = World.CreateEntity(FChangeTestTransform{}, FTestHealth{5});
+
+    size64 NumAdded = 0;
+    World.Each<const FTestHealth>(FQueryFilter().Added<FTestHealth>(Since), [&NumAdded](const FTestHealth&)
+    {
+        ++NumAdded;
+    });
+    REQUIRE(NumAdded == 3);
+
+    // Moving between archetypes or filling a hole is no change, only the created entity is new
+    World.RemoveComponent<FTestTag>(Entities[100]);
+    World.DestroyEntity(Entities[0]);
+    TArray<FEntity> Changed;
+    World.Each<const FChangeTestTransform>(FQueryFilter().Changed<FChangeTestTransform>(Since), [&Changed](const FEntity Entity, const FChangeTestTransform&)
+    {
+        Changed.PushBack(Entity);
+    });
+    REQUIRE(Changed.Num() == 1);
+    REQUIRE(Changed[0] == Created);
+
+    // Filters combine, every term has to pass
+    World.GetComponent<FTestHealth>(Entities[3])->Value = 30;
+    size64 NumBoth = 0;
+    World.Each<const FTestHealth>(FQueryFilter().Added<FTestHealth>(Since).Changed<FChangeTestTransform>(Since), [&NumBoth](const FTestHealth&)
+    {
+        ++NumBoth;
+    });
+    REQUIRE(NumBoth == 1);
+}
+
+TEST_CASE("FSystemScheduler::ChangeFilters", "[ECS][ChangeDetection]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < 5000; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FChangeTestTransform{}, FTestHealth{100}));
+    }
+
+    int32 Frame = 0;
+    std::atomic<size64> NumProcessed = 0;
+    FSystemScheduler Scheduler;
+    Scheduler.AddSystem("Damage", FSystemAccess().Write<FTestHealth>(), [&Entities, &Frame](FWorld& InWorld)
+    {
+        if (Frame % 2 == 0)
+        {
+            InWorld.GetComponent<FTestHealth>(Entities[Frame])->Value -= 10;
+        }
+    });
+    Scheduler.AddSystem("React", FSystemAccess().Read<FTestHealth>(), [&NumProcessed](FWorld& InWorld, const FSystem& Self)
+    {
+        InWorld.ParallelEach<const FTestHealth>(FQueryFilter().Changed<FTestHealth>(Self.GetLastRunTick()), [&NumProcessed](const FTestHealth&)
+        {
+            ++NumProcessed;
+        });
+    });
+
+    // The first run sees every entity as new, later runs only the chunks damaged since the previous run
+    Scheduler.Run(World);
+    REQUIRE(NumProcessed == 5000);
+    const uint32 ChunkCapacity = World.GetArchetypes().GetLast()->GetChunkCapacity();
+    for (Frame = 1; Frame < 5; ++Frame)
+    {
+        NumProcessed = 0;
+        Scheduler.Run(World);
+        REQUIRE(NumProcessed == (Frame % 2 == 0 ? ChunkCapacity : 0));
+    }
+}
+
+TEST_CASE("FWorld::BenchmarkChangeFilters", "[ECS][ChangeDetection][.benchmark]")
+{
+    static constexpr int32 NumEntities = 1000000;
+
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FTestPosition{}, FChangeTestTransform{}, FTestHealth{Index}));
+    }
+
+    // Touch every hundredth chunk between the measured passes
+    const uint32 ChunkCapacity = World.GetArchetypes().GetLast()->GetChunkCapacity();
+    const auto TouchOnePercent = [&World, &Entities, ChunkCapacity]
+    {
+        for (size64 Index = 0; Index < Entities.Num(); Index += 100 * static_cast<size64>(ChunkCapacity))
+        {
+            World.GetComponent<FTestPosition>(Entities[Index])->X += 1.0f;
+            World.GetComponent<FChangeTestTransform>(Entities[Index])->X += 1.0f;
+        }
+    };
+
+    BENCHMARK("Unfiltered_1M")
+    {
+        TouchOnePercent();
+        float32 Sum = 0.0f;
+        World.Each<const FTestPosition>([&Sum](const FTestPosition& Position)
+        {
+            Sum += Position.X;
+        });
+        return Sum;
+    };
+
+    BENCHMARK("ChangedChunks_1M")
+    {
+        const uint32 Since = World.AdvanceChangeTick();
+        TouchOnePercent();
+        float32 Sum = 0.0f;
+        World.Each<const FTestPosition>(FQueryFilter().Changed<FTestPosition>(Since), [&Sum](const FTestPosition& Position)
+        {
+            Sum += Position.X;
+        });
+        return Sum;
+    };
+
+    BENCHMARK("ChangedEntities_1M")
+    {
+        const uint32 Since = World.AdvanceChangeTick();
+        TouchOnePercent();
+        float32 Sum = 0.0f;
+        World.Each<const FChangeTestTransform>(FQueryFilter().Changed<FChangeTestTransform>(Since), [&Sum](const FChangeTestTransform& Transform)
+        {
+            Sum += Transform.X;
+        });
+        return Sum;
+    };
+}
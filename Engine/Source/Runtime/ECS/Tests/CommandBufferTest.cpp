@@ -0,0 +1,243 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "Core/Threading/JobSystem.hpp"
+#include "ECS/SystemScheduler.hpp"
+#include "ECS/World.hpp"
+#include "TestComponents.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+struct FCommandTestMarked
+{
+    static constexpr EComponentStorage Storage = EComponentStorage::SparseSet;
+
+    int32 Frame;
+};
+
+struct FCommandTestLarge
+{
+    static constexpr EComponentStorage Storage = EComponentStorage::SparseSet;
+
+    uint8 Data[CommandBufferBlockSize * 2];
+};
+
+TEST_CASE("FCommandBuffer::Playback", "[ECS][CommandBuffer]")
+{
+    FWorld World;
+    const FEntity Existing = World.CreateEntity(FTestHealth{1});
+    const FEntity Doomed = World.CreateEntity(FTestHealth{2});
+
+    FCommandBuffer& Buffer = World.GetCommandBuffer();
+    const FEntity Spawned = Buffer.CreateEntity(0);
+    REQUIRE(FCommandBuffer::IsDeferredEntity(Spawned));
+    Buffer.AddComponent<FTestName>(0, Spawned, std::string(64, 's'));
+    Buffer.AddComponent<FTestHealth>(0, Spawned, 10);
+    Buffer.AddComponent<FCommandTestMarked>(0, Spawned, 3);
+    Buffer.AddComponent<FTestName>(0, Existing, "Existing");
+    Buffer.RemoveComponent<FTestHealth>(0, Existing);
+    Buffer.DestroyEntity(0, Doomed);
+
+    // Nothing happens until playback
+    REQUIRE(World.GetNumEntities() == 2);
+    REQUIRE(Buffer.Num() == 7);
+    World.FlushCommands();
+    REQUIRE(Buffer.IsEmpty());
+
+    REQUIRE(World.GetNumEntities() == 2);
+    REQUIRE_FALSE(World.IsAlive(Doomed));
+    REQUIRE_FALSE(World.HasComponent<FTestHealth>(Existing));
+    REQUIRE(World.GetComponent<FTestName>(Existing)->Value == "Existing");
+
+    size64 NumSpawned = 0;
+    World.Each<FTestName, FTestHealth, FCommandTestMarked>([&NumSpawned](const FTestName& Name, const FTestHealth& Health, const FCommandTestMarked& Marked)
+    {
+        REQUIRE(Name.Value == std::string(64, 's'));
+        REQUIRE(Health.Value == 10);
+        REQUIRE(Marked.Frame == 3);
+        ++NumSpawned;
+    });
+    REQUIRE(NumSpawned == 1);
+}
+
+TEST_CASE("FCommandBuffer::SkipsDeadEntitiesAndClears", "[ECS][CommandBuffer]")
+{
+    FWorld World;
+    const FEntity Entity = World.CreateEntity(FTestHealth{1});
+
+    FCommandBuffer& Buffer = World.GetCommandBuffer();
+    Buffer.DestroyEntity(0, Entity);
+    Buffer.DestroyEntity(1, Entity);
+    Buffer.AddComponent<FTestName>(2, Entity, std::string(64, 'x'));
+    World.FlushCommands();
+    REQUIRE(World.GetNumEntities() == 0);
+
+    // Discarded commands destroy their payloads
+    Buffer.AddComponent<FTestName>(0, Buffer.CreateEntity(0), std::string(64, 'y'));
+    Buffer.Clear();
+    World.FlushCommands();
+    REQUIRE(World.GetNumEntities() == 0);
+
+    // Blocks are reused and large payloads get blocks of their own
+    for (int32 Index = 0; Index < 10000; ++Index)
+    {
+        Buffer.AddComponent<FTestHealth>(static_cast<uint32>(Index), Buffer.CreateEntity(static_cast<uint32>(Index)), Index);
+    }
+    Buffer.AddComponent<FCommandTestLarge>(0, Buffer.CreateEntity(0));
+    World.FlushCommands();
+    REQUIRE(World.GetNumEntities() == 10001);
+}
+
+TEST_CASE("FCommandBuffer::DeterministicAcrossThreads", "[ECS][CommandBuffer]")
+{
+    const auto Record = []
+    {
+        FWorld World;
+        TArray<FEntity> Entities;
+        for (int32 Index = 0; Index < 2000; ++Index)
+        {
+            Entities.PushBack(World.CreateEntity(FTestHealth{Index}));
+        }
+
+        // Every task owns the keys of its entities, which thread runs a task does not matter
+        FJobSystem::ParallelFor(64, [&World, &Entities](const size64 TaskIndex)
+        {
+            FCommandBuffer& Buffer = World.GetCommandBuffer();
+            for (size64 Index = TaskIndex; Index < Entities.Num(); Index += 64)
+            {
+                const uint32 SortKey = static_cast<uint32>(Index);
+                if (Index % 3 == 0)
+                {
+                    Buffer.DestroyEntity(SortKey, Entities[Index]);
+                }
+                else
+                {
+                    const FEntity Child = Buffer.CreateEntity(SortKey);
+                    Buffer.AddComponent<FTestHealth>(SortKey, Child, static_cast<int32>(Index) + 10000);
+                }
+            }
+        });
+        World.FlushCommands();
+
+        TArray<int32> Result;
+        World.Each<FTestHealth>([&Result](const FEntity Entity, const FTestHealth& Health)
+        {
+            Result.Resize(std::max<size64>(Result.Num(), Entity.Index + 1));
+            Result[Entity.Index] = Health.Value;
+        });
+        return Result;
+    };
+
+    const TArray<int32> First = Record();
+    for (int32 Run = 0; Run < 4; ++Run)
+    {
+        const TArray<int32> Other = Record();
+        REQUIRE(Other.Num() == First.Num());
+        for (size64 Index = 0; Index < First.Num(); ++Index)
+        {
+            REQUIRE(Other[Index] == First[Index]);
+        }
+    }
+
+    // Creations reuse the index freed by the preceding key
+    REQUIRE(First[0] == 10001);
+    REQUIRE(First[1] == 1);
+    REQUIRE(First[3] == 10004);
+}
+
+TEST_CASE("FCommandBuffer::SchedulerSyncPoints", "[ECS][CommandBuffer]")
+{
+    FWorld World;
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        World.CreateEntity(FTestHealth{Index});
+    }
+
+    FSystemScheduler Scheduler;
+    Scheduler.AddSystem("Mark", FSystemAccess().Read<FTestHealth>(), [](FWorld& InWorld)
+    {
+        InWorld.ParallelEach<FTestHealth>([&InWorld](const FEntity Entity, const FTestHealth& Health)
+        {
+            if (Health.Value % 2 == 0)
+            {
+                InWorld.GetCommandBuffer().AddComponent<FCommandTestMarked>(Entity.Index, Entity, Health.Value);
+            }
+        });
+    });
+    size64 NumMarked = 0;
+    Scheduler.AddSystem("Count", FSystemAccess().Read<FCommandTestMarked>().Write<FTestHealth>(), [&NumMarked](FWorld& InWorld)
+    {
+        InWorld.Each<FCommandTestMarked>([&NumMarked](FCommandTestMarked&)
+        {
+            ++NumMarked;
+        });
+    });
+
+    Scheduler.Run(World);
+    REQUIRE(NumMarked == 500);
+}
+
+TEST_CASE("FCommandBuffer::BenchmarkStructuralChanges", "[ECS][CommandBuffer][.benchmark]")
+{
+    static constexpr size64 NumChanges = 100000;
+    static constexpr size64 NumTasks = 16;
+
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (size64 Index = 0; Index < NumChanges; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FTestHealth{static_cast<int32>(Index)}));
+    }
+
+    // One frame adds a component to every entity, the next frame removes it again
+    BENCHMARK("CommandBuffers_100K")
+    {
+        for (int32 Frame = 0; Frame < 2; ++Frame)
+        {
+            FJobSystem::ParallelFor(NumTasks, [&World, &Entities, Frame](const size64 TaskIndex)
+            {
+                FCommandBuffer& Buffer = World.GetCommandBuffer();
+                for (size64 Index = TaskIndex; Index < Entities.Num(); Index += NumTasks)
+                {
+                    if (Frame == 0)
+                    {
+                        Buffer.AddComponent<FCommandTestMarked>(static_cast<uint32>(Index), Entities[Index], Frame);
+                    }
+                    else
+                    {
+                        Buffer.RemoveComponent<FCommandTestMarked>(static_cast<uint32>(Index), Entities[Index]);
+                    }
+                }
+            });
+            World.FlushCommands();
+        }
+        return World.GetNumEntities();
+    };
+
+    std::mutex WorldMutex;
+    BENCHMARK("GlobalMutex_100K")
+    {
+        for (int32 Frame = 0; Frame < 2; ++Frame)
+        {
+            FJobSystem::ParallelFor(NumTasks, [&World, &Entities, &WorldMutex, Frame](const size64 TaskIndex)
+            {
+                for (size64 Index = TaskIndex; Index < Entities.Num(); Index += NumTasks)
+                {
+                    std::scoped_lock Lock(WorldMutex);
+                    if (Frame == 0)
+                    {
+                        World.AddComponent<FCommandTestMarked>(Entities[Index], Frame);
+                    }
+                    else
+                    {
+                        World.RemoveComponent<FCommandTestMarked>(Entities[Index]);
+                    }
+                }
+            });
+        }
+        return World.GetNumEntities();
+    };
+}
@@ -0,0 +1,19 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_session.hpp>
+
+#include "Core/Threading/JobSystem.hpp"
+
+int main(const int ArgumentCount, char* Arguments[])
+{
+    Catch::Session Session = Catch::Session();
+    int Result = Session.applyCommandLine(ArgumentCount, Arguments);
+    if (Result != 0)
+    {
+        return Result;
+    }
+    FJobSystem::Initialize();
+    Result = Session.run(ArgumentCount, Arguments);
+    FJobSystem::Shutdown();
+    return Result;
+}
@@ -0,0 +1,315 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "ECS/World.hpp"
+#include "TestComponents.hpp"
+
+#include <string>
+
+struct FSparseTestStunned
+{
+    static constexpr EComponentStorage Storage = EComponentStorage::SparseSet;
+
+    float32 RemainingTime;
+};
+
+struct FSparseTestBurning
+{
+    static constexpr EComponentStorage Storage = EComponentStorage::SparseSet;
+
+    int32 Damage;
+};
+
+struct FSparseTestLabel
+{
+    static constexpr EComponentStorage Storage = EComponentStorage::SparseSet;
+
+    std::string Value;
+};
+
+struct FSparseTestArchetypeStunned
+{
+    float32 RemainingTime;
+};
+
+TEST_CASE("TSparseSet::EmplaceRemove", "[ECS][SparseSet]")
+{
+    TSparseSet<int32> Set;
+    for (uint32 Index = 0; Index < 10000; Index += 10)
+    {
+        Set.Emplace(FEntity{.Index = Index, .Generation = 1}, static_cast<int32>(Index));
+    }
+    REQUIRE(Set.Num() == 1000);
+    REQUIRE(Set.Contains(FEntity{.Index = 500, .Generation = 1}));
+    REQUIRE_FALSE(Set.Contains(FEntity{.Index = 500, .Generation = 2}));
+    REQUIRE_FALSE(Set.Contains(FEntity{.Index = 501, .Generation = 1}));
+    REQUIRE_FALSE(Set.Contains(FEntity{.Index = 1000000, .Generation = 1}));
+
+    for (uint32 Index = 0; Index < 10000; Index += 20)
+    {
+        Set.Remove(FEntity{.Index = Index, .Generation = 1});
+    }
+    REQUIRE(Set.Num() == 500);
+    for (uint32 Index = 0; Index < 10000; Index += 10)
+    {
+        const int32* Value = Set.Find(FEntity{.Index = Index, .Generation = 1});
+        if (Index % 20 == 0)
+        {
+            REQUIRE(Value == nullptr);
+        }
+        else
+        {
+            REQUIRE(*Value == static_cast<int32>(Index));
+        }
+    }
+
+    // Dense entities and components stay paired
+    for (size64 DenseIndex = 0; DenseIndex < Set.Num(); ++DenseIndex)
+    {
+        REQUIRE(Set.GetData()[DenseIndex] == static_cast<int32>(Set.GetEntities()[DenseIndex].Index));
+    }
+}
+
+TEST_CASE("TSparseSet::SortAs", "[ECS][SparseSet]")
+{
+    TSparseSet<int32> Lead;
+    TSparseSet<int32> Follower;
+    for (uint32 Index = 0; Index < 100; ++Index)
+    {
+        Lead.Emplace(FEntity{.Index = 99 - Index, .Generation = 0}, static_cast<int32>(99 - Index));
+        if (Index % 3 != 0)
+        {
+            Follower.Emplace(FEntity{.Index = Index, .Generation = 0}, static_cast<int32>(Index));
+        }
+    }
+    Follower.Emplace(FEntity{.Index = 500, .Generation = 0}, 500);
+
+    Follower.SortAs(Lead);
+
+    // Shared entities come first in the order of Lead, the rest follows
+    uint32 Position = 0;
+    for (const FEntity Entity : Lead.GetEntities())
+    {
+        if (Follower.Contains(Entity))
+        {
+            REQUIRE(Follower.GetEntities()[Position] == Entity);
+            REQUIRE(Follower.GetData()[Position] == static_cast<int32>(Entity.Index));
+            ++Position;
+        }
+    }
+    REQUIRE(Position == Follower.Num() - 1);
+    REQUIRE(Follower.GetEntities()[Position].Index == 500);
+}
+
+TEST_CASE("FWorld::SparseComponents", "[ECS][SparseSet]")
+{
+    FWorld World;
+    const FEntity Entity = World.CreateEntity(FTestPosition{1.0f, 0.0f, 0.0f}, FSparseTestStunned{2.0f});
+    REQUIRE(World.HasComponent<FSparseTestStunned>(Entity));
+    REQUIRE(World.GetComponent<FSparseTestStunned>(Entity)->RemainingTime == 2.0f);
+
+    // Toggling a sparse component never creates archetypes or moves the entity
+    const size64 NumArchetypes = World.GetNumArchetypes();
+    World.RemoveComponent<FSparseTestStunned>(Entity);
+    REQUIRE_FALSE(World.HasComponent<FSparseTestStunned>(Entity));
+    World.AddComponent<FSparseTestLabel>(Entity, "Stunned");
+    World.AddComponent<FSparseTestLabel>(Entity, "Burning");
+    REQUIRE(World.GetComponent<FSparseTestLabel>(Entity)->Value == "Burning");
+    REQUIRE(World.GetNumArchetypes() == NumArchetypes);
+    REQUIRE(World.GetComponent<FTestPosition>(Entity)->X == 1.0f);
+
+    // Destroying the entity releases its sparse components, the recycled index starts without them
+    World.DestroyEntity(Entity);
+    REQUIRE(World.FindSparseSet<FSparseTestLabel>()->IsEmpty());
+    const FEntity Recycled = World.CreateEntity();
+    REQUIRE(Recycled.Index == Entity.Index);
+    REQUIRE_FALSE(World.HasComponent<FSparseTestLabel>(Recycled));
+}
+
+TEST_CASE("FWorld::EachWithSparseComponents", "[ECS][SparseSet]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}));
+        if (Index % 2 == 0)
+        {
+            World.AddComponent<FSparseTestStunned>(Entities.GetLast(), 1.0f);
+        }
+        if (Index % 5 == 0)
+        {
+            World.AddComponent<FSparseTestBurning>(Entities.GetLast(), Index);
+        }
+    }
+    // Sparse components on entities outside of the queried archetypes
+    for (int32 Index = 0; Index < 2000; ++Index)
+    {
+        World.AddComponent<FSparseTestStunned>(World.CreateEntity(), 1.0f);
+    }
+
+    size64 NumStunned = 0;
+    World.Each<FTestPosition, FSparseTestStunned>([&NumStunned](FTestPosition& Position, const FSparseTestStunned& Stunned)
+    {
+        Position.X += Stunned.RemainingTime;
+        ++NumStunned;
+    });
+    REQUIRE(NumStunned == 500);
+
+    // Few burning entities, the sparse set drives this query
+    size64 NumBoth = 0;
+    World.Each<FSparseTestBurning, FTestPosition, FSparseTestStunned>([&NumBoth, &World](const FEntity Entity, const FSparseTestBurning& Burning, FTestPosition& Position, FSparseTestStunned&)
+    {
+        REQUIRE(Burning.Damage % 10 == 0);
+        REQUIRE(World.GetComponent<FTestPosition>(Entity) == &Position);
+        ++NumBoth;
+    });
+    REQUIRE(NumBoth == 100);
+
+    size64 NumSparseOnly = 0;
+    World.Each<FSparseTestStunned, FSparseTestBurning>([&NumSparseOnly](FSparseTestStunned&, FSparseTestBurning&)
+    {
+        ++NumSparseOnly;
+    });
+    REQUIRE(NumSparseOnly == 100);
+
+    for (size64 Index = 0; Index < Entities.Num(); ++Index)
+    {
+        REQUIRE(World.GetComponent<FTestPosition>(Entities[Index])->X == (Index % 2 == 0 ? 1.0f : 0.0f));
+    }
+}
+
+TEST_CASE("FWorld::SparseGroup", "[ECS][SparseSet]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < 300; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity());
+        if (Index % 2 == 0)
+        {
+            World.AddComponent<FSparseTestStunned>(Entities.GetLast(), static_cast<float32>(Index));
+        }
+        if (Index % 3 == 0)
+        {
+            World.AddComponent<FSparseTestBurning>(Entities.GetLast(), Index);
+        }
+    }
+
+    const auto CountGroup = [&World]
+    {
+        size64 Count = 0;
+        World.EachGroup<FSparseTestStunned, FSparseTestBurning>([&Count, &World](const FEntity Entity, const FSparseTestStunned& Stunned, const FSparseTestBurning& Burning)
+        {
+            REQUIRE(static_cast<int32>(Stunned.RemainingTime) == Burning.Damage);
+            REQUIRE(World.GetComponent<FSparseTestBurning>(Entity) == &Burning);
+            ++Count;
+        });
+        return Count;
+    };
+
+    // Existing entities join on creation, later changes keep the owned prefix in sync
+    World.CreateGroup<FSparseTestStunned, FSparseTestBurning>();
+    REQUIRE(CountGroup() == 50);
+
+    World.AddComponent<FSparseTestBurning>(Entities[2], 2);
+    World.RemoveComponent<FSparseTestStunned>(Entities[0]);
+    World.DestroyEntity(Entities[6]);
+    REQUIRE(CountGroup() == 49);
+
+    for (size64 Index = 0; Index < Entities.Num(); Index += 4)
+    {
+        if (Index != 0 && World.IsAlive(Entities[Index]))
+        {
+            World.RemoveComponent<FSparseTestBurning>(Entities[Index]);
+        }
+    }
+    size64 Expected = 0;
+    World.Each<FSparseTestStunned, FSparseTestBurning>([&Expected](FSparseTestStunned&, FSparseTestBurning&)
+    {
+        ++Expected;
+    });
+    REQUIRE(CountGroup() == Expected);
+}
+
+TEST_CASE("FWorld::BenchmarkSparseToggle", "[ECS][SparseSet][.benchmark]")
+{
+    constexpr int32 Count = 100000;
+
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}, FTestVelocity{1.0f, 1.0f, 1.0f}));
+    }
+
+    // A status effect applied to and cleared from every tenth entity each frame
+    BENCHMARK("ToggleArchetype_10K")
+    {
+        for (size64 Index = 0; Index < Entities.Num(); Index += 10)
+        {
+            World.AddComponent<FSparseTestArchetypeStunned>(Entities[Index], 1.0f);
+        }
+        for (size64 Index = 0; Index < Entities.Num(); Index += 10)
+        {
+            World.RemoveComponent<FSparseTestArchetypeStunned>(Entities[Index]);
+        }
+        return World.GetNumArchetypes();
+    };
+
+    BENCHMARK("ToggleSparse_10K")
+    {
+        for (size64 Index = 0; Index < Entities.Num(); Index += 10)
+        {
+            World.AddComponent<FSparseTestStunned>(Entities[Index], 1.0f);
+        }
+        for (size64 Index = 0; Index < Entities.Num(); Index += 10)
+        {
+            World.RemoveComponent<FSparseTestStunned>(Entities[Index]);
+        }
+        return World.GetNumArchetypes();
+    };
+}
+
+TEST_CASE("FWorld::BenchmarkSparseIterate", "[ECS][SparseSet][.benchmark]")
+{
+    constexpr int32 Count = 1000000;
+
+    FWorld World;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FEntity Entity = World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f});
+        World.AddComponent<FSparseTestStunned>(Entity, 1.0f);
+        if (Index % 2 == 0)
+        {
+            World.AddComponent<FSparseTestBurning>(Entity, 1);
+        }
+    }
+
+    BENCHMARK("Iterate_ArchetypeAndSparse_1M")
+    {
+        World.Each<FTestPosition, FSparseTestStunned>([](FTestPosition& Position, const FSparseTestStunned& Stunned)
+        {
+            Position.X += Stunned.RemainingTime;
+        });
+    };
+
+    BENCHMARK("Iterate_SparseProbe_500K")
+    {
+        World.Each<FSparseTestStunned, FSparseTestBurning>([](FSparseTestStunned& Stunned, const FSparseTestBurning& Burning)
+        {
+            Stunned.RemainingTime -= static_cast<float32>(Burning.Damage);
+        });
+    };
+
+    World.CreateGroup<FSparseTestStunned, FSparseTestBurning>();
+
+    BENCHMARK("Iterate_SparseGroup_500K")
+    {
+        World.EachGroup<FSparseTestStunned, FSparseTestBurning>([](FSparseTestStunned& Stunned, const FSparseTestBurning& Burning)
+        {
+            Stunned.RemainingTime -= static_cast<float32>(Burning.Damage);
+        });
+    };
+}
@@ -0,0 +1,202 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "ECS/SystemScheduler.hpp"
+#include "ECS/World.hpp"
+#include "TestComponents.hpp"
+
+#include <atomic>
+#include <cmath>
+
+TEST_CASE("FSystemScheduler::Stages", "[ECS][SystemScheduler]")
+{
+    FSystemScheduler Scheduler;
+    const auto Noop = [](FWorld&)
+    {
+    };
+    Scheduler.AddSystem("Move", FSystemAccess().Write<FTestPosition>().Read<FTestVelocity>(), Noop);
+    Scheduler.AddSystem("Regenerate", FSystemAccess().Write<FTestHealth>(), Noop);
+    Scheduler.AddSystem("Render", FSystemAccess().Read<FTestPosition, FTestRotation>(), Noop);
+    Scheduler.AddSystem("Steer", FSystemAccess().Write<FTestVelocity>(), Noop);
+    Scheduler.AddSystem("Spin", FSystemAccess().Write<FTestRotation>(), Noop);
+    Scheduler.AddSystem("Spawn", FSystemAccess().Exclusive(), Noop);
+
+    // Readers share a stage, writers wait for earlier users of the same component
+    REQUIRE(Scheduler.GetNumStages() == 4);
+    REQUIRE(Scheduler.DescribeSchedule() ==
+        "Stage 0: Move Regenerate\n"
+        "Stage 1: Render (after Move) Steer (after Move)\n"
+        "Stage 2: Spin (after Render)\n"
+        "Stage 3: Spawn (after Move Regenerate Render Steer Spin)\n");
+}
+
+TEST_CASE("FSystemScheduler::RunKeepsConflictingOrder", "[ECS][SystemScheduler]")
+{
+    FWorld World;
+    for (int32 Index = 0; Index < 10000; ++Index)
+    {
+        World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}, FTestVelocity{1.0f, 0.0f, 0.0f}, FTestHealth{0});
+    }
+
+    std::atomic<int32> NumSpawnRuns = 0;
+    FSystemScheduler Scheduler;
+    Scheduler.AddSystem("Move", FSystemAccess().Write<FTestPosition>().Read<FTestVelocity>(), [](FWorld& InWorld)
+    {
+        InWorld.ParallelEach<FTestPosition, FTestVelocity>([](FTestPosition& Position, const FTestVelocity& Velocity)
+        {
+            Position.X += Velocity.X;
+        });
+    });
+    Scheduler.AddSystem("Accelerate", FSystemAccess().Write<FTestVelocity>(), [](FWorld& InWorld)
+    {
+        InWorld.ParallelEach<FTestVelocity>([](FTestVelocity& Velocity)
+        {
+            Velocity.X *= 2.0f;
+        });
+    });
+    Scheduler.AddSystem("Count", FSystemAccess().Write<FTestHealth>(), [](FWorld& InWorld)
+    {
+        InWorld.Each<FTestHealth>([](FTestHealth& Health)
+        {
+            ++Health.Value;
+        });
+    });
+    Scheduler.AddSystem("Spawn", FSystemAccess().Exclusive(), [&NumSpawnRuns](FWorld& InWorld)
+    {
+        ++NumSpawnRuns;
+        InWorld.CreateEntity(FTestHealth{0});
+    });
+    Scheduler.SetFrameLogging(true);
+
+    for (int32 Frame = 0; Frame < 4; ++Frame)
+    {
+        Scheduler.Run(World);
+    }
+
+    // Move reads the velocity before Accelerate doubles it: 1 + 2 + 4 + 8
+    World.Each<FTestPosition, FTestVelocity>([](const FTestPosition& Position, const FTestVelocity& Velocity)
+    {
+        REQUIRE(Position.X == 15.0f);
+        REQUIRE(Velocity.X == 16.0f);
+    });
+    REQUIRE(NumSpawnRuns == 4);
+    REQUIRE(World.GetNumEntities() == 10004);
+    REQUIRE(Scheduler.GetTimings().Num() == 4);
+    REQUIRE(Scheduler.GetTimings()[0].Stage == 0);
+    REQUIRE(Scheduler.GetTimings()[1].Stage == 1);
+    REQUIRE(Scheduler.GetTimings()[2].Stage == 0);
+    REQUIRE(Scheduler.GetTimings()[3].Stage == 2);
+}
+
+TEST_CASE("FWorld::ParallelEach", "[ECS][SystemScheduler]")
+{
+    FWorld World;
+    for (int32 Index = 0; Index < 100000; ++Index)
+    {
+        if (Index % 3 == 0)
+        {
+            World.CreateEntity(FTestHealth{Index}, FTestPosition{});
+        }
+        else
+        {
+            World.CreateEntity(FTestHealth{Index});
+        }
+    }
+
+    std::atomic<int64> Sum = 0;
+    std::atomic<size64> NumChunks = 0;
+    World.ParallelEachChunk<FTestHealth>([&Sum, &NumChunks](const FEntity*, const size64 NumEntities, const FTestHealth* Healths)
+    {
+        int64 ChunkSum = 0;
+        for (size64 Index = 0; Index < NumEntities; ++Index)
+        {
+            ChunkSum += Healths[Index].Value;
+        }
+        Sum += ChunkSum;
+        ++NumChunks;
+    });
+    REQUIRE(Sum == int64(99999) * 100000 / 2);
+    REQUIRE(NumChunks > 1);
+
+    // Catch assertions are not thread safe, count on the workers and check afterwards
+    std::atomic<size64> NumVisited = 0;
+    std::atomic<size64> NumMismatches = 0;
+    World.ParallelEach<FTestHealth, FTestPosition>([&NumVisited, &NumMismatches](const FEntity Entity, const FTestHealth& Health, FTestPosition&)
+    {
+        NumMismatches += Entity.Index != static_cast<uint32>(Health.Value);
+        ++NumVisited;
+    });
+    REQUIRE(NumVisited == 33334);
+    REQUIRE(NumMismatches == 0);
+}
+
+TEST_CASE("FSystemScheduler::BenchmarkRun", "[ECS][SystemScheduler][.benchmark]")
+{
+    FWorld World;
+    for (int32 Index = 0; Index < 200000; ++Index)
+    {
+        World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}, FTestVelocity{1.0f, 1.0f, 1.0f}, FTestHealth{100},
+            FTestRotation{0.0f, 0.0f, 0.0f, 1.0f});
+    }
+
+    const auto Move = [](FWorld& InWorld)
+    {
+        InWorld.Each<FTestPosition, FTestVelocity>([](FTestPosition& Position, const FTestVelocity& Velocity)
+        {
+            Position.X = std::sqrt(Position.X * Position.X + Velocity.X);
+        });
+    };
+    const auto Spin = [](FWorld& InWorld)
+    {
+        InWorld.Each<FTestRotation>([](FTestRotation& Rotation)
+        {
+            Rotation.W = std::sqrt(Rotation.W * Rotation.W + 1.0f);
+        });
+    };
+    const auto Regenerate = [](FWorld& InWorld)
+    {
+        InWorld.Each<FTestHealth>([](FTestHealth& Health)
+        {
+            Health.Value = (Health.Value * 7 + 1) % 1000;
+        });
+    };
+    const auto ParallelMove = [](FWorld& InWorld)
+    {
+        InWorld.ParallelEach<FTestPosition, FTestVelocity>([](FTestPosition& Position, const FTestVelocity& Velocity)
+        {
+            Position.X = std::sqrt(Position.X * Position.X + Velocity.X);
+        });
+    };
+
+    // The same three systems, once forced to run one after the other and once scheduled by their access
+    FSystemScheduler Serial;
+    Serial.AddSystem("Move", FSystemAccess().Exclusive(), Move);
+    Serial.AddSystem("Spin", FSystemAccess().Exclusive(), Spin);
+    Serial.AddSystem("Regenerate", FSystemAccess().Exclusive(), Regenerate);
+
+    FSystemScheduler Scheduled;
+    Scheduled.AddSystem("Move", FSystemAccess().Write<FTestPosition>().Read<FTestVelocity>(), Move);
+    Scheduled.AddSystem("Spin", FSystemAccess().Write<FTestRotation>(), Spin);
+    Scheduled.AddSystem("Regenerate", FSystemAccess().Write<FTestHealth>(), Regenerate);
+
+    FSystemScheduler Chunked;
+    Chunked.AddSystem("Move", FSystemAccess().Write<FTestPosition>().Read<FTestVelocity>(), ParallelMove);
+    Chunked.AddSystem("Spin", FSystemAccess().Write<FTestRotation>(), Spin);
+    Chunked.AddSystem("Regenerate", FSystemAccess().Write<FTestHealth>(), Regenerate);
+
+    BENCHMARK("Run_Serial")
+    {
+        Serial.Run(World);
+    };
+
+    BENCHMARK("Run_Scheduled")
+    {
+        Scheduled.Run(World);
+    };
+
+    BENCHMARK("Run_ScheduledWithChunkJobs")
+    {
+        Chunked.Run(World);
+    };
+}
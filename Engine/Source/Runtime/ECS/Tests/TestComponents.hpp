@@ -0,0 +1,37 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include <string>
+
+// Plain components the ECS tests share. Variants with a storage or change tracking option stay next to their tests
+
+struct FTestPosition
+{
+    float32 X, Y, Z;
+};
+
+struct FTestVelocity
+{
+    float32 X, Y, Z;
+};
+
+struct FTestRotation
+{
+    float32 X, Y, Z, W;
+};
+
+struct FTestHealth
+{
+    int32 Value;
+};
+
+// Not trivially copyable, so archetypes have to relocate and destroy it through its type info
+struct FTestName
+{
+    std::string Value;
+};
+
+struct FTestTag
+{
+};
@@ -0,0 +1,174 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "ECS/TransformHierarchy.hpp"
+
+#include <cmath>
+#include <random>
+
+namespace
+{
+    float32 GetTranslationX(const FMatrix44& Matrix)
+    {
+        return Matrix.M[0][3];
+    }
+
+    // World transform by walking up to the root, for comparison with the sweep
+    FMatrix44 ComputeWorldSlowly(const FTransformHierarchy& Hierarchy, const FTransformHandle Handle)
+    {
+        FMatrix44 World = Hierarchy.GetLocal(Handle);
+        for (FTransformHandle Parent = Hierarchy.GetParent(Handle); Parent.IsValid(); Parent = Hierarchy.GetParent(Parent))
+        {
+            World = FMatrix44::Multiply(Hierarchy.GetLocal(Parent), World);
+        }
+        return World;
+    }
+
+    bool8 IsNearlyEqual(const FMatrix44& A, const FMatrix44& B)
+    {
+        for (uint32 Row = 0; Row < 4; ++Row)
+        {
+            for (uint32 Column = 0; Column < 4; ++Column)
+            {
+                if (std::abs(A.M[Row][Column] - B.M[Row][Column]) > 1e-3f * (1.0f + std::abs(B.M[Row][Column])))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+TEST_CASE("FTransformHierarchy::DirtyPropagation", "[ECS][TransformHierarchy]")
+{
+    FTransformHierarchy Hierarchy;
+    const FTransformHandle Root = Hierarchy.AddNode(FMatrix44::MakeTranslation({1.0f, 0.0f, 0.0f}));
+    const FTransformHandle Left = Hierarchy.AddNode(FMatrix44::MakeTranslation({10.0f, 0.0f, 0.0f}), Root);
+    const FTransformHandle Right = Hierarchy.AddNode(FMatrix44::MakeTranslation({20.0f, 0.0f, 0.0f}), Root);
+    const FTransformHandle LeftChild = Hierarchy.AddNode(FMatrix44::MakeTranslation({100.0f, 0.0f, 0.0f}), Left);
+    Hierarchy.Update();
+
+    REQUIRE(Hierarchy.GetNumLevels() == 3);
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(Root)) == 1.0f);
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(Left)) == 11.0f);
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(Right)) == 21.0f);
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(LeftChild)) == 111.0f);
+
+    // Changing a node recomputes its subtree
+    Hierarchy.SetLocal(Left, FMatrix44::MakeTranslation({50.0f, 0.0f, 0.0f}));
+    Hierarchy.Update();
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(Left)) == 51.0f);
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(LeftChild)) == 151.0f);
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(Right)) == 21.0f);
+
+    // Reparenting moves the whole subtree, handles survive the re-sort
+    Hierarchy.SetParent(Left, Right);
+    Hierarchy.Update();
+    REQUIRE(Hierarchy.GetNumLevels() == 4);
+    REQUIRE(Hierarchy.GetParent(Left) == Right);
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(LeftChild)) == 171.0f);
+
+    Hierarchy.SetParent(Left, {});
+    Hierarchy.Update();
+    REQUIRE_FALSE(Hierarchy.GetParent(Left).IsValid());
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(LeftChild)) == 150.0f);
+
+    // Removing a node removes its descendants
+    Hierarchy.SetParent(Left, Right);
+    Hierarchy.RemoveNode(Right);
+    REQUIRE(Hierarchy.Num() == 1);
+    REQUIRE_FALSE(Hierarchy.Contains(Right));
+    REQUIRE_FALSE(Hierarchy.Contains(Left));
+    REQUIRE_FALSE(Hierarchy.Contains(LeftChild));
+    REQUIRE(Hierarchy.Contains(Root));
+
+    const FTransformHandle Reused = Hierarchy.AddNode(FMatrix44::MakeTranslation({5.0f, 0.0f, 0.0f}), Root);
+    REQUIRE_FALSE(Hierarchy.Contains(Right));
+    Hierarchy.Update();
+    REQUIRE(GetTranslationX(Hierarchy.GetWorld(Reused)) == 6.0f);
+}
+
+TEST_CASE("FTransformHierarchy::MatchesReference", "[ECS][TransformHierarchy]")
+{
+    std::mt19937 Random(7);
+    FTransformHierarchy Hierarchy;
+    TArray<FTransformHandle> Handles;
+    const auto RandomLocal = [&Random]
+    {
+        std::uniform_real_distribution<float32> Distribution(0.5f, 1.5f);
+        return FMatrix44::Multiply(FMatrix44::MakeTranslation({Distribution(Random), Distribution(Random), Distribution(Random)}),
+            FMatrix44::MakeScale({Distribution(Random), 1.0f, 1.0f / Distribution(Random)}));
+    };
+
+    // Enough nodes per level to split the sweep across jobs
+    for (uint32 Index = 0; Index < 60000; ++Index)
+    {
+        const FTransformHandle Parent = Index < 4 ? FTransformHandle{} : Handles[Random() % Handles.Num()];
+        Handles.PushBack(Hierarchy.AddNode(RandomLocal(), Parent));
+    }
+
+    for (int32 Round = 0; Round < 3; ++Round)
+    {
+        for (int32 Change = 0; Change < 200; ++Change)
+        {
+            Hierarchy.SetLocal(Handles[Random() % Handles.Num()], RandomLocal());
+        }
+        for (int32 Move = 0; Move < 20; ++Move)
+        {
+            const FTransformHandle Node = Handles[4 + Random() % (Handles.Num() - 4)];
+            const FTransformHandle Parent = Handles[Random() % 4];
+            Hierarchy.SetParent(Node, Parent);
+        }
+        Hierarchy.Update();
+
+        size64 NumMismatches = 0;
+        for (size64 Index = 0; Index < Handles.Num(); Index += 7)
+        {
+            NumMismatches += IsNearlyEqual(Hierarchy.GetWorld(Handles[Index]), ComputeWorldSlowly(Hierarchy, Handles[Index])) ? 0 : 1;
+        }
+        REQUIRE(NumMismatches == 0);
+    }
+}
+
+TEST_CASE("FTransformHierarchy::BenchmarkUpdate", "[ECS][TransformHierarchy][.benchmark]")
+{
+    static constexpr uint32 NumNodes = 1000000;
+
+    // Eight children per node, about seven levels
+    FTransformHierarchy Hierarchy;
+    TArray<FTransformHandle> Handles;
+    Handles.Reserve(NumNodes);
+    for (uint32 Index = 0; Index < NumNodes; ++Index)
+    {
+        const FTransformHandle Parent = Index == 0 ? FTransformHandle{} : Handles[(Index - 1) / 8];
+        Handles.PushBack(Hierarchy.AddNode(FMatrix44::MakeTranslation({1.0f, 0.0f, 0.0f}), Parent));
+    }
+    Hierarchy.Update();
+
+    std::mt19937 Random(11);
+    TArray<FTransformHandle> OnePercent;
+    for (uint32 Index = 0; Index < NumNodes / 100; ++Index)
+    {
+        OnePercent.PushBack(Handles[Random() % NumNodes]);
+    }
+    const FMatrix44 Local = FMatrix44::MakeTranslation({2.0f, 0.0f, 0.0f});
+
+    BENCHMARK("Update_1M_1PercentDirty")
+    {
+        for (const FTransformHandle Handle : OnePercent)
+        {
+            Hierarchy.SetLocal(Handle, Local);
+        }
+        Hierarchy.Update();
+        return Hierarchy.GetWorld(Handles[NumNodes - 1]).M[0][3];
+    };
+
+    BENCHMARK("Update_1M_AllDirty")
+    {
+        Hierarchy.SetLocal(Handles[0], Local);
+        Hierarchy.Update();
+        return Hierarchy.GetWorld(Handles[NumNodes - 1]).M[0][3];
+    };
+}
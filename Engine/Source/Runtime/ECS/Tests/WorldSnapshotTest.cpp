@@ -0,0 +1,371 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "ECS/SystemScheduler.hpp"
+#include "ECS/World.hpp"
+#include "ECS/WorldSnapshot.hpp"
+#include "TestComponents.hpp"
+
+#include <cstring>
+#include <string>
+
+struct FSnapshotTestHealth
+{
+    static constexpr EChangeTracking ChangeTracking = EChangeTracking::Entity;
+
+    int32 Value;
+};
+
+struct FSnapshotTestStunned
+{
+    static constexpr EComponentStorage Storage = EComponentStorage::SparseSet;
+};
+
+namespace
+{
+    void PopulateSnapshotWorld(FWorld& World, TArray<FEntity>& OutEntities, const int32 NumEntities)
+    {
+        for (int32 Index = 0; Index < NumEntities; ++Index)
+        {
+            const float32 Value = static_cast<float32>(Index);
+            if (Index % 3 == 0)
+            {
+                OutEntities.PushBack(World.CreateEntity(FTestPosition{Value, 0.0f, 0.0f}));
+            }
+            else
+            {
+                OutEntities.PushBack(World.CreateEntity(FTestPosition{Value, 0.0f, 0.0f}, FTestVelocity{1.0f, 2.0f, 3.0f},
+                    FSnapshotTestHealth{Index}));
+            }
+        }
+    }
+
+    // Offsets of the sections of a snapshot as FWorldSnapshot lays them out, so tests can corrupt single fields
+    struct FSnapshotLayout
+    {
+        size64 FirstArchetype;
+        size64 EntityRecords;
+        size64 FreeEntityIndices;
+    };
+
+    constexpr size64 SnapshotArchetypeSize = 16;
+    constexpr size64 SnapshotColumnSize = 16;
+    constexpr size64 SnapshotRecordSize = 16;
+    constexpr size64 SnapshotRecordArchetype = 0;
+    constexpr size64 SnapshotRecordRow = 8;
+    constexpr size64 SnapshotRecordGeneration = 12;
+
+    uint32 ReadSnapshotWord(const TArray<uint8>& Data, const size64 Offset)
+    {
+        uint32 Value;
+        std::memcpy(&Value, &Data[Offset], sizeof(Value));
+        return Value;
+    }
+
+    void WriteSnapshotWord(TArray<uint8>& Data, const size64 Offset, const uint32 Value)
+    {
+        std::memcpy(&Data[Offset], &Value, sizeof(Value));
+    }
+
+    FSnapshotLayout GetSnapshotLayout(const TArray<uint8>& Data)
+    {
+        constexpr size64 HeaderSize = 40;
+        const uint32 NumArchetypes = ReadSnapshotWord(Data, 12);
+        const uint32 NumEntityRecords = ReadSnapshotWord(Data, 16);
+
+        size64 Offset = HeaderSize;
+        for (uint32 ArchetypeIndex = 0; ArchetypeIndex < NumArchetypes; ++ArchetypeIndex)
+        {
+            Offset += SnapshotArchetypeSize + SnapshotColumnSize * ReadSnapshotWord(Data, Offset);
+        }
+        return FSnapshotLayout{.FirstArchetype = HeaderSize, .EntityRecords = Offset, .FreeEntityIndices = Offset + SnapshotRecordSize * NumEntityRecords};
+    }
+}
+
+TEST_CASE("FWorldSnapshot::RoundTrip", "[ECS][WorldSnapshot]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    PopulateSnapshotWorld(World, Entities, 5000);
+
+    // Holes in the entity records and in the free list have to survive too
+    for (size64 Index = 0; Index < Entities.Num(); Index += 10)
+    {
+        World.DestroyEntity(Entities[Index]);
+    }
+    World.AdvanceChangeTick();
+
+    TArray<uint8> Data;
+    REQUIRE(FWorldSnapshot::Save(World, Data));
+    REQUIRE(Data.Num() % ArchetypeChunkAlignment == 0);
+    const uint32 SavedTick = World.GetChangeTick();
+
+    const auto RequireSavedState = [&Entities, SavedTick](const FWorld& Restored)
+    {
+        REQUIRE(Restored.GetNumEntities() == 4500);
+        REQUIRE(Restored.GetChangeTick() == SavedTick);
+        size64 NumMismatches = 0;
+        for (size64 Index = 0; Index < Entities.Num(); ++Index)
+        {
+            const FEntity Entity = Entities[Index];
+            if (Index % 10 == 0)
+            {
+                NumMismatches += Restored.IsAlive(Entity) ? 1 : 0;
+                continue;
+            }
+            const FTestPosition* Position = Restored.GetComponent<FTestPosition>(Entity);
+            const FSnapshotTestHealth* Health = Restored.GetComponent<FSnapshotTestHealth>(Entity);
+            const bool8 bHasHealth = Index % 3 != 0;
+            NumMismatches += Position != nullptr && Position->X == static_cast<float32>(Index) ? 0 : 1;
+            NumMismatches += (Health != nullptr) == bHasHealth && (!bHasHealth || Health->Value == static_cast<int32>(Index)) ? 0 : 1;
+        }
+        REQUIRE(NumMismatches == 0);
+    };
+
+    SECTION("Into the same world")
+    {
+        for (size64 Index = 1; Index < Entities.Num(); Index += 10)
+        {
+            World.GetComponent<FTestPosition>(Entities[Index])->X = -1.0f;
+            if (World.HasComponent<FSnapshotTestHealth>(Entities[Index + 1]))
+            {
+                World.RemoveComponent<FSnapshotTestHealth>(Entities[Index + 1]);
+            }
+        }
+        const FEntity Extra = World.CreateEntity(FTestVelocity{});
+
+        REQUIRE(FWorldSnapshot::Load(World, Data.GetData(), Data.Num()));
+        RequireSavedState(World);
+        REQUIRE_FALSE(World.IsAlive(Extra));
+
+        // Entities created after the restore reuse the saved free indices
+        const FEntity Created = World.CreateEntity(FTestPosition{});
+        REQUIRE(World.IsAlive(Created));
+        REQUIRE(World.GetNumEntities() == 4501);
+    }
+
+    SECTION("Into a fresh world")
+    {
+        FWorld Restored;
+        REQUIRE(FWorldSnapshot::Load(Restored, Data.GetData(), Data.Num()));
+        RequireSavedState(Restored);
+
+        // Queries see the restored chunks with their change versions
+        size64 NumMoving = 0;
+        Restored.Each<const FTestPosition, const FTestVelocity>(
+            [&NumMoving](const FTestPosition&, const FTestVelocity&)
+            {
+                ++NumMoving;
+            });
+        REQUIRE(NumMoving == 3000);
+
+        size64 NumChanged = 0;
+        Restored.Each<const FSnapshotTestHealth>(FQueryFilter().Changed<FSnapshotTestHealth>(SavedTick - 1),
+            [&NumChanged](const FSnapshotTestHealth&)
+            {
+                ++NumChanged;
+            });
+        REQUIRE(NumChanged == 0);
+    }
+}
+
+TEST_CASE("FWorldSnapshot::RejectsInvalidData", "[ECS][WorldSnapshot]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    PopulateSnapshotWorld(World, Entities, 100);
+    World.DestroyEntity(Entities[10]);
+    World.DestroyEntity(Entities[20]);
+    TArray<uint8> Data;
+    REQUIRE(FWorldSnapshot::Save(World, Data));
+    const FSnapshotLayout Layout = GetSnapshotLayout(Data);
+    const auto GetRecord = [&Layout](const FEntity Entity, const size64 Field)
+    {
+        return Layout.EntityRecords + SnapshotRecordSize * Entity.Index + Field;
+    };
+
+    FWorld Target;
+    const FEntity Existing = Target.CreateEntity(FTestVelocity{4.0f, 5.0f, 6.0f});
+    const size64 NumArchetypes = Target.GetNumArchetypes();
+
+    SECTION("Truncated")
+    {
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num() - 1));
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), 8));
+    }
+
+    SECTION("Bad magic")
+    {
+        Data[0] ^= 0xFF;
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Chunk capacity")
+    {
+        // Caught before the archetypes of the snapshot are created
+        WriteSnapshotWord(Data, Layout.FirstArchetype + 4, ReadSnapshotWord(Data, Layout.FirstArchetype + 4) + 1);
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Record past the rows of its archetype")
+    {
+        WriteSnapshotWord(Data, GetRecord(Entities[0], SnapshotRecordRow), 1000);
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Record pointing at the row of another entity")
+    {
+        // Entities 0 and 3 share an archetype and sit in neighbouring rows
+        WriteSnapshotWord(Data, GetRecord(Entities[0], SnapshotRecordRow), ReadSnapshotWord(Data, GetRecord(Entities[3], SnapshotRecordRow)));
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Record of an unknown archetype")
+    {
+        WriteSnapshotWord(Data, GetRecord(Entities[0], SnapshotRecordArchetype), 1000);
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Destroyed record holding a row")
+    {
+        // The row's entity is then missing its record
+        WriteSnapshotWord(Data, GetRecord(Entities[3], SnapshotRecordArchetype), 0xFFFFFFFF);
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Free index out of range")
+    {
+        WriteSnapshotWord(Data, Layout.FreeEntityIndices, 1000);
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Free index of a live entity")
+    {
+        WriteSnapshotWord(Data, Layout.FreeEntityIndices, Entities[0].Index);
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Free index listed twice")
+    {
+        WriteSnapshotWord(Data, Layout.FreeEntityIndices + sizeof(uint32), ReadSnapshotWord(Data, Layout.FreeEntityIndices));
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Data.GetData(), Data.Num()));
+    }
+
+    SECTION("Duplicate archetype signature")
+    {
+        // Relabelling the velocity archetype as the position one keeps every count and row consistent
+        FWorld Source;
+        Source.CreateEntity(FTestPosition{1.0f, 2.0f, 3.0f});
+        Source.CreateEntity(FTestVelocity{4.0f, 5.0f, 6.0f});
+        TArray<uint8> Duplicated;
+        REQUIRE(FWorldSnapshot::Save(Source, Duplicated));
+
+        TArray<size64> Columns;
+        size64 Offset = GetSnapshotLayout(Duplicated).FirstArchetype;
+        for (uint32 ArchetypeIndex = 0; ArchetypeIndex < ReadSnapshotWord(Duplicated, 12); ++ArchetypeIndex)
+        {
+            const uint32 NumColumns = ReadSnapshotWord(Duplicated, Offset);
+            if (NumColumns == 1)
+            {
+                Columns.PushBack(Offset + SnapshotArchetypeSize);
+            }
+            Offset += SnapshotArchetypeSize + SnapshotColumnSize * NumColumns;
+        }
+        REQUIRE(Columns.Num() == 2);
+        std::memcpy(&Duplicated[Columns[1]], &Duplicated[Columns[0]], SnapshotColumnSize);
+        REQUIRE_FALSE(FWorldSnapshot::Load(Target, Duplicated.GetData(), Duplicated.Num()));
+    }
+
+    // A failed load leaves the world untouched, it does not even gain the archetypes of the snapshot
+    REQUIRE(Target.GetNumArchetypes() == NumArchetypes);
+    REQUIRE(Target.GetNumEntities() == 1);
+    REQUIRE(Target.GetComponent<FTestVelocity>(Existing)->Y == 5.0f);
+}
+
+TEST_CASE("FWorld::GenerationOverflowRetiresIndex", "[ECS][WorldSnapshot]")
+{
+    // Destroying an entity four billion times is out of reach, a snapshot hands the destroyed record its last generation
+    FWorld Source;
+    const FEntity Destroyed = Source.CreateEntity(FTestPosition{});
+    Source.DestroyEntity(Destroyed);
+    TArray<uint8> Data;
+    REQUIRE(FWorldSnapshot::Save(Source, Data));
+    WriteSnapshotWord(Data, GetSnapshotLayout(Data).EntityRecords + SnapshotRecordSize * Destroyed.Index + SnapshotRecordGeneration, FEntity::MaxGeneration);
+
+    FWorld World;
+    REQUIRE(FWorldSnapshot::Load(World, Data.GetData(), Data.Num()));
+    const FEntity Last = World.CreateEntity(FTestPosition{});
+    REQUIRE(Last.Index == Destroyed.Index);
+    REQUIRE(Last.Generation == FEntity::MaxGeneration);
+    World.DestroyEntity(Last);
+
+    const FEntity Next = World.CreateEntity(FTestPosition{});
+    REQUIRE(Next.Index != Destroyed.Index);
+    REQUIRE_FALSE(World.IsAlive(Last));
+    REQUIRE_FALSE(World.IsAlive(FEntity{.Index = Destroyed.Index, .Generation = 0}));
+
+    // The retired index stays out of the free list across another round trip
+    REQUIRE(FWorldSnapshot::Save(World, Data));
+    FWorld Restored;
+    REQUIRE(FWorldSnapshot::Load(Restored, Data.GetData(), Data.Num()));
+    REQUIRE(Restored.CreateEntity().Index != Destroyed.Index);
+}
+
+TEST_CASE("FWorldSnapshot::Unsupported", "[ECS][WorldSnapshot]")
+{
+    FWorld World;
+    TArray<uint8> Data;
+
+    SECTION("Non trivially copyable components")
+    {
+        const FEntity Entity = World.CreateEntity(FTestName{"Raven"});
+        REQUIRE_FALSE(FWorldSnapshot::Save(World, Data));
+
+        // Archetypes that emptied out do not matter
+        World.DestroyEntity(Entity);
+        REQUIRE(FWorldSnapshot::Save(World, Data));
+    }
+
+    SECTION("Sparse components")
+    {
+        const FEntity Entity = World.CreateEntity(FTestPosition{});
+        World.AddComponent<FSnapshotTestStunned>(Entity);
+        REQUIRE_FALSE(FWorldSnapshot::Save(World, Data));
+
+        // Loading clears them
+        World.RemoveComponent<FSnapshotTestStunned>(Entity);
+        REQUIRE(FWorldSnapshot::Save(World, Data));
+        World.AddComponent<FSnapshotTestStunned>(Entity);
+        REQUIRE(FWorldSnapshot::Load(World, Data.GetData(), Data.Num()));
+        REQUIRE_FALSE(World.HasComponent<FSnapshotTestStunned>(Entity));
+        REQUIRE(World.HasComponent<FTestPosition>(Entity));
+    }
+}
+
+TEST_CASE("FWorldSnapshot::Benchmark", "[ECS][WorldSnapshot][.benchmark]")
+{
+    for (const int32 NumEntities : {100000, 1000000})
+    {
+        FWorld World;
+        TArray<FEntity> Entities;
+        Entities.Reserve(NumEntities);
+        PopulateSnapshotWorld(World, Entities, NumEntities);
+
+        TArray<uint8> Data;
+        REQUIRE(FWorldSnapshot::Save(World, Data));
+        CVLOG(LogECS, Info, "Snapshot of {} entities: {} bytes", NumEntities, Data.Num());
+
+        FWorld Restored;
+        const std::string Suffix = std::to_string(NumEntities / 1000) + "K";
+        BENCHMARK("Save_" + Suffix)
+        {
+            return FWorldSnapshot::Save(World, Data);
+        };
+
+        BENCHMARK("Load_" + Suffix)
+        {
+            return FWorldSnapshot::Load(Restored, Data.GetData(), Data.Num());
+        };
+    }
+}
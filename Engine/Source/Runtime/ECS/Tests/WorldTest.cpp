@@ -0,0 +1,252 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "ECS/World.hpp"
+#include "TestComponents.hpp"
+
+#include <string>
+
+TEST_CASE("FWorld::CreateAndDestroy", "[ECS][World]")
+{
+    FWorld World;
+
+    const FEntity Empty = World.CreateEntity();
+    const FEntity Moving = World.CreateEntity(FTestPosition{1.0f, 2.0f, 3.0f}, FTestVelocity{0.0f, 1.0f, 0.0f});
+    REQUIRE(World.GetNumEntities() == 2);
+    REQUIRE(World.IsAlive(Empty));
+    REQUIRE(World.IsAlive(Moving));
+    REQUIRE(World.GetComponent<FTestPosition>(Moving)->Y == 2.0f);
+    REQUIRE(World.GetComponent<FTestPosition>(Empty) == nullptr);
+
+    World.DestroyEntity(Empty);
+    REQUIRE_FALSE(World.IsAlive(Empty));
+    REQUIRE(World.GetNumEntities() == 1);
+
+    // The recycled index carries a new generation
+    const FEntity Recycled = World.CreateEntity();
+    REQUIRE(Recycled.Index == Empty.Index);
+    REQUIRE(Recycled.Generation != Empty.Generation);
+    REQUIRE_FALSE(World.IsAlive(Empty));
+    REQUIRE(World.IsAlive(Recycled));
+}
+
+TEST_CASE("FWorld::AddAndRemoveComponents", "[ECS][World]")
+{
+    FWorld World;
+    const FEntity Entity = World.CreateEntity(FTestPosition{1.0f, 0.0f, 0.0f});
+
+    World.AddComponent<FTestVelocity>(Entity, 5.0f, 0.0f, 0.0f);
+    World.AddComponent<FTestName>(Entity, "Corvus");
+    REQUIRE(World.HasComponent<FTestPosition>(Entity));
+    REQUIRE(World.HasComponent<FTestVelocity>(Entity));
+    REQUIRE(World.GetComponent<FTestPosition>(Entity)->X == 1.0f);
+    REQUIRE(World.GetComponent<FTestName>(Entity)->Value == "Corvus");
+
+    // Adding an existing component replaces it without changing the archetype
+    const size64 NumArchetypes = World.GetNumArchetypes();
+    World.AddComponent<FTestVelocity>(Entity, 7.0f, 0.0f, 0.0f);
+    REQUIRE(World.GetComponent<FTestVelocity>(Entity)->X == 7.0f);
+    REQUIRE(World.GetNumArchetypes() == NumArchetypes);
+
+    World.RemoveComponent<FTestPosition>(Entity);
+    REQUIRE_FALSE(World.HasComponent<FTestPosition>(Entity));
+    REQUIRE(World.GetComponent<FTestVelocity>(Entity)->X == 7.0f);
+    REQUIRE(World.GetComponent<FTestName>(Entity)->Value == "Corvus");
+
+    // Removing a missing component is a no-op
+    World.RemoveComponent<FTestHealth>(Entity);
+    REQUIRE(World.HasComponent<FTestName>(Entity));
+}
+
+TEST_CASE("FWorld::SwapRemoveKeepsRecordsValid", "[ECS][World]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < 5000; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FTestHealth{Index}, FTestName{std::to_string(Index)}));
+    }
+
+    for (size64 Index = 0; Index < Entities.Num(); Index += 3)
+    {
+        World.DestroyEntity(Entities[Index]);
+    }
+    for (size64 Index = 1; Index < Entities.Num(); Index += 3)
+    {
+        World.RemoveComponent<FTestName>(Entities[Index]);
+    }
+
+    for (size64 Index = 0; Index < Entities.Num(); ++Index)
+    {
+        const FEntity Entity = Entities[Index];
+        if (Index % 3 == 0)
+        {
+            REQUIRE_FALSE(World.IsAlive(Entity));
+            continue;
+        }
+        REQUIRE(World.GetComponent<FTestHealth>(Entity)->Value == static_cast<int32>(Index));
+        if (Index % 3 == 1)
+        {
+            REQUIRE_FALSE(World.HasComponent<FTestName>(Entity));
+        }
+        else
+        {
+            REQUIRE(World.GetComponent<FTestName>(Entity)->Value == std::to_string(Index));
+        }
+    }
+}
+
+TEST_CASE("FWorld::Each", "[ECS][World]")
+{
+    FWorld World;
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        const FEntity Entity = World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}, FTestVelocity{1.0f, 0.0f, 0.0f});
+        if (Index % 2 == 0)
+        {
+            World.AddComponent<FTestTag>(Entity);
+        }
+    }
+    World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f});
+
+    World.Each<FTestPosition, FTestVelocity>([](FTestPosition& Position, const FTestVelocity& Velocity)
+    {
+        Position.X += Velocity.X;
+    });
+
+    size64 NumMoved = 0;
+    size64 NumTagged = 0;
+    World.Each<FTestPosition>([&NumMoved](const FEntity, const FTestPosition& Position)
+    {
+        NumMoved += Position.X == 1.0f;
+    });
+    World.Each<FTestTag>([&NumTagged](FTestTag&)
+    {
+        ++NumTagged;
+    });
+    REQUIRE(NumMoved == 1000);
+    REQUIRE(NumTagged == 500);
+
+    size64 NumChunkEntities = 0;
+    World.EachChunk<FTestPosition>([&NumChunkEntities](const FEntity*, const size64 NumEntities, FTestPosition*)
+    {
+        NumChunkEntities += NumEntities;
+    });
+    REQUIRE(NumChunkEntities == 1001);
+}
+
+TEST_CASE("FWorld::DestroysNonTrivialComponents", "[ECS][World]")
+{
+    const std::string LongValue(100, 'x');
+    {
+        FWorld World;
+        for (int32 Index = 0; Index < 100; ++Index)
+        {
+            World.CreateEntity(FTestName{LongValue});
+        }
+        const FEntity Entity = World.CreateEntity(FTestName{LongValue}, FTestHealth{1});
+        World.RemoveComponent<FTestHealth>(Entity);
+        REQUIRE(World.GetComponent<FTestName>(Entity)->Value == LongValue);
+    }
+    REQUIRE(LongValue.size() == 100);
+}
+
+TEST_CASE("FWorld::BenchmarkCreateDestroy", "[ECS][World][.benchmark]")
+{
+    BENCHMARK("Create_1M")
+    {
+        FWorld World;
+        for (int32 Index = 0; Index < 1000000; ++Index)
+        {
+            World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}, FTestVelocity{1.0f, 1.0f, 1.0f});
+        }
+        return World.GetNumEntities();
+    };
+
+    BENCHMARK("CreateDestroy_1M")
+    {
+        FWorld World;
+        TArray<FEntity> Entities;
+        Entities.Reserve(1000000);
+        for (int32 Index = 0; Index < 1000000; ++Index)
+        {
+            Entities.PushBack(World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}, FTestVelocity{1.0f, 1.0f, 1.0f}));
+        }
+        for (const FEntity Entity : Entities)
+        {
+            World.DestroyEntity(Entity);
+        }
+        return World.GetNumEntities();
+    };
+}
+
+TEST_CASE("FWorld::BenchmarkIterate", "[ECS][World][.benchmark]")
+{
+    FWorld World;
+    for (int32 Index = 0; Index < 1000000; ++Index)
+    {
+        World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}, FTestVelocity{1.0f, 1.0f, 1.0f}, FTestHealth{100}, FTestRotation{0.0f, 0.0f, 0.0f, 1.0f});
+    }
+
+    BENCHMARK("Iterate_1Component_1M")
+    {
+        World.Each<FTestPosition>([](FTestPosition& Position)
+        {
+            Position.X += 1.0f;
+        });
+    };
+
+    BENCHMARK("Iterate_2Components_1M")
+    {
+        World.Each<FTestPosition, FTestVelocity>([](FTestPosition& Position, const FTestVelocity& Velocity)
+        {
+            Position.X += Velocity.X;
+            Position.Y += Velocity.Y;
+            Position.Z += Velocity.Z;
+        });
+    };
+
+    BENCHMARK("Iterate_3Components_1M")
+    {
+        World.Each<FTestPosition, FTestVelocity, FTestHealth>([](FTestPosition& Position, const FTestVelocity& Velocity, FTestHealth& Health)
+        {
+            Position.X += Velocity.X;
+            Health.Value -= 1;
+        });
+    };
+
+    BENCHMARK("Iterate_4Components_1M")
+    {
+        World.Each<FTestPosition, FTestVelocity, FTestHealth, FTestRotation>(
+            [](FTestPosition& Position, const FTestVelocity& Velocity, FTestHealth& Health, FTestRotation& Rotation)
+        {
+            Position.X += Velocity.X;
+            Health.Value -= 1;
+            Rotation.W = Rotation.W * 0.5f + 0.5f;
+        });
+    };
+}
+
+TEST_CASE("FWorld::BenchmarkAddRemoveChurn", "[ECS][World][.benchmark]")
+{
+    FWorld World;
+    TArray<FEntity> Entities;
+    for (int32 Index = 0; Index < 100000; ++Index)
+    {
+        Entities.PushBack(World.CreateEntity(FTestPosition{0.0f, 0.0f, 0.0f}, FTestVelocity{1.0f, 1.0f, 1.0f}));
+    }
+
+    BENCHMARK("AddRemove_100K")
+    {
+        for (const FEntity Entity : Entities)
+        {
+            World.AddComponent<FTestHealth>(Entity, 100);
+        }
+        for (const FEntity Entity : Entities)
+        {
+            World.RemoveComponent<FTestHealth>(Entity);
+        }
+        return World.GetNumArchetypes();
+    };
+}
@@ -0,0 +1,10 @@
+local module_name = 'ECS'
+
+corvus_engine_target(module_name)
+  add_deps('Core')
+corvus_target_end()
+
+-- Tests
+corvus_test_target(module_name)
+  add_deps('ECS')
+corvus_target_end()